@@ -1,3 +0,0 @@
-
-SD_LIB_EXPORT const char* runLightBenchmarkSuit(bool printOut);
-SD_LIB_EXPORT const char* runFullBenchmarkSuit(bool printOut);
\ No newline at end of file
@@ -0,0 +1,315 @@
+/* ******************************************************************************
+ *
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ *  See the NOTICE file distributed with this work for additional
+ *  information regarding copyright ownership.
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ******************************************************************************/
+
+//
+// libnd4j_bench: command line runner for op microbenchmarks
+//
+// Examples:
+//   libnd4j_bench --op matmul --inputs 2 --shapes 512x512,1024x1024 --threads 1,4,8 --format csv
+//   libnd4j_bench --legacy reduce_same:0 --shapes 128x1024 --axes "0;1" --orders c,f --output sum.json
+//
+// Without --op or --legacy the default suite is executed. Output goes to stdout unless --output is given.
+//
+#include <helpers/BenchmarkHelper.h>
+#include <helpers/DeclarableBenchmark.h>
+#include <ops/declarable/LegacyOp.h>
+#include <ops/declarable/OpRegistrator.h>
+
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <sstream>
+
+using namespace sd;
+
+struct RunnerOptions {
+  std::string op;
+  std::string legacy;
+  int inputs = 1;
+  bool inplace = false;
+  std::vector<double> tArgs;
+  std::vector<LongType> iArgs;
+  BenchmarkGrid grid;
+  int warmup = 10;
+  int iterations = 100;
+  std::vector<int> threads;
+  std::string format = "json";
+  std::string output;
+};
+
+static std::vector<std::string> split(const std::string &value, char delimiter) {
+  std::vector<std::string> result;
+  std::stringstream stream(value);
+  std::string token;
+  while (std::getline(stream, token, delimiter))
+    if (!token.empty()) result.emplace_back(token);
+
+  return result;
+}
+
+static std::vector<LongType> parseLongs(const std::string &value, char delimiter) {
+  std::vector<LongType> result;
+  for (const auto &token : split(value, delimiter)) result.emplace_back(std::stoll(token));
+
+  return result;
+}
+
+static DataType parseDataType(std::string value) {
+  for (auto &c : value) c = std::tolower(c);
+
+  if (value == "float32" || value == "float") return FLOAT32;
+  if (value == "double" || value == "float64") return DOUBLE;
+  if (value == "half" || value == "float16") return HALF;
+  if (value == "bfloat16") return BFLOAT16;
+  if (value == "int8") return INT8;
+  if (value == "int16") return INT16;
+  if (value == "int32") return INT32;
+  if (value == "int64") return INT64;
+  if (value == "uint8") return UINT8;
+  if (value == "bool") return BOOL;
+
+  THROW_EXCEPTION(("libnd4j_bench: unknown data type " + value).c_str());
+}
+
+static void printUsage() {
+  std::cout << "Usage: libnd4j_bench [options]\n"
+               "  --op <name>              custom op to benchmark, i.e. matmul\n"
+               "  --legacy <type>:<num>    legacy op to benchmark, i.e. transform_strict:26 or reduce_same:0\n"
+               "  --inputs <n>             number of inputs created for each grid point, default 1\n"
+               "  --shapes <s1,s2,...>     shapes, dimensions separated with 'x', i.e. 1024x1024,64x3x224x224\n"
+               "  --dtypes <t1,t2,...>     data types, default float32\n"
+               "  --orders <o1,o2,...>     array orders, c and/or f, default c\n"
+               "  --axes <a1;a2;...>       axes, passed to op as trailing integer arguments, i.e. \"0;1;0,1\"\n"
+               "  --targs <v1,v2,...>      floating point arguments\n"
+               "  --iargs <v1,v2,...>      integer arguments\n"
+               "  --inplace                execute op in place\n"
+               "  --warmup <n>             untimed iterations, default 10\n"
+               "  --iterations <n>         timed iterations, default 100\n"
+               "  --threads <t1,t2,...>    thread counts to sweep over\n"
+               "  --format <json|csv>      output format, default json\n"
+               "  --output <file>          output file, default stdout\n";
+}
+
+static bool parseOptions(int argc, char **argv, RunnerOptions &options) {
+  for (int e = 1; e < argc; e++) {
+    std::string arg = argv[e];
+    if (arg == "--help" || arg == "-h") return false;
+
+    if (arg == "--inplace") {
+      options.inplace = true;
+      continue;
+    }
+
+    if (e + 1 >= argc) {
+      std::cerr << "libnd4j_bench: missing value for " << arg << "\n";
+      return false;
+    }
+
+    std::string value = argv[++e];
+    if (arg == "--op") {
+      options.op = value;
+    } else if (arg == "--legacy") {
+      options.legacy = value;
+    } else if (arg == "--inputs") {
+      options.inputs = std::stoi(value);
+    } else if (arg == "--shapes") {
+      options.grid.shapes.clear();
+      for (const auto &shape : split(value, ',')) options.grid.shapes.emplace_back(parseLongs(shape, 'x'));
+    } else if (arg == "--dtypes") {
+      options.grid.dataTypes.clear();
+      for (const auto &dtype : split(value, ',')) options.grid.dataTypes.emplace_back(parseDataType(dtype));
+    } else if (arg == "--orders") {
+      options.grid.orders.clear();
+      for (const auto &order : split(value, ',')) options.grid.orders.emplace_back(order[0]);
+    } else if (arg == "--axes") {
+      for (const auto &axis : split(value, ';')) options.grid.axes.emplace_back(parseLongs(axis, ','));
+    } else if (arg == "--targs") {
+      for (const auto &token : split(value, ',')) options.tArgs.emplace_back(std::stod(token));
+    } else if (arg == "--iargs") {
+      options.iArgs = parseLongs(value, ',');
+    } else if (arg == "--warmup") {
+      options.warmup = std::stoi(value);
+    } else if (arg == "--iterations") {
+      options.iterations = std::stoi(value);
+    } else if (arg == "--threads") {
+      for (auto t : parseLongs(value, ',')) options.threads.emplace_back(static_cast<int>(t));
+    } else if (arg == "--format") {
+      options.format = value;
+    } else if (arg == "--output") {
+      options.output = value;
+    } else {
+      std::cerr << "libnd4j_bench: unknown option " << arg << "\n";
+      return false;
+    }
+  }
+
+  return true;
+}
+
+static NDArray *syntheticArray(const BenchmarkPoint &point) {
+  auto shape = point.shape;
+  auto array = new NDArray(point.order, shape, point.dataType);
+
+  // values within (0.5, 1.5], so log/sqrt/division style ops stay on their regular paths
+  if (DataTypeUtils::isR(point.dataType)) {
+    array->linspace(0.5, 1.0 / sd::math::sd_max<LongType>(1, array->lengthOf()));
+  } else {
+    int one = 1;
+    array->assign(one);
+  }
+
+  return array;
+}
+
+/**
+ * Builds generator which creates given number of synthetic inputs per grid point. Axes are passed as trailing
+ * integer arguments, that's what both custom and legacy reductions expect
+ */
+static BenchmarkGenerator inputsGenerator(ops::DeclarableOp *op, const std::string &name, int numInputs,
+                                          const std::vector<double> &tArgs, const std::vector<LongType> &iArgs,
+                                          bool inplace, bool legacy) {
+  return [=](const BenchmarkPoint &point) -> OpBenchmark * {
+    std::vector<NDArray *> inputs;
+    for (int e = 0; e < numInputs; e++) inputs.emplace_back(syntheticArray(point));
+
+    auto args = iArgs;
+    args.insert(args.end(), point.axis.begin(), point.axis.end());
+
+    auto opInstance = legacy ? static_cast<ops::LegacyOp *>(op)->clone() : op;
+    auto benchmark = new DeclarableBenchmark(opInstance, name, inputs, {}, tArgs, args, {}, {}, inplace);
+    if (legacy) benchmark->takeOwnership();
+
+    return benchmark;
+  };
+}
+
+static std::vector<BenchmarkResult> runDefaultSuite(BenchmarkHelper &helper, const RunnerOptions &options) {
+  std::vector<BenchmarkResult> results;
+  auto append = [&](const std::vector<BenchmarkResult> &partial) {
+    results.insert(results.end(), partial.begin(), partial.end());
+  };
+
+  BenchmarkGrid elementwise;
+  elementwise.shapes = {{1 << 10}, {1 << 16}, {1 << 20}, {1 << 24}};
+  elementwise.dataTypes = options.grid.dataTypes;
+
+  std::unique_ptr<ops::DeclarableOp> sigmoid(DeclarableBenchmark::legacyOp("transform_strict", transform::Sigmoid));
+  append(helper.run(elementwise, inputsGenerator(sigmoid.get(), "sigmoid", 1, {}, {}, false, true)));
+
+  std::unique_ptr<ops::DeclarableOp> scalarAdd(DeclarableBenchmark::legacyOp("scalar", scalar::Add));
+  append(helper.run(elementwise, inputsGenerator(scalarAdd.get(), "scalar_add", 1, {3.14159265359}, {}, false, true)));
+
+  std::unique_ptr<ops::DeclarableOp> pairwiseAdd(DeclarableBenchmark::legacyOp("pairwise", pairwise::Add));
+  append(helper.run(elementwise, inputsGenerator(pairwiseAdd.get(), "pairwise_add", 2, {}, {}, false, true)));
+
+  BenchmarkGrid reductions;
+  reductions.shapes = {{1024, 1024}, {32, 128, 128}};
+  reductions.dataTypes = options.grid.dataTypes;
+  reductions.orders = {'c', 'f'};
+  reductions.axes = {{0}, {1}};
+
+  std::unique_ptr<ops::DeclarableOp> sum(DeclarableBenchmark::legacyOp("reduce_same", reduce::Sum));
+  append(helper.run(reductions, inputsGenerator(sum.get(), "reduce_sum", 1, {}, {}, false, true)));
+
+  auto softmax = ops::OpRegistrator::getInstance().getOperation("softmax");
+  BenchmarkGrid rows;
+  rows.shapes = {{1024, 1024}, {64, 32768}};
+  rows.dataTypes = options.grid.dataTypes;
+  append(helper.run(rows, inputsGenerator(softmax, "softmax", 1, {}, {}, false, false)));
+
+  auto matmul = ops::OpRegistrator::getInstance().getOperation("matmul");
+  BenchmarkGrid squares;
+  squares.shapes = {{128, 128}, {512, 512}, {1024, 1024}};
+  squares.dataTypes = options.grid.dataTypes;
+  squares.orders = {'c', 'f'};
+  auto matmulInputs = inputsGenerator(matmul, "matmul", 2, {}, {}, false, false);
+  append(helper.run(squares, [&](const BenchmarkPoint &point) -> OpBenchmark * {
+    auto benchmark = static_cast<DeclarableBenchmark *>(matmulInputs(point));
+    auto n = static_cast<double>(point.shape[0]);
+    benchmark->setFlops(2.0 * n * n * n);
+    return benchmark;
+  }));
+
+  return results;
+}
+
+int main(int argc, char **argv) {
+  RunnerOptions options;
+  if (!parseOptions(argc, argv, options)) {
+    printUsage();
+    return 1;
+  }
+
+  if (options.format != "json" && options.format != "csv") {
+    std::cerr << "libnd4j_bench: unknown format " << options.format << "\n";
+    return 1;
+  }
+
+  std::vector<BenchmarkResult> results;
+  try {
+    BenchmarkHelper helper(options.warmup, options.iterations, options.threads);
+
+    if (!options.op.empty() || !options.legacy.empty()) {
+      if (options.grid.shapes.empty()) {
+        std::cerr << "libnd4j_bench: --shapes is required\n";
+        return 1;
+      }
+
+      std::unique_ptr<ops::DeclarableOp> legacyOp;
+      ops::DeclarableOp *op = nullptr;
+      std::string name = options.op;
+      if (!options.legacy.empty()) {
+        auto parts = split(options.legacy, ':');
+        if (parts.size() != 2) {
+          std::cerr << "libnd4j_bench: legacy op should be specified as <type>:<num>\n";
+          return 1;
+        }
+
+        legacyOp.reset(DeclarableBenchmark::legacyOp(parts[0], std::stoi(parts[1])));
+        op = legacyOp.get();
+        name = options.legacy;
+      } else {
+        op = ops::OpRegistrator::getInstance().getOperation(options.op.c_str());
+      }
+
+      results = helper.run(options.grid, inputsGenerator(op, name, options.inputs, options.tArgs, options.iArgs,
+                                                         options.inplace, legacyOp != nullptr));
+    } else {
+      results = runDefaultSuite(helper, options);
+    }
+  } catch (std::exception &e) {
+    std::cerr << "libnd4j_bench: " << e.what() << "\n";
+    return 2;
+  }
+
+  auto report = options.format == "json" ? BenchmarkHelper::toJson(results) : BenchmarkHelper::toCsv(results);
+  if (options.output.empty()) {
+    std::cout << report;
+  } else {
+    std::ofstream file(options.output);
+    if (!file.good()) {
+      std::cerr << "libnd4j_bench: can't open " << options.output << "\n";
+      return 1;
+    }
+
+    file << report;
+  }
+
+  return 0;
+}
@@ -0,0 +1,158 @@
+/* ******************************************************************************
+ *
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ *  See the NOTICE file distributed with this work for additional
+ *  information regarding copyright ownership.
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ******************************************************************************/
+
+//
+// libnd4j_replay: times every distinct op call of a workload captured with exportOpTrace()
+//
+// Example:
+//   libnd4j_replay model.trace --iterations 50 --threads 1,8 --format csv --output model.csv
+//
+// Identical calls (same op, shapes and arguments) are timed once, number of occurrences in the trace is
+// reported as "calls" in the extra column.
+//
+#include <helpers/BenchmarkHelper.h>
+#include <helpers/DeclarableBenchmark.h>
+#include <ops/declarable/OpExecTraceFile.h>
+
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <sstream>
+
+using namespace sd;
+
+static void printUsage() {
+  std::cout << "Usage: libnd4j_replay <trace file> [options]\n"
+               "  --warmup <n>             untimed iterations per call, default 5\n"
+               "  --iterations <n>         timed iterations per call, default 20\n"
+               "  --threads <t1,t2,...>    thread counts to sweep over\n"
+               "  --format <json|csv>      output format, default json\n"
+               "  --output <file>          output file, default stdout\n";
+}
+
+int main(int argc, char **argv) {
+  if (argc < 2 || std::string(argv[1]) == "--help") {
+    printUsage();
+    return 1;
+  }
+
+  std::string path = argv[1];
+  std::string format = "json";
+  std::string output;
+  int warmup = 5;
+  int iterations = 20;
+  std::vector<int> threads;
+
+  for (int e = 2; e < argc; e++) {
+    std::string arg = argv[e];
+    if (e + 1 >= argc) {
+      printUsage();
+      return 1;
+    }
+
+    std::string value = argv[++e];
+    if (arg == "--warmup") {
+      warmup = std::stoi(value);
+    } else if (arg == "--iterations") {
+      iterations = std::stoi(value);
+    } else if (arg == "--threads") {
+      std::stringstream stream(value);
+      std::string token;
+      while (std::getline(stream, token, ','))
+        if (!token.empty()) threads.emplace_back(std::stoi(token));
+    } else if (arg == "--format") {
+      format = value;
+    } else if (arg == "--output") {
+      output = value;
+    } else {
+      printUsage();
+      return 1;
+    }
+  }
+
+  std::vector<ops::OpExecTrace *> traces;
+  try {
+    traces = ops::OpExecTraceFile::load(path);
+  } catch (std::exception &e) {
+    std::cerr << "libnd4j_replay: " << e.what() << "\n";
+    return 2;
+  }
+
+  // grouping identical calls, keyed by their serialized form, in order of first appearance
+  std::vector<std::string> order;
+  std::map<std::string, std::pair<ops::OpExecTrace *, int>> calls;
+  for (auto trace : traces) {
+    std::stringstream key;
+    ops::OpExecTraceFile::write(key, {trace});
+
+    auto it = calls.find(key.str());
+    if (it == calls.end()) {
+      order.emplace_back(key.str());
+      calls[key.str()] = {trace, 1};
+    } else {
+      it->second.second++;
+    }
+  }
+
+  BenchmarkHelper helper(warmup, iterations, threads);
+  std::vector<BenchmarkResult> results;
+  int skipped = 0;
+  int failed = 0;
+
+  for (const auto &key : order) {
+    auto trace = calls[key].first;
+    auto count = calls[key].second;
+
+    try {
+      std::unique_ptr<DeclarableBenchmark> benchmark(DeclarableBenchmark::fromTrace(*trace));
+      if (benchmark == nullptr) {
+        skipped++;
+        continue;
+      }
+
+      for (auto result : helper.run(*benchmark)) {
+        result.extra = "calls=" + std::to_string(count) + (result.extra == "N/A" ? "" : " " + result.extra);
+        results.emplace_back(result);
+      }
+    } catch (std::exception &e) {
+      std::cerr << "libnd4j_replay: " << *trace->opName << " failed: " << e.what() << "\n";
+      failed++;
+    }
+  }
+
+  std::cerr << "libnd4j_replay: " << traces.size() << " calls, " << order.size() << " distinct, " << skipped
+            << " skipped, " << failed << " failed\n";
+
+  ops::OpExecTraceFile::release(traces);
+
+  auto report = format == "csv" ? BenchmarkHelper::toCsv(results) : BenchmarkHelper::toJson(results);
+  if (output.empty()) {
+    std::cout << report;
+  } else {
+    std::ofstream file(output);
+    if (!file.good()) {
+      std::cerr << "libnd4j_replay: can't open " << output << "\n";
+      return 1;
+    }
+
+    file << report;
+  }
+
+  return failed > 0 ? 3 : 0;
+}
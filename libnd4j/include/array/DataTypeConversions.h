@@ -24,8 +24,10 @@
 #define LIBND4J_DATATYPECONVERSIONS_H
 
 #include <array/DataType.h>
+#include <array/DataTypeUtils.h>
 #include <execution/Threads.h>
 #include <helpers/BitwiseUtils.h>
+#include <helpers/BulkTypeCast.h>
 #include <helpers/logger.h>
 #include <loops/type_conversions.h>
 #include <system/common.h>
@@ -92,7 +94,7 @@ class SD_LIB_EXPORT DataTypeConversions {
       case FLOAT32: {
         if (std::is_same<T, float>::value && canKeep) {
           ops::safe_copy(buffer, static_cast<const float*>(src), static_cast<size_t>(length));
-        } else {
+        } else if (!canKeep || !BulkTypeCast::convert(src, FLOAT32, buffer, DataTypeUtils::fromT<T>(), length)) {
           auto tmp = new float[length];
           ops::safe_copy(tmp, static_cast<const float*>(src), static_cast<size_t>(length));
 
@@ -118,7 +120,7 @@ class SD_LIB_EXPORT DataTypeConversions {
       case DOUBLE: {
         if (std::is_same<T, double>::value && canKeep) {
           ops::safe_copy(buffer, static_cast<const double*>(src), static_cast<size_t>(length));
-        } else {
+        } else if (!canKeep || !BulkTypeCast::convert(src, DOUBLE, buffer, DataTypeUtils::fromT<T>(), length)) {
           auto tmp = new double[length];
           ops::safe_copy(tmp, static_cast<const double*>(src), static_cast<size_t>(length));
 
@@ -144,7 +146,7 @@ class SD_LIB_EXPORT DataTypeConversions {
       case HALF: {
         if (std::is_same<T, float16>::value && canKeep) {
           ops::safe_copy(buffer, static_cast<const float16*>(src), static_cast<size_t>(length));
-        } else {
+        } else if (!canKeep || !BulkTypeCast::convert(src, HALF, buffer, DataTypeUtils::fromT<T>(), length)) {
           auto tmp = new float16[length];
           ops::safe_copy(tmp, static_cast<const float16*>(src), static_cast<size_t>(length));
 
@@ -0,0 +1,85 @@
+/* ******************************************************************************
+ *
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ *  See the NOTICE file distributed with this work for additional
+ *  information regarding copyright ownership.
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ******************************************************************************/
+
+//
+// Layout request: lets consumer kernel describe memory layout it can work with,
+// so that copy of input array is made only if array doesn't satisfy that layout already
+//
+
+#ifndef LIBND4J_LAYOUTREQUEST_H
+#define LIBND4J_LAYOUTREQUEST_H
+#include <array/NDArray.h>
+#include <system/common.h>
+
+namespace sd {
+
+class SD_LIB_EXPORT LayoutRequest {
+ public:
+  enum Layout {
+    // any strides are fine, array is never copied
+    ANY_STRIDES = 0,
+    // at least one dimension has unit stride, i.e. BLAS-compatible matrix with leading dimension
+    UNIT_STRIDE = 1,
+    // dense block of memory, either in 'c' or in 'f' order
+    DENSE = 2,
+    C_ORDER = 3,
+    F_ORDER = 4,
+  };
+
+ private:
+  NDArray *_original = nullptr;
+  NDArray *_materialized = nullptr;
+  bool _writable = false;
+
+ public:
+  /**
+   * @param array - array consumer is going to work on
+   * @param layout - layout consumer accepts
+   * @param writable - if true, consumer is going to write into array, so copy (if any) is written back upon release
+   * @param order - order of copy for layouts that don't define it, 'a' means order of original array
+   */
+  LayoutRequest(NDArray *array, Layout layout, bool writable = false, char order = 'a');
+  ~LayoutRequest();
+
+  LayoutRequest(const LayoutRequest &other) = delete;
+  LayoutRequest &operator=(const LayoutRequest &other) = delete;
+
+  /**
+   * This method returns true if given array satisfies given layout as is
+   */
+  static bool satisfies(NDArray *array, Layout layout);
+
+  /**
+   * This method returns array consumer should work on: either original array, or its materialized copy
+   */
+  NDArray *array() const;
+
+  /**
+   * This method returns true if copy of original array had to be made
+   */
+  bool materialized() const;
+
+  /**
+   * This method writes copy back into original array if request is writable, and releases copy.
+   * Called from destructor, so explicit call is needed only if original array is read before request goes out of scope
+   */
+  void release();
+};
+}  // namespace sd
+
+#endif  // LIBND4J_LAYOUTREQUEST_H
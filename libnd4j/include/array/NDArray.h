@@ -649,6 +649,18 @@ class SD_LIB_EXPORT NDArray {
    */
   NDArray dup(const char newOrder = 'a', bool forceOriginalBuffer = false);
 
+  /**
+   *  returns true if elements of this array occupy dense block of memory in given order,
+   *  'a' means either 'c' or 'f' order is fine
+   */
+  bool isContiguous(const char order = 'a');
+
+  /**
+   *  returns view of this array if it's already contiguous in given order, and new copy otherwise
+   *  'a' means either 'c' or 'f' order is fine, copy keeps current order then
+   */
+  NDArray contiguous(const char order = 'a');
+
 
 
   /**
@@ -24,6 +24,7 @@
 #include <array/DataTypeUtils.h>
 #include <exceptions/allocation_exception.h>
 #include <execution/AffinityManager.h>
+#include <helpers/TimelineTracer.h>
 #include <helpers/logger.h>
 #include <memory/MemoryCounter.h>
 
@@ -395,6 +396,7 @@ void DataBuffer::allocatePrimary() {
 
 
 
+    TimelineSpan timelineSpan(TimelineCategory::MEMORY, "allocate", getLenInBytes());
     ALLOCATE(_primaryBuffer, _workspace, getLenInBytes(), int8_t);
     _isOwnerPrimary = true;
 
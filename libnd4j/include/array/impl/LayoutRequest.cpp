@@ -0,0 +1,82 @@
+/* ******************************************************************************
+ *
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ *  See the NOTICE file distributed with this work for additional
+ *  information regarding copyright ownership.
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ******************************************************************************/
+
+//
+// Layout request: lets consumer kernel describe memory layout it can work with
+//
+#include <array/LayoutRequest.h>
+
+namespace sd {
+LayoutRequest::LayoutRequest(NDArray *array, Layout layout, bool writable, char order) {
+  if (array == nullptr) THROW_EXCEPTION("LayoutRequest: array should not be nullptr");
+
+  _original = array;
+  _writable = writable;
+
+  if (satisfies(array, layout)) return;
+
+  if (layout == C_ORDER)
+    order = 'c';
+  else if (layout == F_ORDER)
+    order = 'f';
+
+  sd_debug("LayoutRequest: materializing array of length %lld in order [%c]\n", array->lengthOf(),
+           order == 'a' ? array->ordering() : order);
+  _materialized = new NDArray(array->dup(order));
+}
+
+LayoutRequest::~LayoutRequest() { release(); }
+
+bool LayoutRequest::satisfies(NDArray *array, Layout layout) {
+  if (array->isEmpty() || array->lengthOf() <= 1) return true;
+
+  switch (layout) {
+    case ANY_STRIDES:
+      return true;
+    case UNIT_STRIDE: {
+      for (int e = 0; e < array->rankOf(); e++)
+        if (array->sizeAt(e) == 1 || array->strideAt(e) == 1) return true;
+
+      return false;
+    }
+    case DENSE:
+      return array->isContiguous('a');
+    case C_ORDER:
+      return array->isContiguous('c');
+    case F_ORDER:
+      return array->isContiguous('f');
+    default:
+      THROW_EXCEPTION("LayoutRequest: unknown layout requested");
+  }
+
+  return false;
+}
+
+NDArray *LayoutRequest::array() const { return _materialized != nullptr ? _materialized : _original; }
+
+bool LayoutRequest::materialized() const { return _materialized != nullptr; }
+
+void LayoutRequest::release() {
+  if (_materialized == nullptr) return;
+
+  if (_writable) _original->assign(*_materialized);
+
+  delete _materialized;
+  _materialized = nullptr;
+}
+}  // namespace sd
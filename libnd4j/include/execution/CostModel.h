@@ -0,0 +1,134 @@
+/* ******************************************************************************
+ *
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ *  See the NOTICE file distributed with this work for additional
+ *  information regarding copyright ownership.
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ******************************************************************************/
+
+//
+// Roofline cost model used to pick number of threads per parallel call
+//
+#ifndef SAMEDIFF_COSTMODEL_H
+#define SAMEDIFF_COSTMODEL_H
+#include <system/common.h>
+
+#include <atomic>
+#include <string>
+
+namespace samediff {
+
+/**
+ * Cost classes of parallel loops, they differ by bytes moved and flops spent per loop iteration
+ */
+enum class OpCostClass {
+  // copies, assigns, simple unary arithmetic: 8 bytes, 1 flop per element
+  ELEMENTWISE = 0,
+  // pairwise and broadcast arithmetic: 12 bytes, 1 flop per element
+  PAIRWISE = 1,
+  // exp, log, tanh and friends: 8 bytes, ~20 flops per element
+  TRANSCENDENTAL = 2,
+  // reductions: 4 bytes, 1 flop per element
+  REDUCTION = 3,
+};
+
+/**
+ * Machine parameters measured by calibration
+ */
+struct SD_LIB_EXPORT CostModelParams {
+  // threads available when calibration was done
+  int threads = 0;
+  // single thread and all threads streaming bandwidth, bytes per nanosecond
+  double bandwidthSingle = 0.0;
+  double bandwidthAll = 0.0;
+  // single thread FMA throughput, flops per nanosecond
+  double flopsPerNs = 0.0;
+  // overhead of single parallel call with 2 threads and with all threads, nanoseconds
+  double wakeupNs2 = 0.0;
+  double wakeupNsAll = 0.0;
+};
+
+/**
+ * This class predicts execution time of parallel loop as
+ *
+ *    wakeup(t) + n * max(bytes / bandwidth(t), flops / (flopsPerNs * t))
+ *
+ * where bandwidth(t) = min(t * bandwidthSingle, bandwidthAll), and picks number of threads with the lowest estimate.
+ *
+ * Until calibrate() or load() succeeds, ThreadsHelper keeps using its static heuristics.
+ */
+class SD_LIB_EXPORT CostModel {
+ private:
+  static std::atomic<bool> _calibrated;
+
+  std::atomic<int> _threads{0};
+  std::atomic<double> _bandwidthSingle{0.0};
+  std::atomic<double> _bandwidthAll{0.0};
+  std::atomic<double> _flopsPerNs{0.0};
+  std::atomic<double> _wakeupNs2{0.0};
+  std::atomic<double> _wakeupNsAll{0.0};
+
+  // Environment::elementwiseThreshold as it was before calibration, restored by reset()
+  std::atomic<int> _savedElementwiseThreshold{0};
+
+  CostModel() = default;
+
+  double wakeupNs(int threads) const;
+
+ public:
+  static CostModel &getInstance();
+
+  static bool isCalibrated() { return _calibrated.load(std::memory_order_relaxed); }
+
+  /**
+   * This method runs microbenchmarks measuring memory bandwidth, FMA throughput and thread pool wakeup latency,
+   * takes about a second. Environment::elementwiseThreshold is updated to the break-even point of 2 threads
+   */
+  CostModelParams calibrate();
+
+  /**
+   * This method loads calibration from given file, and recalibrates and saves it there if file is missing, can't
+   * be parsed or was produced for different number of threads
+   */
+  CostModelParams calibrateOrLoad(const std::string &path);
+
+  void setParams(const CostModelParams &params);
+  CostModelParams params() const;
+
+  /**
+   * This method drops calibration, so ThreadsHelper goes back to static heuristics, and elementwise threshold goes
+   * back to the value it had before calibration
+   */
+  void reset();
+
+  void save(const std::string &path) const;
+  static bool load(const std::string &path, CostModelParams &params);
+
+  /**
+   * Estimated time of loop over numberOfElements iterations of given class, using given number of threads
+   */
+  double estimateNs(OpCostClass costClass, int threads, uint64_t numberOfElements) const;
+
+  /**
+   * Number of threads within [1, maxThreads] with the lowest estimated time. Extra threads must win at least 5%
+   */
+  int numberOfThreads(OpCostClass costClass, int maxThreads, uint64_t numberOfElements) const;
+
+  /**
+   * Smallest number of iterations for which 2 threads are estimated to be faster than 1
+   */
+  uint64_t breakEvenElements(OpCostClass costClass) const;
+};
+}  // namespace samediff
+
+#endif  // SAMEDIFF_COSTMODEL_H
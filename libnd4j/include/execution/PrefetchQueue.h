@@ -0,0 +1,171 @@
+/* ******************************************************************************
+ *
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ *  See the NOTICE file distributed with this work for additional
+ *  information regarding copyright ownership.
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ******************************************************************************/
+
+//
+// Bounded, ordered prefetch ring of preallocated NDArray batches
+//
+
+#ifndef SAMEDIFF_PREFETCHQUEUE_H
+#define SAMEDIFF_PREFETCHQUEUE_H
+#include <array/NDArray.h>
+#include <system/common.h>
+
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace samediff {
+
+/**
+ * Single slot of PrefetchQueue: a fixed set of arrays allocated once, and refilled by producers over and over again
+ */
+class SD_LIB_EXPORT PrefetchBatch {
+ private:
+  std::vector<sd::NDArray *> _arrays;
+  sd::LongType _sequence = -1;
+
+  friend class PrefetchQueue;
+
+ public:
+  explicit PrefetchBatch(const std::vector<sd::LongType *> &shapeInfos, sd::LaunchContext *context);
+  ~PrefetchBatch();
+
+  PrefetchBatch(const PrefetchBatch &other) = delete;
+  PrefetchBatch &operator=(const PrefetchBatch &other) = delete;
+
+  /**
+   * This method returns array with specified index within this batch, i.e. features/labels/masks
+   */
+  sd::NDArray *at(int index) const;
+
+  int size() const;
+
+  /**
+   * This method returns sequential number of this batch, as it was handed out to producer
+   */
+  sd::LongType sequence() const;
+};
+
+/**
+ * Producer callback: fills given batch in place for given sequence number.
+ * Returns false if there's no data for this sequence number, i.e. source is exhausted.
+ */
+typedef std::function<bool(sd::LongType, PrefetchBatch &)> PrefetchProducer;
+
+/**
+ * This class implements bounded ring of preallocated batches, filled by producer threads while consumer works on
+ * previously filled batch. Batches are handed out to consumer in sequence order, regardless of number of producers,
+ * and no copies are made during handoff: consumer gets the very arrays producer wrote into.
+ *
+ * Producers block once all slots are in use (back-pressure), consumer blocks until next batch in sequence is ready.
+ */
+class SD_LIB_EXPORT PrefetchQueue {
+ private:
+  enum SlotState { SLOT_FREE = 0, SLOT_FILLING = 1, SLOT_READY = 2, SLOT_CONSUMING = 3 };
+
+  std::vector<PrefetchBatch *> _slots;
+  std::vector<SlotState> _states;
+
+  std::mutex _lock;
+  std::condition_variable _writable;
+  std::condition_variable _readable;
+
+  // next sequence number to be handed to producer, and next one expected by consumer
+  sd::LongType _nextWrite = 0;
+  sd::LongType _nextRead = 0;
+
+  // first sequence number producers reported as missing, -1 if source isn't exhausted yet
+  sd::LongType _end = -1;
+
+  bool _closed = false;
+
+  // exception thrown by producer, and sequence number of batch it failed on (the lowest one, if several failed)
+  std::exception_ptr _error;
+  sd::LongType _errorSequence = -1;
+
+  std::vector<std::thread> _producers;
+
+  PrefetchBatch *slotFor(sd::LongType sequence);
+  bool exhausted();
+  void produceLoop(PrefetchProducer producer);
+
+ public:
+  /**
+   * @param shapeInfos - shapes of arrays forming a single batch
+   * @param capacity - number of batches allocated in this ring
+   */
+  PrefetchQueue(const std::vector<sd::LongType *> &shapeInfos, int capacity,
+                sd::LaunchContext *context = sd::LaunchContext::defaultContext());
+  ~PrefetchQueue();
+
+  PrefetchQueue(const PrefetchQueue &other) = delete;
+  PrefetchQueue &operator=(const PrefetchQueue &other) = delete;
+
+  int capacity() const;
+
+  /**
+   * This method spawns given number of producer threads, each one calling producer function until source is
+   * exhausted or queue is closed
+   */
+  void start(int numProducers, PrefetchProducer producer);
+
+  /**
+   * Producer side: blocks until slot for next sequence number becomes free.
+   * Returns nullptr if queue was closed or source is exhausted
+   */
+  PrefetchBatch *acquireWritable();
+
+  /**
+   * Producer side: marks batch as filled, and makes it visible for consumer
+   */
+  void publish(PrefetchBatch *batch);
+
+  /**
+   * Producer side: reports that there's no data for this batch sequence number, and for all subsequent ones
+   */
+  void finish(PrefetchBatch *batch);
+
+  /**
+   * Consumer side: blocks until next batch in sequence is ready.
+   * Returns nullptr once source is exhausted or queue is closed. If producer failed, batches preceding the failed
+   * one are still returned in order, and exception is rethrown once consumer reaches the failed sequence number
+   */
+  PrefetchBatch *next();
+
+  /**
+   * Consumer side: returns batch back to the ring, so producers could refill it
+   */
+  void release(PrefetchBatch *batch);
+
+  /**
+   * This method wakes up all waiters, and makes producers stop as soon as they're done with current batch
+   */
+  void close();
+
+  /**
+   * This method blocks until all producer threads spawned via start() are finished
+   */
+  void join();
+};
+}  // namespace samediff
+
+#endif  // SAMEDIFF_PREFETCHQUEUE_H
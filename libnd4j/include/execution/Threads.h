@@ -21,6 +21,7 @@
 //
 #ifndef SAMEDIFF_THREADS_H
 #define SAMEDIFF_THREADS_H
+#include <execution/CostModel.h>
 #include <system/Environment.h>
 #include <system/common.h>
 #include <system/op_boilerplate.h>
@@ -32,6 +33,18 @@ namespace samediff {
 class SD_LIB_EXPORT ThreadsHelper {
  public:
   static int numberOfThreads(int maxThreads, uint64_t numberOfElements);
+
+  /**
+   * Once CostModel is calibrated, number of threads is picked by its estimate for given cost class
+   */
+  static int numberOfThreads(int maxThreads, uint64_t numberOfElements, OpCostClass costClass);
+
+  /**
+   * Number of threads for loop over numberOfTads TADs, numberOfElements in total. Without calibration it's
+   * min(maxThreads, numberOfTads), as parallel_tad always did
+   */
+  static int numberOfThreadsTad(int maxThreads, uint64_t numberOfTads, uint64_t numberOfElements,
+                                OpCostClass costClass);
   static int numberOfThreads2d(int maxThreads, uint64_t iters_x, uint64_t iters_y);
   static int numberOfThreads3d(int maxThreads, uint64_t iters_x, uint64_t iters_y, uint64_t iters_z);
   static int pickLoop2d(int numThreads, uint64_t iters_x, uint64_t iters_y);
@@ -125,6 +138,12 @@ class SD_LIB_EXPORT Threads {
   static int parallel_for(FUNC_1D function, long long int start, long long int stop, long long int increment = 1,
                           long long int numThreads = sd::Environment::getInstance().maxMasterThreads());
 
+  /**
+   * Same as above, but number of threads is picked for loop iterations of given cost class
+   */
+  static int parallel_for(FUNC_1D function, long long int start, long long int stop, long long int increment,
+                          long long int numThreads, OpCostClass costClass);
+
   /**
    * This function executes 1 dimensional loop for a given number of threads
    *
@@ -20,6 +20,7 @@
 // @author raver119@gmail.com
 //
 #include <execution/CallableInterface.h>
+#include <helpers/TimelineTracer.h>
 #include <helpers/logger.h>
 
 namespace samediff {
@@ -185,6 +186,8 @@ void CallableInterface::execute() {
   // mark it as consumed
   _filled = false;
 
+  sd::TimelineSpan timelineSpan(sd::TimelineCategory::THREADS, "parallel_chunk", _thread_id);
+
   // actually executing op
   switch (_branch) {
     case 0:
@@ -0,0 +1,314 @@
+/* ******************************************************************************
+ *
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ *  See the NOTICE file distributed with this work for additional
+ *  information regarding copyright ownership.
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ******************************************************************************/
+
+//
+// Roofline cost model used to pick number of threads per parallel call
+//
+#include <execution/CostModel.h>
+#include <execution/Threads.h>
+#include <helpers/logger.h>
+#include <math/templatemath.h>
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <limits>
+#include <memory>
+#include <sstream>
+#include <vector>
+
+namespace samediff {
+
+std::atomic<bool> CostModel::_calibrated(false);
+
+CostModel &CostModel::getInstance() {
+  static CostModel instance;
+  return instance;
+}
+
+static void costOf(OpCostClass costClass, double &bytes, double &flops) {
+  switch (costClass) {
+    case OpCostClass::PAIRWISE:
+      bytes = 12.0;
+      flops = 1.0;
+      break;
+    case OpCostClass::TRANSCENDENTAL:
+      bytes = 8.0;
+      flops = 20.0;
+      break;
+    case OpCostClass::REDUCTION:
+      bytes = 4.0;
+      flops = 1.0;
+      break;
+    case OpCostClass::ELEMENTWISE:
+    default:
+      bytes = 8.0;
+      flops = 1.0;
+      break;
+  }
+}
+
+double CostModel::wakeupNs(int threads) const {
+  if (threads <= 1) return 0.0;
+
+  auto calibrated = _threads.load(std::memory_order_relaxed);
+  auto w2 = _wakeupNs2.load(std::memory_order_relaxed);
+  auto wAll = _wakeupNsAll.load(std::memory_order_relaxed);
+  if (calibrated <= 2) return w2 * threads / 2.0;
+
+  // linear between 2 threads and all threads, extrapolated beyond
+  return w2 + (wAll - w2) * (threads - 2) / static_cast<double>(calibrated - 2);
+}
+
+double CostModel::estimateNs(OpCostClass costClass, int threads, uint64_t numberOfElements) const {
+  double bytes, flops;
+  costOf(costClass, bytes, flops);
+
+  threads = sd::math::sd_max<int>(1, threads);
+  auto bandwidth = sd::math::sd_min<double>(threads * _bandwidthSingle.load(std::memory_order_relaxed),
+                                            _bandwidthAll.load(std::memory_order_relaxed));
+  auto compute = threads * _flopsPerNs.load(std::memory_order_relaxed);
+
+  auto n = static_cast<double>(numberOfElements);
+  return wakeupNs(threads) + sd::math::sd_max<double>(n * bytes / bandwidth, n * flops / compute);
+}
+
+int CostModel::numberOfThreads(OpCostClass costClass, int maxThreads, uint64_t numberOfElements) const {
+  maxThreads = static_cast<int>(sd::math::sd_min<uint64_t>(maxThreads, numberOfElements));
+  if (maxThreads <= 1) return 1;
+
+  int best = 1;
+  auto bestTime = estimateNs(costClass, 1, numberOfElements);
+
+  // powers of two and maxThreads itself are good enough, estimate is smooth in between
+  for (int t = 2;; t *= 2) {
+    t = sd::math::sd_min<int>(t, maxThreads);
+    auto time = estimateNs(costClass, t, numberOfElements);
+    if (time < bestTime * 0.95) {
+      best = t;
+      bestTime = time;
+    }
+
+    if (t >= maxThreads) break;
+  }
+
+  return best;
+}
+
+uint64_t CostModel::breakEvenElements(OpCostClass costClass) const {
+  uint64_t lo = 1, hi = 1ULL << 40;
+  while (lo < hi) {
+    auto middle = lo + (hi - lo) / 2;
+    if (estimateNs(costClass, 2, middle) < estimateNs(costClass, 1, middle) * 0.95)
+      hi = middle;
+    else
+      lo = middle + 1;
+  }
+
+  return lo;
+}
+
+void CostModel::setParams(const CostModelParams &params) {
+  if (params.threads < 1 || params.bandwidthSingle <= 0.0 || params.bandwidthAll <= 0.0 || params.flopsPerNs <= 0.0 ||
+      params.wakeupNs2 < 0.0 || params.wakeupNsAll < 0.0)
+    THROW_EXCEPTION("CostModel: calibration parameters should be positive");
+
+  _threads.store(params.threads);
+  _bandwidthSingle.store(params.bandwidthSingle);
+  _bandwidthAll.store(params.bandwidthAll);
+  _flopsPerNs.store(params.flopsPerNs);
+  _wakeupNs2.store(params.wakeupNs2);
+  _wakeupNsAll.store(params.wakeupNsAll);
+  if (!_calibrated.exchange(true))
+    _savedElementwiseThreshold.store(sd::Environment::getInstance().elementwiseThreshold());
+
+  auto threshold = sd::math::sd_min<uint64_t>(breakEvenElements(OpCostClass::ELEMENTWISE),
+                                              std::numeric_limits<int>::max());
+  sd::Environment::getInstance().setElementwiseThreshold(static_cast<int>(threshold));
+}
+
+CostModelParams CostModel::params() const {
+  CostModelParams result;
+  result.threads = _threads.load();
+  result.bandwidthSingle = _bandwidthSingle.load();
+  result.bandwidthAll = _bandwidthAll.load();
+  result.flopsPerNs = _flopsPerNs.load();
+  result.wakeupNs2 = _wakeupNs2.load();
+  result.wakeupNsAll = _wakeupNsAll.load();
+  return result;
+}
+
+void CostModel::reset() {
+  if (_calibrated.exchange(false))
+    sd::Environment::getInstance().setElementwiseThreshold(_savedElementwiseThreshold.load());
+}
+
+////////////////////////////////////////////////////////////////////////
+template <typename F>
+static double bestOf(int runs, F function) {
+  double best = std::numeric_limits<double>::max();
+  for (int e = 0; e < runs; e++) {
+    auto start = std::chrono::steady_clock::now();
+    function();
+    auto end = std::chrono::steady_clock::now();
+    best = sd::math::sd_min<double>(best, std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count());
+  }
+
+  return sd::math::sd_max<double>(best, 1.0);
+}
+
+static double medianWakeup(int threads, int runs) {
+  std::vector<double> times;
+  auto empty = PRAGMA_THREADS_FOR{
+      // nothing to do here, we measure dispatch only
+  };
+
+  for (int e = 0; e < runs; e++) {
+    auto start = std::chrono::steady_clock::now();
+    Threads::parallel_tad(empty, 0, threads, 1, threads);
+    auto end = std::chrono::steady_clock::now();
+    times.emplace_back(std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count());
+  }
+
+  std::sort(times.begin(), times.end());
+  return times[times.size() / 2];
+}
+
+CostModelParams CostModel::calibrate() {
+  CostModelParams result;
+  result.threads = sd::math::sd_max<int>(1, sd::Environment::getInstance().maxMasterThreads());
+
+  // buffers are well above last level cache, so we measure DRAM bandwidth
+  const sd::LongType length = 16 * 1024 * 1024;
+  std::unique_ptr<float[]> source(new float[length]);
+  std::unique_ptr<float[]> target(new float[length]);
+  auto src = source.get();
+  auto dst = target.get();
+  for (sd::LongType e = 0; e < length; e++) src[e] = static_cast<float>(e % 1024);
+
+  auto copyRange = [src, dst](sd::LongType start, sd::LongType stop) {
+    for (auto e = start; e < stop; e++) dst[e] = src[e] * 1.0001f;
+  };
+
+  auto bytes = static_cast<double>(length) * 2 * sizeof(float);
+  result.bandwidthSingle = bytes / bestOf(3, [&]() { copyRange(0, length); });
+
+  auto parallelCopy = PRAGMA_THREADS_FOR { copyRange(start, stop); };
+  result.bandwidthAll =
+      bytes / bestOf(3, [&]() { Threads::parallel_tad(parallelCopy, 0, length, 1, result.threads); });
+  result.bandwidthAll = sd::math::sd_max<double>(result.bandwidthAll, result.bandwidthSingle);
+
+  // 8 independent FMA chains, so latency doesn't hide throughput
+  const int iterations = 16 * 1024 * 1024;
+  float accumulators[8] = {1.f, 2.f, 3.f, 4.f, 5.f, 6.f, 7.f, 8.f};
+  auto fma = [&]() {
+    for (int e = 0; e < iterations; e++)
+      for (int a = 0; a < 8; a++) accumulators[a] = accumulators[a] * 0.999999f + 0.000001f;
+  };
+  result.flopsPerNs = 2.0 * 8 * iterations / bestOf(3, fma);
+
+  volatile float sink = accumulators[0] + accumulators[7] + dst[length - 1];
+  (void)sink;
+
+  result.wakeupNs2 = result.threads > 1 ? medianWakeup(2, 201) : 0.0;
+  result.wakeupNsAll = result.threads > 1 ? medianWakeup(result.threads, 201) : 0.0;
+
+  sd_debug("CostModel: bandwidth %f/%f bytes/ns, %f flops/ns, wakeup %f/%f ns\n", result.bandwidthSingle,
+           result.bandwidthAll, result.flopsPerNs, result.wakeupNs2, result.wakeupNsAll);
+
+  setParams(result);
+  return result;
+}
+
+CostModelParams CostModel::calibrateOrLoad(const std::string &path) {
+  CostModelParams loaded;
+  if (load(path, loaded) && loaded.threads == sd::Environment::getInstance().maxMasterThreads()) {
+    setParams(loaded);
+    return loaded;
+  }
+
+  auto result = calibrate();
+  save(path);
+  return result;
+}
+
+////////////////////////////////////////////////////////////////////////
+static const char *COST_MODEL_HEADER = "# libnd4j cost model v1";
+
+void CostModel::save(const std::string &path) const {
+  std::ofstream stream(path);
+  if (!stream.good()) {
+    std::string errorMessage;
+    errorMessage += "CostModel: can't open file for writing: ";
+    errorMessage += path;
+    THROW_EXCEPTION(errorMessage.c_str());
+  }
+
+  auto p = params();
+  stream.precision(17);
+  stream << COST_MODEL_HEADER << "\n"
+         << "threads " << p.threads << "\n"
+         << "bandwidth_single " << p.bandwidthSingle << "\n"
+         << "bandwidth_all " << p.bandwidthAll << "\n"
+         << "flops_per_ns " << p.flopsPerNs << "\n"
+         << "wakeup_ns_2 " << p.wakeupNs2 << "\n"
+         << "wakeup_ns_all " << p.wakeupNsAll << "\n";
+}
+
+bool CostModel::load(const std::string &path, CostModelParams &params) {
+  std::ifstream stream(path);
+  if (!stream.good()) return false;
+
+  std::string line;
+  if (!std::getline(stream, line) || line != COST_MODEL_HEADER) return false;
+
+  CostModelParams result;
+  int found = 0;
+  while (std::getline(stream, line)) {
+    std::stringstream tokens(line);
+    std::string key;
+    double value;
+    if (!(tokens >> key >> value)) continue;
+
+    if (key == "threads") {
+      result.threads = static_cast<int>(value);
+    } else if (key == "bandwidth_single") {
+      result.bandwidthSingle = value;
+    } else if (key == "bandwidth_all") {
+      result.bandwidthAll = value;
+    } else if (key == "flops_per_ns") {
+      result.flopsPerNs = value;
+    } else if (key == "wakeup_ns_2") {
+      result.wakeupNs2 = value;
+    } else if (key == "wakeup_ns_all") {
+      result.wakeupNsAll = value;
+    } else {
+      continue;
+    }
+
+    found++;
+  }
+
+  if (found < 6 || result.threads < 1 || result.bandwidthSingle <= 0.0 || result.bandwidthAll <= 0.0 ||
+      result.flopsPerNs <= 0.0)
+    return false;
+
+  params = result;
+  return true;
+}
+}  // namespace samediff
@@ -0,0 +1,192 @@
+/* ******************************************************************************
+ *
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ *  See the NOTICE file distributed with this work for additional
+ *  information regarding copyright ownership.
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ******************************************************************************/
+
+//
+// Bounded, ordered prefetch ring of preallocated NDArray batches
+//
+#include <execution/PrefetchQueue.h>
+#include <helpers/logger.h>
+
+namespace samediff {
+PrefetchBatch::PrefetchBatch(const std::vector<sd::LongType *> &shapeInfos, sd::LaunchContext *context) {
+  _arrays.reserve(shapeInfos.size());
+  for (auto shapeInfo : shapeInfos) _arrays.emplace_back(new sd::NDArray(shapeInfo, false, context, false));
+}
+
+PrefetchBatch::~PrefetchBatch() {
+  for (auto array : _arrays) delete array;
+}
+
+sd::NDArray *PrefetchBatch::at(int index) const {
+  if (index < 0 || index >= static_cast<int>(_arrays.size()))
+    THROW_EXCEPTION("PrefetchBatch::at - index is out of bounds");
+
+  return _arrays[index];
+}
+
+int PrefetchBatch::size() const { return static_cast<int>(_arrays.size()); }
+
+sd::LongType PrefetchBatch::sequence() const { return _sequence; }
+
+PrefetchQueue::PrefetchQueue(const std::vector<sd::LongType *> &shapeInfos, int capacity,
+                             sd::LaunchContext *context) {
+  if (capacity < 1) THROW_EXCEPTION("PrefetchQueue: capacity should be positive");
+
+  if (shapeInfos.empty()) THROW_EXCEPTION("PrefetchQueue: batch should contain at least one array");
+
+  _slots.resize(capacity);
+  _states.resize(capacity, SLOT_FREE);
+  for (int e = 0; e < capacity; e++) _slots[e] = new PrefetchBatch(shapeInfos, context);
+}
+
+PrefetchQueue::~PrefetchQueue() {
+  close();
+  join();
+
+  for (auto slot : _slots) delete slot;
+}
+
+int PrefetchQueue::capacity() const { return static_cast<int>(_slots.size()); }
+
+PrefetchBatch *PrefetchQueue::slotFor(sd::LongType sequence) { return _slots[sequence % _slots.size()]; }
+
+bool PrefetchQueue::exhausted() { return _closed || _error != nullptr || (_end >= 0 && _nextWrite >= _end); }
+
+void PrefetchQueue::start(int numProducers, PrefetchProducer producer) {
+  if (numProducers < 1) THROW_EXCEPTION("PrefetchQueue::start - number of producers should be positive");
+
+  if (!_producers.empty()) THROW_EXCEPTION("PrefetchQueue::start - producers were started already");
+
+  for (int e = 0; e < numProducers; e++) _producers.emplace_back(&PrefetchQueue::produceLoop, this, producer);
+}
+
+void PrefetchQueue::produceLoop(PrefetchProducer producer) {
+  while (auto batch = acquireWritable()) {
+    bool filled = false;
+    try {
+      filled = producer(batch->sequence(), *batch);
+    } catch (...) {
+      sd_debug("PrefetchQueue: producer failed at batch %lld\n", batch->sequence());
+      {
+        std::unique_lock<std::mutex> lock(_lock);
+        // queue isn't closed here: batches already taken by other producers are still published and delivered
+        if (_error == nullptr || batch->_sequence < _errorSequence) {
+          _error = std::current_exception();
+          _errorSequence = batch->_sequence;
+        }
+      }
+
+      _writable.notify_all();
+      _readable.notify_all();
+      return;
+    }
+
+    if (filled)
+      publish(batch);
+    else
+      finish(batch);
+  }
+}
+
+PrefetchBatch *PrefetchQueue::acquireWritable() {
+  std::unique_lock<std::mutex> lock(_lock);
+
+  // back-pressure: we're not going further than capacity batches ahead of consumer
+  _writable.wait(lock, [&] { return exhausted() || _states[_nextWrite % _slots.size()] == SLOT_FREE; });
+
+  if (exhausted()) return nullptr;
+
+  auto sequence = _nextWrite++;
+  auto batch = slotFor(sequence);
+  _states[sequence % _slots.size()] = SLOT_FILLING;
+  batch->_sequence = sequence;
+
+  return batch;
+}
+
+void PrefetchQueue::publish(PrefetchBatch *batch) {
+  {
+    std::unique_lock<std::mutex> lock(_lock);
+    _states[batch->_sequence % _slots.size()] = SLOT_READY;
+  }
+
+  _readable.notify_all();
+}
+
+void PrefetchQueue::finish(PrefetchBatch *batch) {
+  {
+    std::unique_lock<std::mutex> lock(_lock);
+    if (_end < 0 || batch->_sequence < _end) _end = batch->_sequence;
+
+    _states[batch->_sequence % _slots.size()] = SLOT_FREE;
+  }
+
+  _writable.notify_all();
+  _readable.notify_all();
+}
+
+PrefetchBatch *PrefetchQueue::next() {
+  std::unique_lock<std::mutex> lock(_lock);
+
+  auto index = _nextRead % _slots.size();
+  auto ready = [&] { return _states[index] == SLOT_READY && _slots[index]->_sequence == _nextRead; };
+  auto failed = [&] { return _error != nullptr && _nextRead >= _errorSequence; };
+  auto ended = [&] { return _closed || (_end >= 0 && _nextRead >= _end); };
+  _readable.wait(lock, [&] { return ended() || failed() || ready(); });
+
+  if (_closed) return nullptr;
+
+  // batches published before producer failure are delivered first
+  if (!ready()) {
+    if (failed()) std::rethrow_exception(_error);
+
+    return nullptr;
+  }
+
+  _states[index] = SLOT_CONSUMING;
+  _nextRead++;
+
+  return _slots[index];
+}
+
+void PrefetchQueue::release(PrefetchBatch *batch) {
+  {
+    std::unique_lock<std::mutex> lock(_lock);
+    _states[batch->_sequence % _slots.size()] = SLOT_FREE;
+  }
+
+  _writable.notify_all();
+}
+
+void PrefetchQueue::close() {
+  {
+    std::unique_lock<std::mutex> lock(_lock);
+    _closed = true;
+  }
+
+  _writable.notify_all();
+  _readable.notify_all();
+}
+
+void PrefetchQueue::join() {
+  for (auto &producer : _producers)
+    if (producer.joinable()) producer.join();
+
+  _producers.clear();
+}
+}  // namespace samediff
@@ -37,6 +37,13 @@
 namespace samediff {
 
 int ThreadsHelper::numberOfThreads(int maxThreads, uint64_t numberOfElements) {
+  return numberOfThreads(maxThreads, numberOfElements, OpCostClass::ELEMENTWISE);
+}
+
+int ThreadsHelper::numberOfThreads(int maxThreads, uint64_t numberOfElements, OpCostClass costClass) {
+  if (CostModel::isCalibrated())
+    return CostModel::getInstance().numberOfThreads(costClass, maxThreads, numberOfElements);
+
   // let's see how many threads we actually need first
   auto optimalThreads = sd::math::sd_max<uint64_t>(1, numberOfElements / 1024);
 
@@ -44,6 +51,14 @@ int ThreadsHelper::numberOfThreads(int maxThreads, uint64_t numberOfElements) {
   return sd::math::sd_min<int>(optimalThreads, maxThreads);
 }
 
+int ThreadsHelper::numberOfThreadsTad(int maxThreads, uint64_t numberOfTads, uint64_t numberOfElements,
+                                      OpCostClass costClass) {
+  maxThreads = static_cast<int>(sd::math::sd_min<uint64_t>(maxThreads, numberOfTads));
+  if (maxThreads <= 1 || !CostModel::isCalibrated()) return sd::math::sd_max<int>(1, maxThreads);
+
+  return CostModel::getInstance().numberOfThreads(costClass, maxThreads, numberOfElements);
+}
+
 Span3::Span3(int64_t startX, int64_t stopX, int64_t incX, int64_t startY, int64_t stopY, int64_t incY, int64_t startZ, int64_t stopZ, int64_t incZ) {
   _startX = startX;
   _startY = startY;
@@ -455,6 +470,11 @@ int Threads::parallel_tad(FUNC_1D function, sd::LongType start, sd::LongType sto
 
 int Threads::parallel_for(FUNC_1D function, sd::LongType start, sd::LongType stop, sd::LongType increment,
                           sd::LongType numThreads) {
+  return parallel_for(function, start, stop, increment, numThreads, OpCostClass::ELEMENTWISE);
+}
+
+int Threads::parallel_for(FUNC_1D function, sd::LongType start, sd::LongType stop, sd::LongType increment,
+                          sd::LongType numThreads, OpCostClass costClass) {
   if (start > stop)
     THROW_EXCEPTION("Threads::parallel_for got start > stop");
 
@@ -469,7 +489,7 @@ int Threads::parallel_for(FUNC_1D function, sd::LongType start, sd::LongType sto
   auto numElements = delta / increment;
 
   // we decide what's optimal number of threads we need here, and execute it in parallel_tad.
-  numThreads = ThreadsHelper::numberOfThreads(numThreads, numElements);
+  numThreads = ThreadsHelper::numberOfThreads(numThreads, numElements, costClass);
   return parallel_tad(function, start, stop, increment, numThreads);
 }
 
@@ -273,6 +273,13 @@ class SD_LIB_EXPORT Context : public ContextPrototype {
    */
   void clearFastPath();
 
+  /**
+   * This method deletes removable handles, purges fastpath in/out, intermediate results, data types, I/T/B/D/S args and
+   * axis, drops inplace, shape function override and forbidden fast path flags, and resets execution mode. Allocated
+   * capacity is kept, so pooled contexts can be rebound without heap allocations
+   */
+  void reset();
+
   void setCudaContext(Pointer cudaStream, Pointer reductionPointer, Pointer allocationPointer);
 
   void allowHelpers(bool reallyAllow);
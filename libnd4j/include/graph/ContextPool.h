@@ -0,0 +1,91 @@
+/* ******************************************************************************
+ *
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ *  See the NOTICE file distributed with this work for additional
+ *  information regarding copyright ownership.
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ******************************************************************************/
+
+//
+// Pool of reusable graph contexts for prepared calls
+//
+
+#ifndef LIBND4J_CONTEXTPOOL_H
+#define LIBND4J_CONTEXTPOOL_H
+#include <graph/Context.h>
+#include <graph/PreparedCall.h>
+
+#include <atomic>
+#include <mutex>
+#include <vector>
+
+namespace sd {
+namespace graph {
+
+/**
+ * This class keeps idle Context instances, so prepared calls don't create and destroy contexts per request. Released
+ * contexts are reset but keep their vectors' capacity, so rebinding arguments of similar size doesn't allocate.
+ * Number of idle contexts is bounded, extra ones are deleted on release.
+ */
+class SD_LIB_EXPORT ContextPool {
+ private:
+  std::mutex _lock;
+  std::vector<Context *> _idle;
+  int _maxIdle = 64;
+
+  std::atomic<LongType> _created{0};
+  std::atomic<LongType> _reused{0};
+
+  ContextPool() = default;
+  ~ContextPool();
+
+ public:
+  static ContextPool &getInstance();
+
+  /**
+   * This method returns idle context, or creates new one
+   */
+  Context *acquire();
+
+  /**
+   * This method resets given context and keeps it for later acquire() calls
+   */
+  void release(Context *context);
+
+  /**
+   * This method binds op with given hash and arguments to pooled context. Throws if op is unknown
+   */
+  PreparedCall *prepare(LongType opHash, const LongType *iArgs, int numIArgs, const double *tArgs, int numTArgs,
+                        const bool *bArgs, int numBArgs, const DataType *dArgs, int numDArgs, bool inplace);
+
+  /**
+   * This method deletes prepared call and returns its context to the pool
+   */
+  void release(PreparedCall *call);
+
+  void setMaxIdle(int maxIdle);
+  int maxIdle();
+  int numIdle();
+
+  LongType created() const { return _created.load(); }
+  LongType reused() const { return _reused.load(); }
+
+  /**
+   * This method deletes all idle contexts and zeroes stats
+   */
+  void purge();
+};
+}  // namespace graph
+}  // namespace sd
+
+#endif  // LIBND4J_CONTEXTPOOL_H
@@ -70,7 +70,7 @@ class SD_LIB_EXPORT ContextPrototype {
 
  public:
   explicit ContextPrototype(ops::OpDescriptor* opDescriptor = nullptr, int nodeId = 1, bool inPlace = false);
-  ~ContextPrototype() = default;
+  virtual ~ContextPrototype() = default;
 
   int getNodeId();
   int nodeId();
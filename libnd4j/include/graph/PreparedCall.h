@@ -0,0 +1,78 @@
+/* ******************************************************************************
+ *
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ *  See the NOTICE file distributed with this work for additional
+ *  information regarding copyright ownership.
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ******************************************************************************/
+
+//
+// Custom op call with arguments bound once, executed many times
+//
+
+#ifndef LIBND4J_PREPAREDCALL_H
+#define LIBND4J_PREPAREDCALL_H
+#include <graph/Context.h>
+
+#include <vector>
+
+namespace sd {
+namespace ops {
+class DeclarableOp;
+}
+
+namespace graph {
+
+/**
+ * This class binds op, I/T/B/D arguments and, optionally, output shapes once. Every invocation then only swaps
+ * input and output arrays and executes, so hot path doesn't allocate or copy argument vectors.
+ *
+ * Instances are obtained from ContextPool::prepare() and must be returned with ContextPool::release(), their
+ * Context is reused by later prepared calls.
+ */
+class SD_LIB_EXPORT PreparedCall {
+ private:
+  ops::DeclarableOp *_op;
+  Context *_context;
+  // constant shapeInfos, empty until bindOutputShapes() is called
+  std::vector<LongType *> _outputShapes;
+
+ public:
+  PreparedCall(ops::DeclarableOp *op, Context *context);
+  ~PreparedCall() = default;
+
+  ops::DeclarableOp *op() const { return _op; }
+  Context *context() const { return _context; }
+
+  void setInput(int index, NDArray *array);
+  void setOutput(int index, NDArray *array);
+
+  /**
+   * This method runs shape function once for currently set inputs and keeps result. Later invocations check their
+   * outputs against these shapes instead of running shape function. Returns number of outputs
+   */
+  int bindOutputShapes();
+
+  int numOutputShapes() const { return static_cast<int>(_outputShapes.size()); }
+  const LongType *outputShape(int index) const;
+
+  /**
+   * This method executes op with current inputs and outputs. Returns Status::BAD_OUTPUT if output shapes were bound
+   * and current outputs don't match them
+   */
+  Status execute();
+};
+}  // namespace graph
+}  // namespace sd
+
+#endif  // LIBND4J_PREPAREDCALL_H
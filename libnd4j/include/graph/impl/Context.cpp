@@ -638,6 +638,28 @@ void Context::clearFastPath() {
   _handles.clear();
 }
 
+void Context::reset() {
+  for (auto v : _handles) delete v;
+
+  _handles.clear();
+  _fastpath_in.clear();
+  _fastpath_out.clear();
+  _intermediateResults.clear();
+  _dataTypes.clear();
+
+  _iArgs.clear();
+  _tArgs.clear();
+  _bArgs.clear();
+  _dArgs.clear();
+  _sArgs.clear();
+  _axis.clear();
+
+  _isInplace = false;
+  _shapeFunctionOverride = false;
+  _forbidFastPath = false;
+  _execMode = samediff::ExecutionMode::MODE_UNDEFINED;
+}
+
 void Context::setInputArrays(int numArrays,NDArray** array, bool removable) {
   for(int i = 0; i < numArrays; i++) {
     setInputArray(i,array[i],removable);
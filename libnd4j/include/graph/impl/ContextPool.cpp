@@ -0,0 +1,118 @@
+/* ******************************************************************************
+ *
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ *  See the NOTICE file distributed with this work for additional
+ *  information regarding copyright ownership.
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ******************************************************************************/
+
+//
+// Pool of reusable graph contexts for prepared calls
+//
+#include <graph/ContextPool.h>
+#include <ops/declarable/OpRegistrator.h>
+
+namespace sd {
+namespace graph {
+
+ContextPool &ContextPool::getInstance() {
+  static ContextPool instance;
+  return instance;
+}
+
+ContextPool::~ContextPool() {
+  for (auto context : _idle) delete context;
+}
+
+Context *ContextPool::acquire() {
+  {
+    std::lock_guard<std::mutex> lock(_lock);
+    if (!_idle.empty()) {
+      auto context = _idle.back();
+      _idle.pop_back();
+      _reused++;
+      return context;
+    }
+  }
+
+  _created++;
+  return new Context(1);
+}
+
+void ContextPool::release(Context *context) {
+  if (context == nullptr) return;
+
+  context->reset();
+
+  std::lock_guard<std::mutex> lock(_lock);
+  if (static_cast<int>(_idle.size()) < _maxIdle)
+    _idle.emplace_back(context);
+  else
+    delete context;
+}
+
+PreparedCall *ContextPool::prepare(LongType opHash, const LongType *iArgs, int numIArgs, const double *tArgs,
+                                   int numTArgs, const bool *bArgs, int numBArgs, const DataType *dArgs, int numDArgs,
+                                   bool inplace) {
+  auto op = ops::OpRegistrator::getInstance().getOperation(opHash);
+  if (op == nullptr) THROW_EXCEPTION("ContextPool: can't prepare call of unknown op");
+
+  auto context = acquire();
+  context->setIArguments(const_cast<LongType *>(iArgs), numIArgs);
+  context->setTArguments(const_cast<double *>(tArgs), numTArgs);
+  context->setBArguments(const_cast<bool *>(bArgs), numBArgs);
+  context->setDArguments(const_cast<DataType *>(dArgs), numDArgs);
+  context->markInplace(inplace);
+
+  return new PreparedCall(op, context);
+}
+
+void ContextPool::release(PreparedCall *call) {
+  if (call == nullptr) return;
+
+  auto context = call->context();
+  delete call;
+  release(context);
+}
+
+void ContextPool::setMaxIdle(int maxIdle) {
+  if (maxIdle < 0) THROW_EXCEPTION("ContextPool: max number of idle contexts can't be negative");
+
+  std::lock_guard<std::mutex> lock(_lock);
+  _maxIdle = maxIdle;
+  while (static_cast<int>(_idle.size()) > _maxIdle) {
+    delete _idle.back();
+    _idle.pop_back();
+  }
+}
+
+int ContextPool::maxIdle() {
+  std::lock_guard<std::mutex> lock(_lock);
+  return _maxIdle;
+}
+
+int ContextPool::numIdle() {
+  std::lock_guard<std::mutex> lock(_lock);
+  return static_cast<int>(_idle.size());
+}
+
+void ContextPool::purge() {
+  std::lock_guard<std::mutex> lock(_lock);
+  for (auto context : _idle) delete context;
+
+  _idle.clear();
+  _created.store(0);
+  _reused.store(0);
+}
+}  // namespace graph
+}  // namespace sd
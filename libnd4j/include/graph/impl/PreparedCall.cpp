@@ -0,0 +1,79 @@
+/* ******************************************************************************
+ *
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ *  See the NOTICE file distributed with this work for additional
+ *  information regarding copyright ownership.
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ******************************************************************************/
+
+//
+// Custom op call with arguments bound once, executed many times
+//
+#include <graph/PreparedCall.h>
+#include <helpers/ConstantShapeHelper.h>
+#include <ops/declarable/DeclarableOp.h>
+
+namespace sd {
+namespace graph {
+
+PreparedCall::PreparedCall(ops::DeclarableOp *op, Context *context) : _op(op), _context(context) {
+  if (op == nullptr || context == nullptr) THROW_EXCEPTION("PreparedCall: op and context can't be null");
+}
+
+void PreparedCall::setInput(int index, NDArray *array) { _context->setInputArray(index, array); }
+
+void PreparedCall::setOutput(int index, NDArray *array) { _context->setOutputArray(index, array); }
+
+int PreparedCall::bindOutputShapes() {
+  ShapeList inSha;
+  for (auto array : _context->fastpath_in()) {
+    if (array == nullptr) THROW_EXCEPTION("PreparedCall: all inputs must be set before binding output shapes");
+
+    inSha.push_back(array->shapeInfo());
+  }
+
+  auto outSha = _op->calculateOutputShape(&inSha, *_context);
+  _outputShapes.clear();
+  for (int e = 0; e < outSha->size(); e++)
+    _outputShapes.emplace_back(ConstantShapeHelper::getInstance().createFromExisting(outSha->at(e)));
+
+  delete outSha;
+
+  // outputs are validated against bound shapes, so shape function isn't needed anymore
+  _context->setShapeFunctionOverride(true);
+  return numOutputShapes();
+}
+
+const LongType *PreparedCall::outputShape(int index) const {
+  if (index < 0 || index >= numOutputShapes()) THROW_EXCEPTION("PreparedCall: output shape index is out of range");
+
+  return _outputShapes[index];
+}
+
+Status PreparedCall::execute() {
+  if (!_outputShapes.empty()) {
+    auto &outputs = _context->fastpath_out();
+    if (outputs.size() != _outputShapes.size()) return Status::BAD_OUTPUT;
+
+    for (size_t e = 0; e < outputs.size(); e++) {
+      auto output = outputs[e];
+      if (output == nullptr || output->dataType() != ArrayOptions::dataType(_outputShapes[e]) ||
+          !shape::equalsSoft(output->shapeInfo(), _outputShapes[e]))
+        return Status::BAD_OUTPUT;
+    }
+  }
+
+  return _op->execute(_context);
+}
+}  // namespace graph
+}  // namespace sd
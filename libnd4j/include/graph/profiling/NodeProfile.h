@@ -69,6 +69,11 @@ class SD_LIB_EXPORT NodeProfile {
   // total amount of memory used during execution
   LongType _memoryTotal = 0L;
 
+  // hardware counters sampled during op execution, zero if sampling is off
+  LongType _cycles = 0L;
+  LongType _instructions = 0L;
+  LongType _cacheMisses = 0L;
+
   std::vector<std::string> _inputShapes;
   std::vector<std::string> _outputShapes;
 
@@ -91,6 +96,8 @@ class SD_LIB_EXPORT NodeProfile {
   void setObjectsSize(LongType bytes);
   void setTotalSize(LongType bytes);
 
+  void setHardwareCounters(LongType cycles, LongType instructions, LongType cacheMisses);
+
   void addInputShape(LongType const* shapeInfo);
   void addOutputShape(LongType const* shapeInfo);
 
@@ -20,6 +20,7 @@
 //  @author raver119@gmail.com
 //
 #include <graph/profiling/GraphProfile.h>
+#include <helpers/HardwareCounters.h>
 #include <helpers/logger.h>
 #include <math/templatemath.h>
 
@@ -189,6 +190,9 @@ void GraphProfile::printOut() {
   if (_timings.empty()) sd_printf("No special timers were set\n", "");
 
   for (auto v : _timings) sd_printf("%s: %lld ns;\n", v.first.c_str(), v.second);
+
+  // aggregated per op and shape class, over all executions since last reset
+  HardwareCounters::getInstance().printOut();
 }
 }  // namespace graph
 }  // namespace sd
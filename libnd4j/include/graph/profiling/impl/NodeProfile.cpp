@@ -39,6 +39,9 @@ void NodeProfile::printOut() {
             _executionTime / _merges, _totalTime / _merges);
   sd_printf("      PREP: INPUT: %lld ns; SHAPE: %lld ns; ARRAY: %lld ns;\n", _inputTime / _merges, _shapeTime / _merges,
             _arrayTime / _merges);
+  if (_cycles > 0)
+    sd_printf("      Counters: CYCLES: %lld; INSTR: %lld; IPC: %.2f; LLC MISSES: %lld;\n", _cycles / _merges,
+              _instructions / _merges, static_cast<double>(_instructions) / _cycles, _cacheMisses / _merges);
 
   std::string inputs;
   std::string outputs;
@@ -82,6 +85,12 @@ void NodeProfile::setObjectsSize(LongType bytes) { _memoryObjects = bytes; }
 
 void NodeProfile::setTotalSize(LongType bytes) { _memoryTotal = bytes; }
 
+void NodeProfile::setHardwareCounters(LongType cycles, LongType instructions, LongType cacheMisses) {
+  _cycles = cycles;
+  _instructions = instructions;
+  _cacheMisses = cacheMisses;
+}
+
 LongType NodeProfile::getExecutionTime() const { return _executionTime; }
 
 void NodeProfile::addInputShape(LongType const *shapeInfo) {
@@ -105,6 +114,9 @@ void NodeProfile::merge(NodeProfile *other) {
   _shapeTime += other->_shapeTime;
   _arrayTime += other->_arrayTime;
   _inputTime += other->_inputTime;
+  _cycles += other->_cycles;
+  _instructions += other->_instructions;
+  _cacheMisses += other->_cacheMisses;
 
   _inputShapes = other->_inputShapes;
   _outputShapes = other->_outputShapes;
@@ -125,6 +137,9 @@ void NodeProfile::assign(NodeProfile *other) {
   _shapeTime = other->_shapeTime;
   _arrayTime = other->_arrayTime;
   _inputTime = other->_inputTime;
+  _cycles = other->_cycles;
+  _instructions = other->_instructions;
+  _cacheMisses = other->_cacheMisses;
 
   _inputShapes = other->_inputShapes;
   _outputShapes = other->_outputShapes;
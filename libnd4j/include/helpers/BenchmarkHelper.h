@@ -0,0 +1,129 @@
+/* ******************************************************************************
+ *
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ *  See the NOTICE file distributed with this work for additional
+ *  information regarding copyright ownership.
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ******************************************************************************/
+
+//
+// Timing harness for OpBenchmark instances: warmup, percentiles, throughput, thread sweeps and JSON/CSV reports
+//
+
+#ifndef LIBND4J_BENCHMARKHELPER_H
+#define LIBND4J_BENCHMARKHELPER_H
+#include <helpers/OpBenchmark.h>
+
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace sd {
+
+/**
+ * Timings of single benchmark configuration, all times are in microseconds
+ */
+struct SD_LIB_EXPORT BenchmarkResult {
+  std::string name;
+  std::string dataType;
+  std::string shape;
+  std::string orders;
+  std::string strides;
+  std::string axis;
+  std::string inplace;
+  std::string extra;
+
+  int threads = 0;
+  int iterations = 0;
+
+  double mean = 0.0;
+  double stdev = 0.0;
+  double min = 0.0;
+  double p50 = 0.0;
+  double p90 = 0.0;
+  double p99 = 0.0;
+  double max = 0.0;
+
+  LongType bytes = 0;
+  double flops = 0.0;
+
+  // throughput, computed against median time
+  double gigabytesPerSecond() const;
+  double gigaflopsPerSecond() const;
+};
+
+/**
+ * Single point of benchmark grid, handed to generator
+ */
+struct SD_LIB_EXPORT BenchmarkPoint {
+  std::vector<LongType> shape;
+  DataType dataType = FLOAT32;
+  char order = 'c';
+  std::vector<LongType> axis;
+};
+
+/**
+ * Cartesian product of shapes, data types, orders and axes. Empty axes list means "no axis".
+ */
+struct SD_LIB_EXPORT BenchmarkGrid {
+  std::vector<std::vector<LongType>> shapes;
+  std::vector<DataType> dataTypes = {FLOAT32};
+  std::vector<char> orders = {'c'};
+  std::vector<std::vector<LongType>> axes;
+
+  std::vector<BenchmarkPoint> points() const;
+};
+
+/**
+ * Generator builds benchmark for given grid point, harness takes ownership over returned benchmark.
+ * Generator might return nullptr to skip points that make no sense for given op
+ */
+typedef std::function<OpBenchmark *(const BenchmarkPoint &)> BenchmarkGenerator;
+
+class SD_LIB_EXPORT BenchmarkHelper {
+ private:
+  int _warmup;
+  int _iterations;
+  std::vector<int> _threads;
+
+ public:
+  /**
+   * @param warmup - number of untimed calls before measurements
+   * @param iterations - number of timed calls
+   * @param threads - thread counts to sweep over, empty vector means current Environment settings only
+   */
+  explicit BenchmarkHelper(int warmup = 10, int iterations = 100, const std::vector<int> &threads = {});
+
+  /**
+   * This method runs given benchmark once for each thread count
+   */
+  std::vector<BenchmarkResult> run(OpBenchmark &benchmark);
+
+  /**
+   * This method runs benchmark produced by generator for each point of the grid, and each thread count
+   */
+  std::vector<BenchmarkResult> run(const BenchmarkGrid &grid, const BenchmarkGenerator &generator);
+
+  /**
+   * This method returns linearly interpolated percentile of sorted timings, q is within [0, 1]
+   */
+  static double percentile(const std::vector<double> &sorted, double q);
+
+  static BenchmarkResult summarize(OpBenchmark &benchmark, std::vector<double> &timings, int threads);
+
+  static std::string toJson(const std::vector<BenchmarkResult> &results);
+  static std::string toCsv(const std::vector<BenchmarkResult> &results);
+};
+}  // namespace sd
+
+#endif  // LIBND4J_BENCHMARKHELPER_H
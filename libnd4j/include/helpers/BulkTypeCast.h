@@ -0,0 +1,64 @@
+/* ******************************************************************************
+ *
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ *  See the NOTICE file distributed with this work for additional
+ *  information regarding copyright ownership.
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ******************************************************************************/
+
+//
+// Bulk conversions between floating point types over contiguous buffers
+//
+
+#ifndef LIBND4J_BULKTYPECAST_H
+#define LIBND4J_BULKTYPECAST_H
+#include <array/DataType.h>
+#include <system/common.h>
+#include <types/bfloat16.h>
+#include <types/float16.h>
+#include <types/float8.h>
+
+namespace sd {
+
+/**
+ * This class converts contiguous buffers between float/double and half/bfloat16/float8 in blocks, using
+ * F16C/AVX2/AVX-512 kernels when the binary was built for them, and branchless scalar kernels otherwise.
+ *
+ * Results are bit-identical to the scalar float16/bfloat16/float8 types (round to nearest even) for all non-NaN
+ * inputs, NaN inputs always produce NaN.
+ */
+class SD_LIB_EXPORT BulkTypeCast {
+ public:
+  /**
+   * This method returns true if there's dedicated bulk kernel for given pair of data types
+   */
+  static bool canConvert(DataType from, DataType to);
+
+  /**
+   * This method converts length elements from x to z, both buffers are expected to be dense.
+   * Returns false if given pair of types isn't supported, so caller should use generic path instead
+   */
+  static bool convert(const void *x, DataType xType, void *z, DataType zType, LongType length,
+                      bool allowParallelism = true);
+
+  // single-threaded kernels
+  static void floatToHalf(const float *x, float16 *z, LongType length);
+  static void halfToFloat(const float16 *x, float *z, LongType length);
+  static void floatToBfloat16(const float *x, bfloat16 *z, LongType length);
+  static void bfloat16ToFloat(const bfloat16 *x, float *z, LongType length);
+  static void floatToFloat8(const float *x, float8 *z, LongType length);
+  static void float8ToFloat(const float8 *x, float *z, LongType length);
+};
+}  // namespace sd
+
+#endif  // LIBND4J_BULKTYPECAST_H
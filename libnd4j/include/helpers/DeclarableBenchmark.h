@@ -0,0 +1,100 @@
+/* ******************************************************************************
+ *
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ *  See the NOTICE file distributed with this work for additional
+ *  information regarding copyright ownership.
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ******************************************************************************/
+
+//
+// OpBenchmark implementation for DeclarableOps, legacy ops included via their Legacy*Op wrappers
+//
+
+#ifndef LIBND4J_DECLARABLEBENCHMARK_H
+#define LIBND4J_DECLARABLEBENCHMARK_H
+#include <helpers/OpBenchmark.h>
+#include <ops/declarable/DeclarableOp.h>
+
+namespace sd {
+class SD_LIB_EXPORT DeclarableBenchmark : public OpBenchmark {
+ protected:
+  ops::DeclarableOp *_op = nullptr;
+  bool _ownsOp = false;
+
+  std::vector<NDArray *> _inputs;
+  std::vector<NDArray *> _outputs;
+
+  std::vector<double> _tArgs;
+  std::vector<LongType> _iArgs;
+  std::vector<bool> _bArgs;
+  std::vector<DataType> _dArgs;
+
+  bool _inplace = false;
+  double _flops = -1.0;
+
+ public:
+  /**
+   * Benchmark takes ownership over input and output arrays. If outputs are empty, they're allocated once here,
+   * using shapes produced by the op itself, so executeOnce() measures execution only.
+   * If inplace is true, outputs are ignored and op writes into its inputs
+   */
+  DeclarableBenchmark(ops::DeclarableOp *op, std::string name, const std::vector<NDArray *> &inputs,
+                      const std::vector<NDArray *> &outputs = {}, const std::vector<double> &tArgs = {},
+                      const std::vector<LongType> &iArgs = {}, const std::vector<bool> &bArgs = {},
+                      const std::vector<DataType> &dArgs = {}, bool inplace = false);
+  ~DeclarableBenchmark() override;
+
+  /**
+   * This method returns new wrapper for legacy op of given type, i.e. "transform_strict" or "reduce_float",
+   * and given op number. Caller owns returned op, see takeOwnership()
+   */
+  static ops::DeclarableOp *legacyOp(const std::string &opType, int opNum);
+
+  /**
+   * This method rebuilds op call recorded in given trace: inputs get synthetic content of recorded shapes and
+   * data types, outputs are allocated with recorded shapes. Floating point inputs are filled with values within
+   * (0.5, 1.5], integer inputs with zeros, so they're valid indices.
+   * Returns nullptr if call can't be replayed: op isn't registered, it's a legacy op wrapper, or it has string inputs
+   */
+  static DeclarableBenchmark *fromTrace(const ops::OpExecTrace &trace);
+
+  /**
+   * Benchmark will delete its op on destruction
+   */
+  void takeOwnership();
+
+  /**
+   * This method overrides default flops estimate for a single call, i.e. 2 * M * N * K for matmul
+   */
+  void setFlops(double flops);
+
+  const std::vector<NDArray *> &inputs() const;
+  const std::vector<NDArray *> &outputs() const;
+
+  std::string axis() override;
+  std::string orders() override;
+  std::string strides() override;
+  std::string shape() override;
+  std::string inplace() override;
+  std::string extra() override;
+
+  LongType bytesMoved() override;
+  double flops() override;
+
+  void executeOnce() override;
+
+  OpBenchmark *clone() override;
+};
+}  // namespace sd
+
+#endif  // LIBND4J_DECLARABLEBENCHMARK_H
@@ -0,0 +1,194 @@
+/* ******************************************************************************
+ *
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ *  See the NOTICE file distributed with this work for additional
+ *  information regarding copyright ownership.
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ******************************************************************************/
+
+//
+// Hardware performance counters sampled around op execution
+//
+
+#ifndef LIBND4J_HARDWARECOUNTERS_H
+#define LIBND4J_HARDWARECOUNTERS_H
+#include <helpers/OpLatencyHistograms.h>
+#include <system/common.h>
+
+#include <atomic>
+#include <chrono>
+#include <map>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace sd {
+
+enum class HardwareCounter {
+  CYCLES = 0,
+  INSTRUCTIONS = 1,
+  // last level cache references and misses
+  CACHE_REFERENCES = 2,
+  CACHE_MISSES = 3,
+  BRANCH_MISSES = 4,
+};
+
+struct SD_LIB_EXPORT HardwareCounterValues {
+  static const int NUM_COUNTERS = 5;
+
+  uint64_t values[NUM_COUNTERS] = {0, 0, 0, 0, 0};
+
+  uint64_t get(HardwareCounter counter) const { return values[static_cast<int>(counter)]; }
+};
+
+/**
+ * Aggregated counters of one op within one shape class
+ */
+struct SD_LIB_EXPORT HardwareCounterSnapshot {
+  LongType key = 0;
+  int shapeClass = 0;
+  std::string name;
+  uint64_t count = 0;
+  uint64_t nanos = 0;
+  HardwareCounterValues counters;
+
+  double instructionsPerCycle() const;
+  double cacheMissRate() const;
+
+  /**
+   * Memory traffic estimated from last level cache misses, one cache line each, bytes per nanosecond
+   */
+  double estimatedBandwidth() const;
+};
+
+/**
+ * This class aggregates cycles, instructions, cache and branch misses per op and shape class.
+ *
+ * Counters are read with perf_event_open on Linux, for calling thread only: work done by thread pool workers isn't
+ * included, so numbers are most precise for single-threaded runs. Counter group is opened per thread on first use;
+ * if that fails (other OS, no PMU in VM, perf_event_paranoid too strict) sampling silently turns into no-op.
+ * Sampling is disabled by default, and costs single relaxed load while disabled.
+ */
+class SD_LIB_EXPORT HardwareCounters {
+ private:
+  struct Totals {
+    std::string name;
+    uint64_t count = 0;
+    uint64_t nanos = 0;
+    HardwareCounterValues counters;
+  };
+
+  static std::atomic<bool> _enabled;
+
+  std::mutex _lock;
+  std::map<std::pair<LongType, int>, Totals> _totals;
+  std::string _report;
+
+  HardwareCounters() = default;
+
+ public:
+  static HardwareCounters &getInstance();
+
+  static bool isEnabled() { return _enabled.load(std::memory_order_relaxed); }
+  static void setEnabled(bool enabled);
+
+  /**
+   * This method returns true if counters can be read on calling thread
+   */
+  static bool isSupported();
+
+  /**
+   * This method reads current counter values of calling thread, scaled for multiplexing. Returns false if counters
+   * aren't available
+   */
+  static bool read(HardwareCounterValues &values);
+
+  /**
+   * Shape class groups calls by rank and by power of two of length, so e.g. small and large matmuls stay apart
+   */
+  static int shapeClass(const LongType *shapeInfo);
+  static std::string shapeClassName(int shapeClass);
+
+  void record(LongType key, const std::string &name, int shapeClass, uint64_t nanos,
+              const HardwareCounterValues &before, const HardwareCounterValues &after);
+
+  /**
+   * Aggregated counters for all ops and shape classes, sorted by cycles, descending
+   */
+  std::vector<HardwareCounterSnapshot> snapshots();
+
+  /**
+   * This method drops all aggregated counters
+   */
+  void reset();
+
+  /**
+   * Text report with one line per op and shape class: name, key, shape class, count, cycles, instructions, IPC,
+   * cache references/misses, miss rate, estimated bandwidth, branch misses. Returned pointer stays valid until next call
+   */
+  const char *report();
+
+  /**
+   * This method prints top entries of report via sd_printf, it's used by GraphProfile::printOut
+   */
+  void printOut(int limit = 50);
+};
+
+/**
+ * RAII sampling scope, records nothing if sampling is disabled or counters aren't available.
+ * Only the thread that opened the scope is measured, see HardwareCounters
+ */
+class SD_LIB_EXPORT HardwareCounterScope {
+ private:
+  LongType _key;
+  const std::string *_name;
+  int _shapeClass;
+  LegacyOpKind _kind = LegacyOpKind::INDEX_REDUCE;
+  int _opNum = -1;
+  bool _enabled;
+  HardwareCounterValues _before;
+  std::chrono::steady_clock::time_point _start;
+
+  void start();
+
+ public:
+  // name must stay valid until scope is destroyed
+  HardwareCounterScope(LongType key, const std::string *name, const LongType *shapeInfo);
+  HardwareCounterScope(LegacyOpKind kind, int opNum, const LongType *shapeInfo);
+  ~HardwareCounterScope();
+
+  /**
+   * Counters sampled so far within this scope, false if nothing is sampled
+   */
+  bool current(HardwareCounterValues &delta);
+};
+
+/**
+ * RAII scope of NativeOpExecutioner entry points: latency histograms, timeline and hardware counters at once.
+ * Counters are grouped by shape class of x, or of z for ops without x
+ */
+class SD_LIB_EXPORT LegacyOpScope {
+ private:
+  LegacyOpLatencyScope _latency;
+  HardwareCounterScope _counters;
+
+ public:
+  LegacyOpScope(LegacyOpKind kind, int opNum, const LongType *xShapeInfo, const LongType *yShapeInfo,
+                const LongType *zShapeInfo)
+      : _latency(kind, opNum, xShapeInfo, yShapeInfo, zShapeInfo),
+        _counters(kind, opNum, xShapeInfo != nullptr ? xShapeInfo : zShapeInfo) {}
+};
+}  // namespace sd
+
+#endif  // LIBND4J_HARDWARECOUNTERS_H
@@ -28,6 +28,19 @@
 
 namespace sd {
 
+/**
+ * Iteration space of element-wise loop over x/y/z sharing the same shape (y and x may be broadcast, with zero
+ * strides), after unit dimensions are dropped, dimensions are ordered along z strides and dimensions contiguous
+ * in all arrays are merged. I.e. rank-4 'c' array with single strided axis has rank 2 here
+ */
+struct CollapsedLoop {
+  int rank = 0;
+  LongType shape[SD_MAX_RANK];
+  LongType xStrides[SD_MAX_RANK];
+  LongType yStrides[SD_MAX_RANK];
+  LongType zStrides[SD_MAX_RANK];
+};
+
 class SD_LIB_EXPORT LoopKind {
  public:
   enum Kind {
@@ -56,8 +69,142 @@ class SD_LIB_EXPORT LoopKind {
                                                const LongType* zShapeInfo);
   static SD_INLINE Kind deduceKindOfLoopBroadcast(const LongType* xShapeInfo, const LongType* yShapeInfo,
                                                   const LongType* zShapeInfo);
+
+  /**
+   * These methods fill collapsed iteration space for given arrays.
+   * Return false if shapes aren't compatible, i.e. x/y dimensions are neither equal to z ones nor unit ones
+   */
+  static SD_INLINE bool collapseXZ(const LongType* xShapeInfo, const LongType* zShapeInfo, CollapsedLoop& loop);
+  static SD_INLINE bool collapseXYZ(const LongType* xShapeInfo, const LongType* yShapeInfo,
+                                    const LongType* zShapeInfo, CollapsedLoop& loop);
+
+  /**
+   * This method calls func(xOffset, yOffset, zOffset) for elements [start, stop) of collapsed iteration space.
+   * Coordinates are evaluated once per call, and then advanced along innermost dimension
+   */
+  template <typename F>
+  static SD_INLINE void iterate(const CollapsedLoop& loop, LongType start, LongType stop, F func);
+
+ private:
+  static SD_INLINE bool broadcastStrides(const LongType* shapeInfo, const LongType* zShapeInfo, LongType* strides);
 };
 
+//////////////////////////////////////////////////////////////////////////////
+bool LoopKind::broadcastStrides(const LongType* shapeInfo, const LongType* zShapeInfo, LongType* strides) {
+  const int rank = shape::rank(zShapeInfo);
+  if (shape::rank(shapeInfo) != rank) return false;
+
+  for (int e = 0; e < rank; e++) {
+    const auto size = shape::sizeAt(shapeInfo, e);
+    if (size == shape::sizeAt(zShapeInfo, e))
+      strides[e] = shape::strideAt(shapeInfo, e);
+    else if (size == 1)
+      strides[e] = 0;
+    else
+      return false;
+  }
+
+  return true;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+bool LoopKind::collapseXZ(const LongType* xShapeInfo, const LongType* zShapeInfo, CollapsedLoop& loop) {
+  if (!shape::shapeEquals(xShapeInfo, zShapeInfo)) return false;
+
+  const int rank = shape::rank(zShapeInfo);
+  for (int e = 0; e < rank; e++) {
+    loop.shape[e] = shape::sizeAt(zShapeInfo, e);
+    loop.xStrides[e] = shape::strideAt(xShapeInfo, e);
+    // there's no y here, but iterate() advances its offset anyway
+    loop.yStrides[e] = 0;
+    loop.zStrides[e] = shape::strideAt(zShapeInfo, e);
+  }
+
+  LongType* strides[] = {loop.zStrides, loop.xStrides};
+  loop.rank = shape::collapseDimensions(rank, loop.shape, strides, 2);
+
+  return true;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+bool LoopKind::collapseXYZ(const LongType* xShapeInfo, const LongType* yShapeInfo, const LongType* zShapeInfo,
+                           CollapsedLoop& loop) {
+  if (!broadcastStrides(xShapeInfo, zShapeInfo, loop.xStrides) ||
+      !broadcastStrides(yShapeInfo, zShapeInfo, loop.yStrides))
+    return false;
+
+  const int rank = shape::rank(zShapeInfo);
+  for (int e = 0; e < rank; e++) {
+    loop.shape[e] = shape::sizeAt(zShapeInfo, e);
+    loop.zStrides[e] = shape::strideAt(zShapeInfo, e);
+  }
+
+  LongType* strides[] = {loop.zStrides, loop.xStrides, loop.yStrides};
+  loop.rank = shape::collapseDimensions(rank, loop.shape, strides, 3);
+
+  return true;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+template <typename F>
+void LoopKind::iterate(const CollapsedLoop& loop, LongType start, LongType stop, F func) {
+  if (start >= stop) return;
+
+  if (loop.rank == 0) {
+    func(0, 0, 0);
+    return;
+  }
+
+  const int inner = loop.rank - 1;
+  const auto xInner = loop.xStrides[inner];
+  const auto yInner = loop.yStrides[inner];
+  const auto zInner = loop.zStrides[inner];
+
+  if (loop.rank == 1) {
+    if (xInner == 1 && yInner == 1 && zInner == 1) {
+      PRAGMA_OMP_SIMD
+      for (LongType i = start; i < stop; i++) func(i, i, i);
+    } else {
+      PRAGMA_OMP_SIMD
+      for (LongType i = start; i < stop; i++) func(i * xInner, i * yInner, i * zInner);
+    }
+
+    return;
+  }
+
+  LongType coords[SD_MAX_RANK];
+  INDEX2COORDS(start, loop.rank, loop.shape, coords);
+
+  LongType xOffset = 0, yOffset = 0, zOffset = 0;
+  for (int e = 0; e < loop.rank; e++) {
+    xOffset += coords[e] * loop.xStrides[e];
+    yOffset += coords[e] * loop.yStrides[e];
+    zOffset += coords[e] * loop.zStrides[e];
+  }
+
+  for (LongType i = start; i < stop;) {
+    const auto count = sd::math::sd_min<LongType>(loop.shape[inner] - coords[inner], stop - i);
+
+    PRAGMA_OMP_SIMD
+    for (LongType e = 0; e < count; e++) func(xOffset + e * xInner, yOffset + e * yInner, zOffset + e * zInner);
+
+    i += count;
+    coords[inner] += count;
+    xOffset += count * xInner;
+    yOffset += count * yInner;
+    zOffset += count * zInner;
+
+    // carrying over to outer dimensions
+    for (int d = inner; d > 0 && coords[d] == loop.shape[d]; d--) {
+      xOffset += loop.xStrides[d - 1] - coords[d] * loop.xStrides[d];
+      yOffset += loop.yStrides[d - 1] - coords[d] * loop.yStrides[d];
+      zOffset += loop.zStrides[d - 1] - coords[d] * loop.zStrides[d];
+      coords[d] = 0;
+      coords[d - 1]++;
+    }
+  }
+}
+
 //////////////////////////////////////////////////////////////////////////////
 LoopKind::Kind LoopKind::deduceKindOfLoopXZ(const LongType* xShapeInfo, const LongType* zShapeInfo) {
   const int xRank = shape::rank(xShapeInfo);
@@ -27,12 +27,15 @@
 #include <helpers/ConstantTadHelper.h>
 #include <helpers/LoopKind.h>
 #include <helpers/OmpLaunchHelper.h>
+#include <helpers/ReductionKernels.h>
 #include <helpers/shape.h>
 #include <loops/indexreduce.h>
 #include <ops/ops.h>
 
 
 #include <functional>
+#include <memory>
+#include <vector>
 
 namespace sd {
 
@@ -886,6 +889,191 @@ SD_LIB_HIDDEN void reduceDefault(memory::Workspace* workspace, const X* x, const
   if (!sameOffsets2) RELEASE(innerXTadOffsets, workspace);
 }
 
+//////////////////////////////////////////////////////////////////////////////
+// how reduction along dims is iterated
+enum class ReduceStrategy {
+  // reduced dimensions form one dense block, every tad is contiguous span
+  CONTIGUOUS_TADS,
+  // kept dimensions form dense block with smallest strides, i.e. x is [rows, zLen] with reduction along rows
+  OUTER_AXIS,
+  // rank-specific or generic tad loops
+  DEFAULT
+};
+
+// sorts non-unit dimensions by stride and checks they are dense, starting from stride "first"
+SD_INLINE bool isDenseBlock(const LongType* xShapeInfo, const LongType* dims, int numDims, LongType first) {
+  LongType sizes[SD_MAX_RANK];
+  LongType strides[SD_MAX_RANK];
+  int numNonUnit = 0;
+  for (int i = 0; i < numDims; i++) {
+    const LongType size = shape::sizeAt(xShapeInfo, dims[i]);
+    if (size == 1) continue;
+
+    const LongType stride = shape::strideAt(xShapeInfo, dims[i]);
+    int j = numNonUnit++;
+    for (; j > 0 && strides[j - 1] > stride; j--) {
+      sizes[j] = sizes[j - 1];
+      strides[j] = strides[j - 1];
+    }
+    sizes[j] = size;
+    strides[j] = stride;
+  }
+
+  LongType expected = first;
+  for (int i = 0; i < numNonUnit; i++) {
+    if (strides[i] != expected) return false;
+    expected *= sizes[i];
+  }
+
+  return true;
+}
+
+template <typename X, typename E, typename OpType>
+SD_INLINE ReduceStrategy selectReduceStrategy(const LongType* xShapeInfo, const LongType* zShapeInfo,
+                                              const LongType* dims) {
+  const LongType zLen = shape::length(zShapeInfo);
+  if (zLen == 0) return ReduceStrategy::DEFAULT;
+
+  const int xRank = shape::rank(xShapeInfo);
+  const int zRank = shape::rank(zShapeInfo);
+  if (zRank >= xRank) return ReduceStrategy::DEFAULT;
+
+  // output dimensions must follow kept dimensions of x
+  for (int i = 0; i < zRank; i++)
+    if (shape::sizeAt(zShapeInfo, i) != shape::sizeAt(xShapeInfo, dims[i])) return ReduceStrategy::DEFAULT;
+
+  if (reductions::HasLaneKernel<OpType, X, E>::value && isDenseBlock(xShapeInfo, dims + zRank, xRank - zRank, 1))
+    return ReduceStrategy::CONTIGUOUS_TADS;
+
+  if (isDenseBlock(xShapeInfo, dims, zRank, 1) && isDenseBlock(xShapeInfo, dims + zRank, xRank - zRank, zLen))
+    return ReduceStrategy::OUTER_AXIS;
+
+  return ReduceStrategy::DEFAULT;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+template <typename X, typename Z, typename E, typename OpType>
+SD_LIB_HIDDEN void reduceContiguousTads(const X* x, const LongType* xShapeInfo, Z* z, const LongType* zShapeInfo,
+                                        const LongType* dims, E* extraParams) {
+  const int zRank = shape::rank(zShapeInfo);
+  const LongType zLen = shape::length(zShapeInfo);
+  const LongType tadLen = shape::length(xShapeInfo) / zLen;
+
+  LongType xOuterStrides[SD_MAX_RANK];
+  for (int i = 0; i < zRank; i++) xOuterStrides[i] = shape::strideAt(xShapeInfo, dims[i]);
+
+  const LongType* zShape = shape::shapeOf(zShapeInfo);
+  const LongType* zStrides = shape::stride(zShapeInfo);
+
+  auto func = PRAGMA_THREADS_FOR {
+    LongType coords[SD_MAX_RANK];
+    for (auto i = start; i < stop; i++) {
+      INDEX2COORDS(i, zRank, zShape, coords);
+      LongType zOffset, xOffset;
+      COORDS2INDEX(zRank, zStrides, coords, zOffset);
+      COORDS2INDEX(zRank, xOuterStrides, coords, xOffset);
+
+      z[zOffset] = OpType::postProcess(reductions::reduceContiguous<OpType, X, E>(x + xOffset, tadLen, extraParams),
+                                       tadLen, extraParams);
+    }
+  };
+
+  samediff::Threads::parallel_for(func, 0, zLen);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+// reduces numCols columns starting at colStart of [numRows, rowLen] matrix, rows are streamed contiguously into
+// accumulators, which are combined with partial results of previous blocks of rows every kReduceBlock rows
+template <typename X, typename E, typename OpType>
+SD_LIB_HIDDEN void reduceRows(const X* x, LongType numRows, LongType rowLen, LongType colStart, LongType numCols,
+                              reductions::AccumulatorType<OpType, X, E>* result, E* extraParams) {
+  using Acc = reductions::AccumulatorType<OpType, X, E>;
+  const Acc initial = static_cast<Acc>(OpType::startingValue(x));
+
+  std::unique_ptr<Acc[]> block(new Acc[numCols]);
+  std::vector<reductions::PartialCombiner<OpType, Acc>> combiners(numCols,
+                                                                  reductions::PartialCombiner<OpType, Acc>(initial));
+
+  auto pBlock = block.get();
+  for (LongType first = 0; first < numRows; first += reductions::kReduceBlock) {
+    const LongType last = math::sd_min<LongType>(first + reductions::kReduceBlock, numRows);
+
+    for (LongType c = 0; c < numCols; c++) pBlock[c] = initial;
+
+    for (LongType r = first; r < last; r++) {
+      auto row = x + r * rowLen + colStart;
+      PRAGMA_OMP_SIMD
+      for (LongType c = 0; c < numCols; c++)
+        pBlock[c] = OpType::update(pBlock[c], OpType::op(row[c], extraParams), extraParams);
+    }
+
+    for (LongType c = 0; c < numCols; c++) combiners[c].add(pBlock[c], extraParams);
+  }
+
+  for (LongType c = 0; c < numCols; c++) result[c] = combiners[c].result();
+}
+
+//////////////////////////////////////////////////////////////////////////////
+template <typename X, typename Z, typename E, typename OpType>
+SD_LIB_HIDDEN void reduceOuterAxis(const X* x, const LongType* xShapeInfo, Z* z, const LongType* zShapeInfo,
+                                   const LongType* dims, E* extraParams) {
+  using Acc = reductions::AccumulatorType<OpType, X, E>;
+
+  const int zRank = shape::rank(zShapeInfo);
+  const LongType rowLen = shape::length(zShapeInfo);
+  const LongType numRows = shape::length(xShapeInfo) / rowLen;
+  const int maxThreads = Environment::getInstance().maxThreads();
+
+  // accumulators are indexed by offset within row
+  std::unique_ptr<Acc[]> total(new Acc[rowLen]);
+  auto pTotal = total.get();
+
+  if (rowLen >= 256 * maxThreads || numRows < maxThreads) {
+    // every thread owns slice of columns and streams it through all rows, nothing to merge
+    auto func = PRAGMA_THREADS_FOR {
+      reduceRows<X, E, OpType>(x, numRows, rowLen, start, stop - start, pTotal + start, extraParams);
+    };
+    samediff::Threads::parallel_for(func, 0, rowLen);
+  } else {
+    // every thread owns range of rows and accumulates whole row width, partial results are merged afterwards
+    std::vector<std::unique_ptr<Acc[]>> partials(maxThreads);
+    auto func = PRAGMA_THREADS_FOR {
+      partials[thread_id].reset(new Acc[rowLen]);
+      reduceRows<X, E, OpType>(x + start * rowLen, stop - start, rowLen, 0, rowLen, partials[thread_id].get(),
+                               extraParams);
+    };
+    const int numThreads = samediff::Threads::parallel_for(func, 0, numRows, 1, maxThreads);
+
+    auto merge = PRAGMA_THREADS_FOR {
+      for (auto c = start; c < stop; c++) {
+        reductions::PartialCombiner<OpType, Acc> combiner(partials[0][c]);
+        for (int t = 1; t < numThreads; t++) combiner.add(partials[t][c], extraParams);
+        pTotal[c] = combiner.result();
+      }
+    };
+    samediff::Threads::parallel_for(merge, 0, rowLen);
+  }
+
+  LongType xKeptStrides[SD_MAX_RANK];
+  for (int i = 0; i < zRank; i++) xKeptStrides[i] = shape::strideAt(xShapeInfo, dims[i]);
+
+  const LongType* zShape = shape::shapeOf(zShapeInfo);
+  const LongType* zStrides = shape::stride(zShapeInfo);
+
+  auto func = PRAGMA_THREADS_FOR {
+    LongType coords[SD_MAX_RANK];
+    for (auto i = start; i < stop; i++) {
+      INDEX2COORDS(i, zRank, zShape, coords);
+      LongType zOffset, column;
+      COORDS2INDEX(zRank, zStrides, coords, zOffset);
+      COORDS2INDEX(zRank, xKeptStrides, coords, column);
+
+      z[zOffset] = OpType::postProcess(pTotal[column], numRows, extraParams);
+    }
+  };
+  samediff::Threads::parallel_for(func, 0, rowLen);
+}
+
 //////////////////////////////////////////////////////////////////////////////
 template <typename X, typename Z, typename E>
 template <typename OpType>
@@ -896,7 +1084,13 @@ SD_LIB_HIDDEN void ReductionLoops<X, Z, E>::loopReduce(memory::Workspace* worksp
   const LongType xRank = shape::rank(xShapeInfo);
   const LongType zRank = shape::rank(zShapeInfo);
 
-  if (xRank == 2 && zRank == 1)
+  const auto strategy = selectReduceStrategy<X, E, OpType>(xShapeInfo, zShapeInfo, dims);
+
+  if (strategy == ReduceStrategy::CONTIGUOUS_TADS)
+    reduceContiguousTads<X, Z, E, OpType>(x, xShapeInfo, z, zShapeInfo, dims, extraParams);
+  else if (strategy == ReduceStrategy::OUTER_AXIS)
+    reduceOuterAxis<X, Z, E, OpType>(x, xShapeInfo, z, zShapeInfo, dims, extraParams);
+  else if (xRank == 2 && zRank == 1)
     reduceExec21<X, Z, E, OpType>(x, xShapeInfo, z, zShapeInfo, dims, extraParams);
   else if (xRank == 3 && zRank == 1)
     reduceExec31<X, Z, E, OpType>(x, xShapeInfo, z, zShapeInfo, dims, extraParams);
@@ -957,28 +1151,14 @@ SD_LIB_HIDDEN void TransformLoops<X, Z, E>::loopTransform(const X* x,
   switch (kindOfLoop) {
     //*********************************************//
     default: {
-      if(shape::shapeEquals(xShapeInfo, zShapeInfo)) {
-        LongType xCoords[SD_MAX_RANK];
-        LongType zCoords[SD_MAX_RANK];
-        auto xLen = shape::length(xShapeInfo);
-        auto zLen = shape::length(zShapeInfo);
+      // dimensions are collapsed first, so most real arrays end up with rank 1 or 2 here
+      CollapsedLoop loop;
+      if (LoopKind::collapseXZ(xShapeInfo, zShapeInfo, loop)) {
         auto span = samediff::Span::build(threadId, numThreads, 0, len, 1);
 
-        for (auto i = span.startX(); i < span.stopX(); i++) {
-          INDEX2COORDS(i, xRank, xShape, xCoords);
-          INDEX2COORDS(i,zRank, zShape, zCoords);
-
-          sd::LongType xOffset;
-          sd::LongType zOffset;
-          COORDS2INDEX(xRank, xStride, xCoords, xOffset);
-          COORDS2INDEX(zRank, zStride, zCoords, zOffset);
-
-
-          auto opResult = OpType::op(x[xOffset], extraParams);
-          z[zOffset] = static_cast<Z>(opResult);
-        }
-
-
+        LoopKind::iterate(loop, span.startX(), span.stopX(), [&](LongType xOffset, LongType, LongType zOffset) {
+          z[zOffset] = static_cast<Z>(OpType::op(x[xOffset], extraParams));
+        });
       } else {
         LongType xCoords[SD_MAX_RANK];
         LongType zCoords[SD_MAX_RANK];
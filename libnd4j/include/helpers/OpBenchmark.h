@@ -39,10 +39,11 @@ class SD_LIB_EXPORT OpBenchmark {
   NDArray *_x = nullptr;
   NDArray *_y = nullptr;
   NDArray *_z = nullptr;
-  std::vector<LongType> *_axis;
+  std::vector<LongType> _axis;
 
  public:
   OpBenchmark() = default;
+  virtual ~OpBenchmark() = default;
   OpBenchmark(std::string name, NDArray *x, NDArray *y, NDArray *z);
   OpBenchmark(std::string name, NDArray *x, NDArray *z);
   OpBenchmark(std::string name, NDArray *x, NDArray *z, std::initializer_list<LongType> *axis);
@@ -71,6 +72,18 @@ class SD_LIB_EXPORT OpBenchmark {
   virtual std::string shape();
   virtual std::string inplace() = 0;
 
+  /**
+   * This method returns number of bytes read and written by single executeOnce() call.
+   * Default implementation counts x, y and z once each
+   */
+  virtual LongType bytesMoved();
+
+  /**
+   * This method returns number of floating point operations performed by single executeOnce() call.
+   * Default implementation assumes one operation per element of the largest array
+   */
+  virtual double flops();
+
   virtual void executeOnce() = 0;
 
   virtual OpBenchmark *clone() = 0;
@@ -0,0 +1,224 @@
+/* ******************************************************************************
+ *
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ *  See the NOTICE file distributed with this work for additional
+ *  information regarding copyright ownership.
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ******************************************************************************/
+
+//
+// Always-on per-op latency histograms, sharded per thread
+//
+
+#ifndef LIBND4J_OPLATENCYHISTOGRAMS_H
+#define LIBND4J_OPLATENCYHISTOGRAMS_H
+#include <helpers/TimelineTracer.h>
+#include <system/common.h>
+
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace sd {
+
+/**
+ * Log-linear latency buckets, HDR histogram style: values below 16ns get exact buckets, every following power of two
+ * is split into 16 linear sub-buckets, so relative error of reported percentiles stays below 1/16
+ */
+class SD_LIB_EXPORT LatencyBuckets {
+ public:
+  static const int SUB_BUCKETS = 16;
+  static const int SUB_BUCKET_BITS = 4;
+  // top bucket covers ~39 hours, everything above is clamped into it
+  static const int MAX_EXPONENT = 47;
+  static const int NUM_BUCKETS = SUB_BUCKETS * (MAX_EXPONENT - SUB_BUCKET_BITS + 2);
+
+  static int bucketFor(uint64_t nanos);
+  static uint64_t lowerBound(int bucket);
+  static uint64_t upperBound(int bucket);
+};
+
+/**
+ * Merged view of one op's histogram
+ */
+struct SD_LIB_EXPORT OpLatencySnapshot {
+  LongType key = 0;
+  std::string name;
+  uint64_t count = 0;
+  uint64_t totalNanos = 0;
+  uint64_t maxNanos = 0;
+  uint64_t bytesIn = 0;
+  uint64_t bytesOut = 0;
+  std::vector<uint64_t> buckets;
+
+  /**
+   * This method returns latency in nanoseconds below which given fraction of calls fall, q is within [0, 1]
+   */
+  double percentile(double q) const;
+  double meanNanos() const;
+};
+
+/**
+ * Legacy op families recorded from NativeOpExecutioner, used to build histogram keys for legacy calls
+ */
+enum class LegacyOpKind {
+  INDEX_REDUCE = 1,
+  REDUCE3,
+  SCALAR,
+  SCALAR_BOOL,
+  SCALAR_INT,
+  BROADCAST,
+  BROADCAST_BOOL,
+  BROADCAST_INT,
+  PAIRWISE,
+  PAIRWISE_BOOL,
+  PAIRWISE_INT,
+  TRANSFORM_FLOAT,
+  TRANSFORM_ANY,
+  TRANSFORM_STRICT,
+  TRANSFORM_SAME,
+  TRANSFORM_BOOL,
+  REDUCE_FLOAT,
+  REDUCE_SAME,
+  REDUCE_BOOL,
+  REDUCE_LONG,
+  SUMMARY_STATS,
+  RANDOM,
+};
+
+/**
+ * This class keeps latency histograms, call counts and bytes in/out per op.
+ *
+ * Each thread records into its own shard without locks or atomic read-modify-write: shard counters have a single
+ * writer, readers merge all shards on demand. Shard lock is taken by a writer only when it sees an op for the first
+ * time, and by readers while merging.
+ */
+class SD_LIB_EXPORT OpLatencyHistograms {
+ private:
+  struct OpCounters {
+    std::string name;
+    std::atomic<uint64_t> count{0};
+    std::atomic<uint64_t> totalNanos{0};
+    std::atomic<uint64_t> maxNanos{0};
+    std::atomic<uint64_t> bytesIn{0};
+    std::atomic<uint64_t> bytesOut{0};
+    std::atomic<uint64_t> buckets[LatencyBuckets::NUM_BUCKETS];
+
+    OpCounters();
+    void reset();
+  };
+
+  struct Shard {
+    std::mutex lock;
+    std::unordered_map<LongType, OpCounters *> ops;
+    std::atomic<bool> free{false};
+
+    ~Shard();
+  };
+
+  friend struct ShardHandle;
+
+  static std::atomic<bool> _enabled;
+
+  std::mutex _lock;
+  std::vector<Shard *> _shards;
+  std::string _report;
+
+  OpLatencyHistograms() = default;
+
+  Shard *acquireShard();
+  Shard *localShard();
+  void releaseShard(Shard *shard);
+
+  static OpCounters *lookup(Shard *shard, LongType key);
+  static OpCounters *insert(Shard *shard, LongType key, const std::string &name);
+  static void update(OpCounters *counters, uint64_t nanos, uint64_t bytesIn, uint64_t bytesOut);
+
+ public:
+  ~OpLatencyHistograms();
+
+  static OpLatencyHistograms &getInstance();
+
+  static bool isEnabled() { return _enabled.load(std::memory_order_relaxed); }
+  static void setEnabled(bool enabled);
+
+  /**
+   * Key for legacy op calls, kept negative to stay apart from custom op hashes in practice
+   */
+  static LongType legacyKey(LegacyOpKind kind, int opNum);
+  static std::string legacyName(LegacyOpKind kind, int opNum);
+
+  /**
+   * This method records single op call. Name is copied only once, when op is seen by calling thread for the first time
+   */
+  void record(LongType key, const std::string &name, uint64_t nanos, uint64_t bytesIn, uint64_t bytesOut);
+  void record(LegacyOpKind kind, int opNum, uint64_t nanos, uint64_t bytesIn, uint64_t bytesOut);
+
+  /**
+   * Merged histogram for given key, count is 0 if op wasn't recorded yet
+   */
+  OpLatencySnapshot snapshot(LongType key);
+
+  /**
+   * Merged histograms for all recorded ops, sorted by total time, descending
+   */
+  std::vector<OpLatencySnapshot> snapshots();
+
+  /**
+   * This method zeroes all counters, histograms stay registered
+   */
+  void reset();
+
+  /**
+   * Text report with one line per op: name, key, count, bytes in/out, mean/p50/p99/p999/max in microseconds.
+   * Returned pointer stays valid until next call
+   */
+  const char *report();
+};
+
+/**
+ * RAII timer for NativeOpExecutioner entry points, it records nothing if both histograms and timeline tracer
+ * are disabled. Bytes in are taken from x and y shapes (y is optional), bytes out from z shape
+ */
+class SD_LIB_EXPORT LegacyOpLatencyScope {
+ private:
+  LegacyOpKind _kind;
+  int _opNum;
+  const LongType *_xShapeInfo;
+  const LongType *_yShapeInfo;
+  const LongType *_zShapeInfo;
+  bool _histograms;
+  bool _timeline;
+  std::chrono::steady_clock::time_point _start;
+
+ public:
+  LegacyOpLatencyScope(LegacyOpKind kind, int opNum, const LongType *xShapeInfo, const LongType *yShapeInfo,
+                       const LongType *zShapeInfo)
+      : _kind(kind),
+        _opNum(opNum),
+        _xShapeInfo(xShapeInfo),
+        _yShapeInfo(yShapeInfo),
+        _zShapeInfo(zShapeInfo),
+        _histograms(OpLatencyHistograms::isEnabled()),
+        _timeline(TimelineTracer::isEnabled()) {
+    if (_histograms || _timeline) _start = std::chrono::steady_clock::now();
+  }
+
+  ~LegacyOpLatencyScope();
+};
+}  // namespace sd
+
+#endif  // LIBND4J_OPLATENCYHISTOGRAMS_H
@@ -0,0 +1,154 @@
+/* ******************************************************************************
+ *
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ *  See the NOTICE file distributed with this work for additional
+ *  information regarding copyright ownership.
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ******************************************************************************/
+
+//
+// Immutable perfect hash table, built once from known set of keys
+//
+
+#ifndef LIBND4J_PERFECTHASHTABLE_H
+#define LIBND4J_PERFECTHASHTABLE_H
+#include <system/common.h>
+
+#include <algorithm>
+#include <functional>
+#include <utility>
+#include <vector>
+
+namespace sd {
+
+/**
+ * Hash-and-displace perfect hash table: keys are spread over small buckets, and every bucket gets its own seed
+ * chosen at build time, so all keys land into distinct slots. Lookup is two hash mixes, one seed load and one key
+ * comparison, without probing.
+ *
+ * Table is immutable after construction, so concurrent lookups need no synchronization. Adding a key means building
+ * new table.
+ */
+template <typename K, typename V, typename H = std::hash<K>>
+class PerfectHashTable {
+ private:
+  std::vector<uint32_t> _seeds;
+  std::vector<K> _keys;
+  std::vector<V> _values;
+  std::vector<uint8_t> _used;
+  uint64_t _bucketMask = 0;
+  uint64_t _slotMask = 0;
+  size_t _size = 0;
+
+  // splitmix64 finalizer, std::hash of integers is identity on most platforms
+  static uint64_t mix(uint64_t x) {
+    x ^= x >> 30;
+    x *= 0xbf58476d1ce4e5b9ULL;
+    x ^= x >> 27;
+    x *= 0x94d049bb133111ebULL;
+    x ^= x >> 31;
+    return x;
+  }
+
+  static uint64_t powerOfTwo(uint64_t value) {
+    uint64_t result = 1;
+    while (result < value) result <<= 1;
+    return result;
+  }
+
+  bool build(const std::vector<std::pair<K, V>> &entries, uint64_t slots) {
+    auto buckets = powerOfTwo(std::max<uint64_t>(1, entries.size() / 4));
+    _bucketMask = buckets - 1;
+    _slotMask = slots - 1;
+    _seeds.assign(buckets, 0);
+    _keys.assign(slots, K());
+    _values.assign(slots, V());
+    _used.assign(slots, 0);
+
+    std::vector<std::vector<size_t>> members(buckets);
+    std::vector<uint64_t> hashes(entries.size());
+    for (size_t e = 0; e < entries.size(); e++) {
+      hashes[e] = mix(static_cast<uint64_t>(H()(entries[e].first)));
+      members[hashes[e] & _bucketMask].emplace_back(e);
+    }
+
+    // largest buckets are placed first, while table is still empty
+    std::vector<size_t> order(buckets);
+    for (size_t b = 0; b < buckets; b++) order[b] = b;
+    std::stable_sort(order.begin(), order.end(),
+                     [&members](size_t a, size_t b) { return members[a].size() > members[b].size(); });
+
+    std::vector<uint64_t> placed;
+    for (auto b : order) {
+      if (members[b].empty()) break;
+
+      bool found = false;
+      for (uint32_t seed = 1; seed < (1u << 16) && !found; seed++) {
+        placed.clear();
+        for (auto e : members[b]) {
+          auto slot = mix(hashes[e] ^ seed) & _slotMask;
+          if (_used[slot] || std::find(placed.begin(), placed.end(), slot) != placed.end()) break;
+
+          placed.emplace_back(slot);
+        }
+
+        if (placed.size() != members[b].size()) continue;
+
+        for (size_t i = 0; i < placed.size(); i++) {
+          auto &entry = entries[members[b][i]];
+          _keys[placed[i]] = entry.first;
+          _values[placed[i]] = entry.second;
+          _used[placed[i]] = 1;
+        }
+
+        _seeds[b] = seed;
+        found = true;
+      }
+
+      if (!found) return false;
+    }
+
+    return true;
+  }
+
+ public:
+  PerfectHashTable() = default;
+
+  /**
+   * Keys must be unique
+   */
+  explicit PerfectHashTable(const std::vector<std::pair<K, V>> &entries) {
+    _size = entries.size();
+    if (entries.empty()) return;
+
+    // load factor 0.5 keeps seed search short, table grows if some bucket can't be placed
+    for (auto slots = powerOfTwo(entries.size() * 2);; slots *= 2)
+      if (build(entries, slots)) break;
+  }
+
+  /**
+   * This method returns pointer to value stored for given key, or nullptr
+   */
+  const V *find(const K &key) const {
+    if (_size == 0) return nullptr;
+
+    auto hash = mix(static_cast<uint64_t>(H()(key)));
+    auto slot = mix(hash ^ _seeds[hash & _bucketMask]) & _slotMask;
+    return _used[slot] && _keys[slot] == key ? &_values[slot] : nullptr;
+  }
+
+  size_t size() const { return _size; }
+};
+}  // namespace sd
+
+#endif  // LIBND4J_PERFECTHASHTABLE_H
@@ -0,0 +1,220 @@
+/* ******************************************************************************
+ *
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ *  See the NOTICE file distributed with this work for additional
+ *  information regarding copyright ownership.
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ******************************************************************************/
+
+//
+// Reduction kernels for contiguous spans: independent accumulators merged pairwise, partial results of long spans
+// combined with Kahan compensation for summing ops
+//
+
+#ifndef LIBND4J_REDUCTIONKERNELS_H
+#define LIBND4J_REDUCTIONKERNELS_H
+#include <execution/Threads.h>
+#include <ops/ops.h>
+#include <system/Environment.h>
+#include <system/op_boilerplate.h>
+
+#include <type_traits>
+#include <utility>
+
+namespace sd {
+namespace reductions {
+
+// number of independent accumulators, each one gets every kReduceLanes-th element
+constexpr int kReduceLanes = 8;
+
+// elements reduced by lanes before partial result is combined with others
+constexpr LongType kReduceBlock = 1024;
+
+/**
+ * Type of reduction accumulator, i.e. what OpType::update returns
+ */
+template <typename OpType, typename X, typename E>
+using AccumulatorType = typename std::decay<decltype(OpType::update(
+    OpType::op(std::declval<X>(), std::declval<E *>()), OpType::op(std::declval<X>(), std::declval<E *>()),
+    std::declval<E *>()))>::type;
+
+/**
+ * Ops whose update is plain addition of op outputs, their partial results may be combined with compensation
+ */
+template <typename OpType>
+struct IsSumReduction : std::false_type {};
+
+template <typename X>
+struct IsSumReduction<simdOps::Sum<X>> : std::true_type {};
+template <typename X>
+struct IsSumReduction<simdOps::ASum<X>> : std::true_type {};
+template <typename X, typename Z>
+struct IsSumReduction<simdOps::Mean<X, Z>> : std::true_type {};
+template <typename X, typename Z>
+struct IsSumReduction<simdOps::AMean<X, Z>> : std::true_type {};
+template <typename X, typename Z>
+struct IsSumReduction<simdOps::Norm1<X, Z>> : std::true_type {};
+template <typename X, typename Z>
+struct IsSumReduction<simdOps::Norm2<X, Z>> : std::true_type {};
+template <typename X, typename Z>
+struct IsSumReduction<simdOps::SquaredNorm<X, Z>> : std::true_type {};
+template <typename X, typename Z>
+struct IsSumReduction<simdOps::NormFrobenius<X, Z>> : std::true_type {};
+template <typename X, typename Z>
+struct IsSumReduction<simdOps::NormP<X, Z>> : std::true_type {};
+
+/**
+ * Lane kernels keep accumulators in the type returned by update, so they are used only for ops accumulating into
+ * numeric types. Boolean ops accumulate in input type and keep their generic loops
+ */
+template <typename OpType, typename X, typename E>
+struct HasLaneKernel
+    : std::integral_constant<bool, !std::is_same<AccumulatorType<OpType, X, E>, bool>::value> {};
+
+/**
+ * This class combines partial results of one reduction, with OpType::update by default
+ */
+template <typename OpType, typename Acc,
+          bool compensated = IsSumReduction<OpType>::value && !std::is_integral<Acc>::value>
+class PartialCombiner {
+ private:
+  Acc _total;
+
+ public:
+  explicit PartialCombiner(Acc start) : _total(start) {}
+
+  template <typename E>
+  SD_INLINE void add(Acc partial, E *extraParams) {
+    _total = OpType::update(_total, partial, extraParams);
+  }
+
+  SD_INLINE Acc result() const { return _total; }
+};
+
+/**
+ * Rounded value of floating point expression: it passes through volatile variable, so compiler can't reassociate
+ * it with neighbouring operations even under -ffast-math or -fp-model fast. Other types are returned as is
+ */
+template <typename T>
+SD_INLINE T roundedValue(T v, std::true_type) {
+  volatile T r = v;
+  return r;
+}
+
+template <typename T>
+SD_INLINE T roundedValue(T v, std::false_type) {
+  return v;
+}
+
+template <typename T>
+SD_INLINE T roundedValue(T v) {
+  return roundedValue(v, typename std::is_floating_point<T>::type());
+}
+
+/**
+ * Kahan summation of partial results: lost low-order bits of every addition are carried into next one.
+ * Every step is rounded explicitly, otherwise fast-math builds simplify compensation (t - total) - y to zero
+ */
+template <typename OpType, typename Acc>
+class PartialCombiner<OpType, Acc, true> {
+ private:
+  Acc _total;
+  Acc _compensation = static_cast<Acc>(0);
+
+ public:
+  explicit PartialCombiner(Acc start) : _total(start) {}
+
+  template <typename E>
+  SD_INLINE void add(Acc partial, E *extraParams) {
+    const Acc y = roundedValue(partial - _compensation);
+    const Acc t = roundedValue(_total + y);
+    _compensation = roundedValue(t - _total) - y;
+    _total = t;
+  }
+
+  SD_INLINE Acc result() const { return _total; }
+};
+
+/**
+ * This method reduces contiguous span with kReduceLanes independent accumulators. Lanes don't depend on each other,
+ * so the loop over lanes is vectorized without reassociation of floating point operations. Lanes are merged pairwise
+ */
+template <typename OpType, typename X, typename E>
+SD_INLINE AccumulatorType<OpType, X, E> reduceLanes(const X *x, LongType length, E *extraParams) {
+  using Acc = AccumulatorType<OpType, X, E>;
+  const Acc start = static_cast<Acc>(OpType::startingValue(x));
+
+  Acc lanes[kReduceLanes];
+  for (int l = 0; l < kReduceLanes; l++) lanes[l] = start;
+
+  LongType i = 0;
+  for (; i + kReduceLanes <= length; i += kReduceLanes) {
+    PRAGMA_OMP_SIMD
+    for (int l = 0; l < kReduceLanes; l++)
+      lanes[l] = OpType::update(lanes[l], OpType::op(x[i + l], extraParams), extraParams);
+  }
+
+  for (; i < length; i++) lanes[0] = OpType::update(lanes[0], OpType::op(x[i], extraParams), extraParams);
+
+  for (int width = kReduceLanes / 2; width > 0; width /= 2)
+    for (int l = 0; l < width; l++) lanes[l] = OpType::update(lanes[l], lanes[l + width], extraParams);
+
+  return lanes[0];
+}
+
+/**
+ * This method reduces contiguous span of any length: blocks of kReduceBlock elements are reduced by lanes, and
+ * their partial results are combined, with Kahan compensation for summing ops. Result isn't post-processed
+ */
+template <typename OpType, typename X, typename E>
+SD_INLINE AccumulatorType<OpType, X, E> reduceContiguous(const X *x, LongType length, E *extraParams) {
+  using Acc = AccumulatorType<OpType, X, E>;
+  if (length <= kReduceBlock) return reduceLanes<OpType, X, E>(x, length, extraParams);
+
+  PartialCombiner<OpType, Acc> combiner(static_cast<Acc>(OpType::startingValue(x)));
+  for (LongType i = 0; i < length; i += kReduceBlock)
+    combiner.add(reduceLanes<OpType, X, E>(x + i, math::sd_min<LongType>(kReduceBlock, length - i), extraParams),
+                 extraParams);
+
+  return combiner.result();
+}
+
+/**
+ * This method reduces contiguous span split between threads, partial results of threads are combined the same way
+ * as blocks. Result isn't post-processed
+ */
+template <typename OpType, typename X, typename E>
+AccumulatorType<OpType, X, E> reduceContiguousParallel(const X *x, LongType length, E *extraParams) {
+  using Acc = AccumulatorType<OpType, X, E>;
+  const Acc initial = static_cast<Acc>(OpType::startingValue(x));
+
+  int maxThreads = math::sd_min<int>(64, Environment::getInstance().maxThreads());
+  Acc intermediate[64];
+  for (int e = 0; e < maxThreads; e++) intermediate[e] = initial;
+
+  auto func = PRAGMA_THREADS_FOR {
+    intermediate[thread_id] = OpType::update(
+        intermediate[thread_id], reduceContiguous<OpType, X, E>(x + start, stop - start, extraParams), extraParams);
+  };
+  maxThreads = samediff::Threads::parallel_for(func, 0, length, 1, maxThreads, samediff::OpCostClass::REDUCTION);
+
+  PartialCombiner<OpType, Acc> combiner(intermediate[0]);
+  for (int e = 1; e < maxThreads; e++) combiner.add(intermediate[e], extraParams);
+
+  return combiner.result();
+}
+
+}  // namespace reductions
+}  // namespace sd
+
+#endif  // LIBND4J_REDUCTIONKERNELS_H
@@ -0,0 +1,56 @@
+/* ******************************************************************************
+ *
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ *  See the NOTICE file distributed with this work for additional
+ *  information regarding copyright ownership.
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ******************************************************************************/
+
+//
+// Copy between arrays of the same shape and data type, but arbitrary strides
+//
+
+#ifndef LIBND4J_STRIDEDCOPY_H
+#define LIBND4J_STRIDEDCOPY_H
+#include <system/common.h>
+
+namespace sd {
+
+/**
+ * This class copies data between arrays of the same shape and data type laid out with arbitrary strides,
+ * i.e. materializes permuted views (NCHW <-> NHWC, head splits etc).
+ *
+ * Dimensions are reordered along output strides, unit dimensions are dropped and dimensions contiguous
+ * in both arrays are merged. What's left is copied either as plain rows, or via blocked transpose between
+ * output-contiguous and input-contiguous dimensions, or via strided loop over innermost dimension.
+ * Work is split over outer blocks.
+ */
+class SD_LIB_EXPORT StridedCopy {
+ public:
+  /**
+   * This method copies x into z.
+   * Returns false if arrays have different shapes or data types, or data type isn't fixed-size,
+   * so caller should use generic path instead
+   */
+  static bool copy(const void *x, const LongType *xShapeInfo, void *z, const LongType *zShapeInfo,
+                   bool allowParallelism = true);
+
+  /**
+   * This method reorders, drops and merges dimensions of x/z pair as described above,
+   * strides are in elements. Returns new rank, which is 0 for single-element arrays
+   */
+  static int collapse(int rank, LongType *shape, LongType *xStrides, LongType *zStrides);
+};
+}  // namespace sd
+
+#endif  // LIBND4J_STRIDEDCOPY_H
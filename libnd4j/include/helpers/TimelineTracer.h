@@ -0,0 +1,155 @@
+/* ******************************************************************************
+ *
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ *  See the NOTICE file distributed with this work for additional
+ *  information regarding copyright ownership.
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ******************************************************************************/
+
+//
+// Per-thread timeline of native execution, exported as Chrome trace JSON
+//
+
+#ifndef LIBND4J_TIMELINETRACER_H
+#define LIBND4J_TIMELINETRACER_H
+#include <system/common.h>
+
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace sd {
+
+enum class TimelineCategory : int8_t {
+  OP = 0,
+  THREADS = 1,
+  MEMORY = 2,
+  SHAPES = 3,
+};
+
+struct TimelineEvent {
+  static const int MAX_NAME_LENGTH = 47;
+
+  char name[MAX_NAME_LENGTH + 1];
+  uint64_t start;
+  uint64_t duration;
+  // optional argument, -1 if absent: bytes for allocations, thread index for pool chunks, rank for shape misses
+  LongType arg;
+  int32_t thread;
+  TimelineCategory category;
+  // 'X' for spans, 'i' for instant events
+  char phase;
+};
+
+/**
+ * This class keeps timestamped spans and instant events of native execution: op calls, thread pool chunks and waits,
+ * allocations, workspace spills and shape cache misses.
+ *
+ * Every thread writes into its own ring buffer of fixed capacity, so oldest events are overwritten once buffer is
+ * full. Tracing is disabled by default; when it's disabled, instrumentation points cost single relaxed load.
+ * Result can be opened in chrome://tracing or Perfetto UI.
+ */
+class SD_LIB_EXPORT TimelineTracer {
+ private:
+  struct ThreadBuffer {
+    std::mutex lock;
+    std::vector<TimelineEvent> events;
+    uint64_t written = 0;
+    int32_t thread = 0;
+    std::atomic<bool> free{false};
+  };
+
+  friend struct TimelineBufferHandle;
+
+  static std::atomic<bool> _enabled;
+
+  std::mutex _lock;
+  std::vector<ThreadBuffer *> _buffers;
+  std::atomic<int> _capacity{65536};
+  std::atomic<int32_t> _threadCounter{0};
+  std::chrono::steady_clock::time_point _epoch;
+
+  TimelineTracer();
+
+  ThreadBuffer *localBuffer();
+  void releaseBuffer(ThreadBuffer *buffer);
+  void push(TimelineCategory category, const char *name, char phase, uint64_t start, uint64_t duration, LongType arg);
+
+ public:
+  ~TimelineTracer();
+
+  static TimelineTracer &getInstance();
+
+  static bool isEnabled() { return _enabled.load(std::memory_order_relaxed); }
+  static void setEnabled(bool enabled);
+
+  /**
+   * Number of events kept per thread. Applies to buffers created after this call
+   */
+  void setCapacity(int eventsPerThread);
+
+  /**
+   * Nanoseconds since tracer creation
+   */
+  uint64_t now();
+
+  void span(TimelineCategory category, const char *name, uint64_t start, uint64_t end, LongType arg = -1);
+  void instant(TimelineCategory category, const char *name, LongType arg = -1);
+
+  /**
+   * Events currently kept in all thread buffers
+   */
+  LongType numEvents();
+
+  /**
+   * This method drops all recorded events
+   */
+  void purge();
+
+  /**
+   * This method writes all recorded events as Chrome trace JSON, ordered by start time
+   */
+  void write(std::ostream &stream);
+  void save(const std::string &path);
+};
+
+/**
+ * RAII span, name must stay valid until span is destroyed
+ */
+class SD_LIB_EXPORT TimelineSpan {
+ private:
+  TimelineCategory _category;
+  const char *_name;
+  LongType _arg;
+  bool _enabled;
+  uint64_t _start = 0;
+
+ public:
+  TimelineSpan(TimelineCategory category, const char *name, LongType arg = -1)
+      : _category(category), _name(name), _arg(arg), _enabled(TimelineTracer::isEnabled()) {
+    if (_enabled) _start = TimelineTracer::getInstance().now();
+  }
+
+  ~TimelineSpan() {
+    if (_enabled) {
+      auto &tracer = TimelineTracer::getInstance();
+      tracer.span(_category, _name, _start, tracer.now(), _arg);
+    }
+  }
+};
+}  // namespace sd
+
+#endif  // LIBND4J_TIMELINETRACER_H
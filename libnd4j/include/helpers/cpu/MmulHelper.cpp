@@ -22,6 +22,7 @@
 //
 #include "../MmulHelper.h"
 
+#include <array/LayoutRequest.h>
 #include <array/NDArrayFactory.h>
 #include <exceptions/datatype_exception.h>
 #include <execution/Threads.h>
@@ -240,32 +241,19 @@ NDArray* MmulHelper::mmulMxM( NDArray* A,  NDArray* B, NDArray* C, const double
   if ((!typeFloat && !typeDouble) || !Environment::getInstance().isEnableBlas()) {
     BUILD_SINGLE_SELECTOR_THRICE(aType, usualGemm, (A, B, C, 0, 1, 0, 1, 0, 1, alpha, beta), SD_NUMERIC_TYPES);
   } else {
-    std::vector<NDArray*> toDelete;
+    // BLAS accepts any matrix with unit stride along one of dimensions, so copies are made only for other views
+    LayoutRequest aRequest(const_cast<NDArray*>(A), LayoutRequest::UNIT_STRIDE, false, 'f');
+    LayoutRequest bRequest(const_cast<NDArray*>(B), LayoutRequest::UNIT_STRIDE, false, 'f');
+    LayoutRequest cRequest(C, LayoutRequest::UNIT_STRIDE, true, 'f');
 
-    NDArray *pA(const_cast<NDArray*>(A)), *pB(const_cast<NDArray*>(B)), *pC(const_cast<NDArray*>(C));
+    NDArray *pA(aRequest.array()), *pB(bRequest.array()), *pC(cRequest.array());
 
-    bool aMcont = M == 1 || A->strideAt(0) == 1;
-    bool aKcont = K == 1 || A->strideAt(1) == 1;
-    bool bKcont = K == 1 || B->strideAt(0) == 1;
-    bool bNcont = N == 1 || B->strideAt(1) == 1;
-    bool cMcont = M == 1 || C->strideAt(0) == 1;
-    bool cNcont = N == 1 || C->strideAt(1) == 1;
-
-    if (!aMcont && !aKcont) {
-      pA = new NDArray(A->dup('f', false));
-      toDelete.push_back(pA);
-      aMcont = true;
-    }
-    if (!bKcont && !bNcont) {
-      pB = new NDArray(B->dup('f', false));
-      toDelete.push_back(pB);
-      bKcont = true;
-    }
-    if (!cMcont && !cNcont) {
-      pC = new NDArray(C->dup('f', false));
-      toDelete.push_back(pC);
-      cMcont = true;
-    }
+    bool aMcont = M == 1 || pA->strideAt(0) == 1;
+    bool aKcont = K == 1 || pA->strideAt(1) == 1;
+    bool bKcont = K == 1 || pB->strideAt(0) == 1;
+    bool bNcont = N == 1 || pB->strideAt(1) == 1;
+    bool cMcont = M == 1 || pC->strideAt(0) == 1;
+    bool cNcont = N == 1 || pC->strideAt(1) == 1;
 
     const CBLAS_ORDER blasOrder = cMcont ? CblasColMajor : CblasRowMajor;
 
@@ -289,13 +277,8 @@ NDArray* MmulHelper::mmulMxM( NDArray* A,  NDArray* B, NDArray* C, const double
                                         pC->bufferAsT<double>(), ldc);
     }
 
-    if (pC != C) {
-      C->assign(*pC);
-    }
-
-    for (auto* arr : toDelete) {
-      delete arr;
-    }
+    // copy of C, if any, is written back here
+    cRequest.release();
   }
 
   return C;
@@ -356,15 +339,11 @@ NDArray* MmulHelper::mmulMxV( NDArray* A, NDArray* X, sd::NDArray* Y, const doub
   if ((!typeDouble && !typeFloat) || !Environment::getInstance().isEnableBlas()) {
     BUILD_SINGLE_SELECTOR_THRICE(aType, usualGemv, (A, X, Y, incx, incy, 0, alpha, beta), SD_NUMERIC_TYPES);
   } else {
-    NDArray* pA(const_cast<NDArray*>(A));
+    LayoutRequest aRequest(const_cast<NDArray*>(A), LayoutRequest::UNIT_STRIDE, false, 'f');
+    NDArray* pA = aRequest.array();
 
-    bool aMcont = M == 1 || A->strideAt(0) == 1;
-    bool aNcont = N == 1 || A->strideAt(1) == 1;
-
-    if (!aMcont && !aNcont) {
-      pA = new NDArray(A->dup('f', false));
-      aMcont = true;
-    }
+    bool aMcont = M == 1 || pA->strideAt(0) == 1;
+    bool aNcont = N == 1 || pA->strideAt(1) == 1;
     const CBLAS_ORDER blasOrder = aMcont ? CblasColMajor : CblasRowMajor;
 
     const int lda = (aMcont && aNcont) ? M : !aMcont ? pA->strideAt(0) : pA->strideAt(1);
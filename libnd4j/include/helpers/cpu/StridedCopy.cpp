@@ -0,0 +1,329 @@
+/* ******************************************************************************
+ *
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ *  See the NOTICE file distributed with this work for additional
+ *  information regarding copyright ownership.
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ******************************************************************************/
+
+//
+// Copy between arrays of the same shape and data type, but arbitrary strides
+//
+#ifndef __CUDABLAS__
+#include <array/ArrayOptions.h>
+#include <array/DataTypeUtils.h>
+#include <execution/Threads.h>
+#include <helpers/StridedCopy.h>
+#include <helpers/shape.h>
+
+#include <cstring>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+// transpose tile side, and number of elements per work item for row and strided copies
+#define STRIDED_COPY_TILE 32
+#define STRIDED_COPY_CHUNK 16384
+#define STRIDED_COPY_THREAD_LENGTH 32768
+
+namespace sd {
+
+namespace {
+
+struct CopyPlan {
+  int rank;
+  LongType shape[SD_MAX_RANK];
+  LongType xStrides[SD_MAX_RANK];
+  LongType zStrides[SD_MAX_RANK];
+
+  // dimensions iterated over by work items, in order from outer to inner
+  int numOuter;
+  int outer[SD_MAX_RANK];
+};
+
+// evaluates offsets of first element of given outer block
+SD_INLINE void outerOffsets(const CopyPlan &plan, LongType index, LongType &xOffset, LongType &zOffset) {
+  xOffset = 0;
+  zOffset = 0;
+  for (int e = plan.numOuter - 1; e >= 0; e--) {
+    const auto dim = plan.outer[e];
+    const auto coord = index % plan.shape[dim];
+    index /= plan.shape[dim];
+    xOffset += coord * plan.xStrides[dim];
+    zOffset += coord * plan.zStrides[dim];
+  }
+}
+
+SD_INLINE LongType outerLength(const CopyPlan &plan) {
+  LongType length = 1;
+  for (int e = 0; e < plan.numOuter; e++) length *= plan.shape[plan.outer[e]];
+
+  return length;
+}
+
+#if defined(__AVX2__)
+// z[j * zStride + i] = x[i * xStride + j] for 8x8 block of 32-bit elements
+SD_INLINE void transpose8x8(const uint32_t *x, LongType xStride, uint32_t *z, LongType zStride) {
+  __m256 r0 = _mm256_loadu_ps(reinterpret_cast<const float *>(x));
+  __m256 r1 = _mm256_loadu_ps(reinterpret_cast<const float *>(x + xStride));
+  __m256 r2 = _mm256_loadu_ps(reinterpret_cast<const float *>(x + 2 * xStride));
+  __m256 r3 = _mm256_loadu_ps(reinterpret_cast<const float *>(x + 3 * xStride));
+  __m256 r4 = _mm256_loadu_ps(reinterpret_cast<const float *>(x + 4 * xStride));
+  __m256 r5 = _mm256_loadu_ps(reinterpret_cast<const float *>(x + 5 * xStride));
+  __m256 r6 = _mm256_loadu_ps(reinterpret_cast<const float *>(x + 6 * xStride));
+  __m256 r7 = _mm256_loadu_ps(reinterpret_cast<const float *>(x + 7 * xStride));
+
+  const __m256 t0 = _mm256_unpacklo_ps(r0, r1);
+  const __m256 t1 = _mm256_unpackhi_ps(r0, r1);
+  const __m256 t2 = _mm256_unpacklo_ps(r2, r3);
+  const __m256 t3 = _mm256_unpackhi_ps(r2, r3);
+  const __m256 t4 = _mm256_unpacklo_ps(r4, r5);
+  const __m256 t5 = _mm256_unpackhi_ps(r4, r5);
+  const __m256 t6 = _mm256_unpacklo_ps(r6, r7);
+  const __m256 t7 = _mm256_unpackhi_ps(r6, r7);
+
+  const __m256 s0 = _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(1, 0, 1, 0));
+  const __m256 s1 = _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(3, 2, 3, 2));
+  const __m256 s2 = _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(1, 0, 1, 0));
+  const __m256 s3 = _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(3, 2, 3, 2));
+  const __m256 s4 = _mm256_shuffle_ps(t4, t6, _MM_SHUFFLE(1, 0, 1, 0));
+  const __m256 s5 = _mm256_shuffle_ps(t4, t6, _MM_SHUFFLE(3, 2, 3, 2));
+  const __m256 s6 = _mm256_shuffle_ps(t5, t7, _MM_SHUFFLE(1, 0, 1, 0));
+  const __m256 s7 = _mm256_shuffle_ps(t5, t7, _MM_SHUFFLE(3, 2, 3, 2));
+
+  r0 = _mm256_permute2f128_ps(s0, s4, 0x20);
+  r1 = _mm256_permute2f128_ps(s1, s5, 0x20);
+  r2 = _mm256_permute2f128_ps(s2, s6, 0x20);
+  r3 = _mm256_permute2f128_ps(s3, s7, 0x20);
+  r4 = _mm256_permute2f128_ps(s0, s4, 0x31);
+  r5 = _mm256_permute2f128_ps(s1, s5, 0x31);
+  r6 = _mm256_permute2f128_ps(s2, s6, 0x31);
+  r7 = _mm256_permute2f128_ps(s3, s7, 0x31);
+
+  _mm256_storeu_ps(reinterpret_cast<float *>(z), r0);
+  _mm256_storeu_ps(reinterpret_cast<float *>(z + zStride), r1);
+  _mm256_storeu_ps(reinterpret_cast<float *>(z + 2 * zStride), r2);
+  _mm256_storeu_ps(reinterpret_cast<float *>(z + 3 * zStride), r3);
+  _mm256_storeu_ps(reinterpret_cast<float *>(z + 4 * zStride), r4);
+  _mm256_storeu_ps(reinterpret_cast<float *>(z + 5 * zStride), r5);
+  _mm256_storeu_ps(reinterpret_cast<float *>(z + 6 * zStride), r6);
+  _mm256_storeu_ps(reinterpret_cast<float *>(z + 7 * zStride), r7);
+}
+
+// z[j * zStride + i] = x[i * xStride + j] for 4x4 block of 64-bit elements
+SD_INLINE void transpose4x4(const uint64_t *x, LongType xStride, uint64_t *z, LongType zStride) {
+  const __m256d r0 = _mm256_loadu_pd(reinterpret_cast<const double *>(x));
+  const __m256d r1 = _mm256_loadu_pd(reinterpret_cast<const double *>(x + xStride));
+  const __m256d r2 = _mm256_loadu_pd(reinterpret_cast<const double *>(x + 2 * xStride));
+  const __m256d r3 = _mm256_loadu_pd(reinterpret_cast<const double *>(x + 3 * xStride));
+
+  const __m256d t0 = _mm256_unpacklo_pd(r0, r1);
+  const __m256d t1 = _mm256_unpackhi_pd(r0, r1);
+  const __m256d t2 = _mm256_unpacklo_pd(r2, r3);
+  const __m256d t3 = _mm256_unpackhi_pd(r2, r3);
+
+  _mm256_storeu_pd(reinterpret_cast<double *>(z), _mm256_permute2f128_pd(t0, t2, 0x20));
+  _mm256_storeu_pd(reinterpret_cast<double *>(z + zStride), _mm256_permute2f128_pd(t1, t3, 0x20));
+  _mm256_storeu_pd(reinterpret_cast<double *>(z + 2 * zStride), _mm256_permute2f128_pd(t0, t2, 0x31));
+  _mm256_storeu_pd(reinterpret_cast<double *>(z + 3 * zStride), _mm256_permute2f128_pd(t1, t3, 0x31));
+}
+#endif
+
+// z[a * zStride + b] = x[b * xStride + a], for a < numA and b < numB
+template <typename T>
+static void transposeTile(const T *x, LongType xStride, T *z, LongType zStride, LongType numA, LongType numB) {
+  LongType b = 0;
+#if defined(__AVX2__)
+  if (sizeof(T) == 4 || sizeof(T) == 8) {
+    constexpr LongType block = sizeof(T) == 4 ? 8 : 4;
+    for (; b + block <= numB; b += block) {
+      LongType a = 0;
+      for (; a + block <= numA; a += block) {
+        if (sizeof(T) == 4)
+          transpose8x8(reinterpret_cast<const uint32_t *>(x + b * xStride + a), xStride,
+                       reinterpret_cast<uint32_t *>(z + a * zStride + b), zStride);
+        else
+          transpose4x4(reinterpret_cast<const uint64_t *>(x + b * xStride + a), xStride,
+                       reinterpret_cast<uint64_t *>(z + a * zStride + b), zStride);
+      }
+
+      for (; a < numA; a++)
+        for (LongType i = b; i < b + block; i++) z[a * zStride + i] = x[i * xStride + a];
+    }
+  }
+#endif
+
+  if (b < numB)
+    for (LongType a = 0; a < numA; a++)
+      for (LongType i = b; i < numB; i++) z[a * zStride + i] = x[i * xStride + a];
+}
+
+template <typename T>
+static void copyRows(const T *x, T *z, const CopyPlan &plan, LongType start, LongType stop) {
+  const auto inner = plan.shape[plan.rank - 1];
+  const auto chunks = (inner + STRIDED_COPY_CHUNK - 1) / STRIDED_COPY_CHUNK;
+
+  for (auto item = start; item < stop; item++) {
+    LongType xOffset, zOffset;
+    outerOffsets(plan, item / chunks, xOffset, zOffset);
+
+    const auto first = (item % chunks) * STRIDED_COPY_CHUNK;
+    const auto length = sd::math::sd_min<LongType>(STRIDED_COPY_CHUNK, inner - first);
+    std::memcpy(z + zOffset + first, x + xOffset + first, length * sizeof(T));
+  }
+}
+
+template <typename T>
+static void copyStrided(const T *x, T *z, const CopyPlan &plan, LongType start, LongType stop) {
+  const auto inner = plan.shape[plan.rank - 1];
+  const auto xStride = plan.xStrides[plan.rank - 1];
+  const auto zStride = plan.zStrides[plan.rank - 1];
+  const auto chunks = (inner + STRIDED_COPY_CHUNK - 1) / STRIDED_COPY_CHUNK;
+
+  for (auto item = start; item < stop; item++) {
+    LongType xOffset, zOffset;
+    outerOffsets(plan, item / chunks, xOffset, zOffset);
+
+    const auto first = (item % chunks) * STRIDED_COPY_CHUNK;
+    const auto last = sd::math::sd_min<LongType>(first + STRIDED_COPY_CHUNK, inner);
+    auto xPtr = x + xOffset;
+    auto zPtr = z + zOffset;
+    for (LongType i = first; i < last; i++) zPtr[i * zStride] = xPtr[i * xStride];
+  }
+}
+
+// dimA is contiguous in x, last dimension is contiguous in z
+template <typename T>
+static void copyTransposed(const T *x, T *z, const CopyPlan &plan, int dimA, LongType start, LongType stop) {
+  const int dimB = plan.rank - 1;
+  const auto lenA = plan.shape[dimA];
+  const auto lenB = plan.shape[dimB];
+  const auto xStride = plan.xStrides[dimB];
+  const auto zStride = plan.zStrides[dimA];
+  const auto tilesA = (lenA + STRIDED_COPY_TILE - 1) / STRIDED_COPY_TILE;
+  const auto tilesB = (lenB + STRIDED_COPY_TILE - 1) / STRIDED_COPY_TILE;
+
+  for (auto item = start; item < stop; item++) {
+    LongType xOffset, zOffset;
+    outerOffsets(plan, item / (tilesA * tilesB), xOffset, zOffset);
+
+    const auto tile = item % (tilesA * tilesB);
+    const auto a = (tile / tilesB) * STRIDED_COPY_TILE;
+    const auto b = (tile % tilesB) * STRIDED_COPY_TILE;
+
+    transposeTile<T>(x + xOffset + b * xStride + a, xStride, z + zOffset + a * zStride + b, zStride,
+                     sd::math::sd_min<LongType>(STRIDED_COPY_TILE, lenA - a),
+                     sd::math::sd_min<LongType>(STRIDED_COPY_TILE, lenB - b));
+  }
+}
+
+template <typename T>
+static void copyPlan(const void *vx, void *vz, CopyPlan &plan, LongType length, bool allowParallelism) {
+  auto x = reinterpret_cast<const T *>(vx);
+  auto z = reinterpret_cast<T *>(vz);
+
+  if (plan.rank == 0) {
+    z[0] = x[0];
+    return;
+  }
+
+  const int inner = plan.rank - 1;
+
+  // dimension contiguous in x, other than innermost one
+  int dimA = -1;
+  if (plan.zStrides[inner] == 1 && plan.xStrides[inner] != 1)
+    for (int e = 0; e < inner; e++)
+      if (plan.xStrides[e] == 1) dimA = e;
+
+  plan.numOuter = 0;
+  for (int e = 0; e < inner; e++)
+    if (e != dimA) plan.outer[plan.numOuter++] = e;
+
+  LongType numItems = outerLength(plan);
+  if (dimA >= 0)
+    numItems *= ((plan.shape[dimA] + STRIDED_COPY_TILE - 1) / STRIDED_COPY_TILE) *
+                ((plan.shape[inner] + STRIDED_COPY_TILE - 1) / STRIDED_COPY_TILE);
+  else
+    numItems *= (plan.shape[inner] + STRIDED_COPY_CHUNK - 1) / STRIDED_COPY_CHUNK;
+
+  const bool rows = plan.xStrides[inner] == 1 && plan.zStrides[inner] == 1;
+  auto func = PRAGMA_THREADS_FOR {
+    if (dimA >= 0)
+      copyTransposed<T>(x, z, plan, dimA, start, stop);
+    else if (rows)
+      copyRows<T>(x, z, plan, start, stop);
+    else
+      copyStrided<T>(x, z, plan, start, stop);
+  };
+
+  const int numThreads =
+      allowParallelism ? sd::math::sd_max<LongType>(
+                             1, sd::math::sd_min<LongType>(length / STRIDED_COPY_THREAD_LENGTH,
+                                                           Environment::getInstance().maxMasterThreads()))
+                       : 1;
+
+  if (numThreads > 1 && numItems > 1)
+    samediff::Threads::parallel_for(func, 0, numItems, 1, numThreads);
+  else
+    func(0, 0, numItems, 1);
+}
+}  // namespace
+
+int StridedCopy::collapse(int rank, LongType *shape, LongType *xStrides, LongType *zStrides) {
+  // dimensions are ordered along z strides, so output is written sequentially
+  LongType *strides[] = {zStrides, xStrides};
+  return shape::collapseDimensions(rank, shape, strides, 2);
+}
+
+bool StridedCopy::copy(const void *x, const LongType *xShapeInfo, void *z, const LongType *zShapeInfo,
+                       bool allowParallelism) {
+  const auto dataType = ArrayOptions::dataType(xShapeInfo);
+  if (dataType != ArrayOptions::dataType(zShapeInfo) || DataTypeUtils::isS(dataType)) return false;
+
+  if (shape::isEmptyConst(xShapeInfo) || shape::isEmptyConst(zShapeInfo) ||
+      !shape::equalsSoft(xShapeInfo, zShapeInfo))
+    return false;
+
+  const auto length = shape::length(zShapeInfo);
+  if (length < 1) return false;
+
+  CopyPlan plan;
+  plan.rank = shape::rank(zShapeInfo);
+  for (int e = 0; e < plan.rank; e++) {
+    plan.shape[e] = shape::sizeAt(zShapeInfo, e);
+    plan.xStrides[e] = shape::strideAt(xShapeInfo, e);
+    plan.zStrides[e] = shape::strideAt(zShapeInfo, e);
+  }
+
+  plan.rank = collapse(plan.rank, plan.shape, plan.xStrides, plan.zStrides);
+
+  switch (DataTypeUtils::sizeOfElement(dataType)) {
+    case 1:
+      copyPlan<uint8_t>(x, z, plan, length, allowParallelism);
+      return true;
+    case 2:
+      copyPlan<uint16_t>(x, z, plan, length, allowParallelism);
+      return true;
+    case 4:
+      copyPlan<uint32_t>(x, z, plan, length, allowParallelism);
+      return true;
+    case 8:
+      copyPlan<uint64_t>(x, z, plan, length, allowParallelism);
+      return true;
+    default:
+      return false;
+  }
+}
+}  // namespace sd
+#endif
@@ -26,6 +26,7 @@
 #ifndef LIBND4J_ATTENTIONHELPER_CPP
 #define LIBND4J_ATTENTIONHELPER_CPP
 #include "../AttentionHelper.h"
+#include <array/LayoutRequest.h>
 #include <indexing/NDIndexUtils.h>
 #include <helpers/AttentionHelper.h>
 #include <ops/declarable/CustomOperations.h>
@@ -43,12 +44,15 @@ NDArray AttentionHelper::multiHeadProject(NDArray *input, NDArray *projectionMat
 
   std::vector<sd::LongType> epsPermVec = {1, 0,2};
   auto inputPerm = input->permute(epsPermVec, false, false);  //[batch, nIn, timeSteps] -> [nIn, batch, timeSteps]
+  // reshapes below are views, c-ordered copies are made only for arrays which aren't in that layout already
+  LayoutRequest inputRequest(&inputPerm, LayoutRequest::C_ORDER);
   std::vector<sd::LongType> inputPermShape = {input->sizeAt(1), (miniBatchSize * seqLength)};
-  auto inputPrep = inputPerm.reshape('c', inputPermShape);  //[nIn, batch*timeSteps]
+  auto inputPrep = inputRequest.array()->reshape('c', inputPermShape, false);  //[nIn, batch*timeSteps]
+  LayoutRequest projectionRequest(projectionMatrix, LayoutRequest::C_ORDER);
   std::vector<sd::LongType> projectionMatrixShape = {numHeads * projectionMatrix->sizeAt(1), projectionMatrix->sizeAt(2)};
-  auto projectionPrep = projectionMatrix->reshape(
+  auto projectionPrep = projectionRequest.array()->reshape(
       'c',
-      projectionMatrixShape);  //[nHeads, hS, nIn] -> [nHeads*hS, nIn]
+      projectionMatrixShape, false);  //[nHeads, hS, nIn] -> [nHeads*hS, nIn]
 
   std::vector<LongType> projectedShape = {numHeads * projectionMatrix->sizeAt(1), (miniBatchSize * seqLength)};
   NDArray projected('c',projectedShape, input->dataType(),
@@ -450,16 +454,20 @@ void AttentionHelper::multiHeadProjectBp(NDArray *input, NDArray *projectionMatr
 
   std::vector<sd::LongType> epsPermVec = {1, 2, 0, 3};
   auto epsPerm = eps->permute(epsPermVec, false, false);
+  // reshapes below are views, c-ordered copies are made only for arrays which aren't in that layout already
+  LayoutRequest epsRequest(&epsPerm, LayoutRequest::C_ORDER);
   std::vector<sd::LongType> epsReshapeVec = {numHeads * projectedSize, miniBatchSize * seqLength};
-  auto epsReshaped = epsPerm.reshape('c', epsReshapeVec);
+  auto epsReshaped = epsRequest.array()->reshape('c', epsReshapeVec, false);
 
   std::vector<sd::LongType> inputPermVec = {1, 0, 2};
   auto inputPerm = input->permute(inputPermVec, false, false);
+  LayoutRequest inputRequest(&inputPerm, LayoutRequest::C_ORDER);
   std::vector<sd::LongType> inputPermShape = {input->sizeAt(1), miniBatchSize * seqLength};
-  auto inputPrep = inputPerm.reshape('c',inputPermShape,false);
+  auto inputPrep = inputRequest.array()->reshape('c',inputPermShape,false);
+  LayoutRequest projectionRequest(projectionMatrix, LayoutRequest::C_ORDER);
   std::vector<sd::LongType> projectionMatrixShape = {numHeads * projectionMatrix->sizeAt(1), projectionMatrix->sizeAt(2)};
   auto projectionPrep =
-      projectionMatrix->reshape('c', projectionMatrixShape);
+      projectionRequest.array()->reshape('c', projectionMatrixShape, false);
 
   ops::matmul_bp mmulBp;
   NDArray dLdProjectionPrep(projectionPrep.shapeInfo(), false, context);
@@ -0,0 +1,241 @@
+/* ******************************************************************************
+ *
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ *  See the NOTICE file distributed with this work for additional
+ *  information regarding copyright ownership.
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ******************************************************************************/
+
+//
+// Timing harness for OpBenchmark instances: warmup, percentiles, throughput, thread sweeps and JSON/CSV reports
+//
+#include <helpers/BenchmarkHelper.h>
+#include <helpers/logger.h>
+#include <system/Environment.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <memory>
+#include <sstream>
+
+namespace sd {
+double BenchmarkResult::gigabytesPerSecond() const { return p50 > 0.0 ? bytes / (p50 * 1e3) : 0.0; }
+
+double BenchmarkResult::gigaflopsPerSecond() const { return p50 > 0.0 ? flops / (p50 * 1e3) : 0.0; }
+
+std::vector<BenchmarkPoint> BenchmarkGrid::points() const {
+  std::vector<BenchmarkPoint> result;
+  std::vector<std::vector<LongType>> axesOrNone = axes;
+  if (axesOrNone.empty()) axesOrNone.emplace_back();
+
+  for (const auto &shape : shapes)
+    for (auto dataType : dataTypes)
+      for (auto order : orders)
+        for (const auto &axis : axesOrNone) {
+          BenchmarkPoint point;
+          point.shape = shape;
+          point.dataType = dataType;
+          point.order = order;
+          point.axis = axis;
+          result.emplace_back(point);
+        }
+
+  return result;
+}
+
+BenchmarkHelper::BenchmarkHelper(int warmup, int iterations, const std::vector<int> &threads)
+    : _warmup(warmup), _iterations(iterations), _threads(threads) {
+  if (warmup < 0) THROW_EXCEPTION("BenchmarkHelper: number of warmup iterations can't be negative");
+
+  if (iterations < 1) THROW_EXCEPTION("BenchmarkHelper: number of iterations should be positive");
+
+  for (auto t : threads)
+    if (t < 1) THROW_EXCEPTION("BenchmarkHelper: number of threads should be positive");
+}
+
+double BenchmarkHelper::percentile(const std::vector<double> &sorted, double q) {
+  if (sorted.empty()) return 0.0;
+
+  auto position = q * (sorted.size() - 1);
+  auto lower = static_cast<size_t>(std::floor(position));
+  auto upper = std::min(lower + 1, sorted.size() - 1);
+  auto fraction = position - lower;
+
+  return sorted[lower] + (sorted[upper] - sorted[lower]) * fraction;
+}
+
+BenchmarkResult BenchmarkHelper::summarize(OpBenchmark &benchmark, std::vector<double> &timings, int threads) {
+  std::sort(timings.begin(), timings.end());
+
+  BenchmarkResult result;
+  result.name = benchmark.testName();
+  result.dataType = benchmark.dataType();
+  result.shape = benchmark.shape();
+  result.orders = benchmark.orders();
+  result.strides = benchmark.strides();
+  result.axis = benchmark.axis();
+  result.inplace = benchmark.inplace();
+  result.extra = benchmark.extra();
+  result.threads = threads;
+  result.iterations = static_cast<int>(timings.size());
+  result.bytes = benchmark.bytesMoved();
+  result.flops = benchmark.flops();
+
+  if (timings.empty()) return result;
+
+  double sum = 0.0;
+  for (auto t : timings) sum += t;
+
+  result.mean = sum / timings.size();
+
+  double squares = 0.0;
+  for (auto t : timings) squares += (t - result.mean) * (t - result.mean);
+
+  result.stdev = std::sqrt(squares / timings.size());
+  result.min = timings.front();
+  result.max = timings.back();
+  result.p50 = percentile(timings, 0.50);
+  result.p90 = percentile(timings, 0.90);
+  result.p99 = percentile(timings, 0.99);
+
+  return result;
+}
+
+std::vector<BenchmarkResult> BenchmarkHelper::run(OpBenchmark &benchmark) {
+  auto &env = Environment::getInstance();
+  auto originalThreads = env.maxThreads();
+  auto originalMasterThreads = env.maxMasterThreads();
+
+  std::vector<int> sweep = _threads;
+  if (sweep.empty()) sweep.emplace_back(originalMasterThreads);
+
+  std::vector<BenchmarkResult> results;
+  std::vector<double> timings(_iterations);
+
+  for (auto threads : sweep) {
+    env.setMaxThreads(threads);
+    env.setMaxMasterThreads(threads);
+    omp_set_num_threads(threads);
+
+    try {
+      for (int e = 0; e < _warmup; e++) benchmark.executeOnce();
+
+      for (int e = 0; e < _iterations; e++) {
+        auto timeStart = std::chrono::high_resolution_clock::now();
+        benchmark.executeOnce();
+        auto timeEnd = std::chrono::high_resolution_clock::now();
+
+        timings[e] = std::chrono::duration<double, std::micro>(timeEnd - timeStart).count();
+      }
+    } catch (...) {
+      env.setMaxThreads(originalThreads);
+      env.setMaxMasterThreads(originalMasterThreads);
+      omp_set_num_threads(originalThreads);
+      throw;
+    }
+
+    auto sorted = timings;
+    results.emplace_back(summarize(benchmark, sorted, threads));
+    sd_debug("BenchmarkHelper: %s with %i threads, p50: %f us\n", benchmark.testName().c_str(), threads,
+             results.back().p50);
+  }
+
+  env.setMaxThreads(originalThreads);
+  env.setMaxMasterThreads(originalMasterThreads);
+  omp_set_num_threads(originalThreads);
+
+  return results;
+}
+
+std::vector<BenchmarkResult> BenchmarkHelper::run(const BenchmarkGrid &grid, const BenchmarkGenerator &generator) {
+  std::vector<BenchmarkResult> results;
+  for (const auto &point : grid.points()) {
+    std::unique_ptr<OpBenchmark> benchmark(generator(point));
+    if (benchmark == nullptr) continue;
+
+    if (!point.axis.empty()) benchmark->setAxis(point.axis);
+
+    auto partial = run(*benchmark);
+    results.insert(results.end(), partial.begin(), partial.end());
+  }
+
+  return results;
+}
+
+static std::string escapeJson(const std::string &value) {
+  std::string result;
+  for (auto c : value) {
+    if (c == '"' || c == '\\')
+      result += '\\';
+    else if (c == '\n') {
+      result += "\\n";
+      continue;
+    }
+
+    result += c;
+  }
+
+  return result;
+}
+
+static std::string escapeCsv(const std::string &value) {
+  if (value.find_first_of(",\"\n") == std::string::npos) return value;
+
+  std::string result = "\"";
+  for (auto c : value) {
+    if (c == '"') result += '"';
+
+    result += c;
+  }
+
+  return result + "\"";
+}
+
+std::string BenchmarkHelper::toJson(const std::vector<BenchmarkResult> &results) {
+  std::stringstream stream;
+  stream << "[\n";
+  for (size_t e = 0; e < results.size(); e++) {
+    const auto &r = results[e];
+    stream << "  {\"name\": \"" << escapeJson(r.name) << "\", \"dtype\": \"" << escapeJson(r.dataType)
+           << "\", \"shape\": \"" << escapeJson(r.shape) << "\", \"orders\": \"" << escapeJson(r.orders)
+           << "\", \"strides\": \"" << escapeJson(r.strides) << "\", \"axis\": \"" << escapeJson(r.axis)
+           << "\", \"inplace\": \"" << escapeJson(r.inplace) << "\", \"extra\": \"" << escapeJson(r.extra)
+           << "\", \"threads\": " << r.threads << ", \"iterations\": " << r.iterations << ", \"mean_us\": " << r.mean
+           << ", \"stdev_us\": " << r.stdev << ", \"min_us\": " << r.min << ", \"p50_us\": " << r.p50
+           << ", \"p90_us\": " << r.p90 << ", \"p99_us\": " << r.p99 << ", \"max_us\": " << r.max
+           << ", \"bytes\": " << r.bytes << ", \"flops\": " << r.flops << ", \"gbps\": " << r.gigabytesPerSecond()
+           << ", \"gflops\": " << r.gigaflopsPerSecond() << "}" << (e + 1 < results.size() ? "," : "") << "\n";
+  }
+  stream << "]\n";
+
+  return stream.str();
+}
+
+std::string BenchmarkHelper::toCsv(const std::vector<BenchmarkResult> &results) {
+  std::stringstream stream;
+  stream << "name,dtype,shape,orders,strides,axis,inplace,extra,threads,iterations,mean_us,stdev_us,min_us,p50_us,"
+            "p90_us,p99_us,max_us,bytes,flops,gbps,gflops\n";
+
+  for (const auto &r : results) {
+    stream << escapeCsv(r.name) << "," << escapeCsv(r.dataType) << "," << escapeCsv(r.shape) << ","
+           << escapeCsv(r.orders) << "," << escapeCsv(r.strides) << "," << escapeCsv(r.axis) << ","
+           << escapeCsv(r.inplace) << "," << escapeCsv(r.extra) << "," << r.threads << "," << r.iterations << ","
+           << r.mean << "," << r.stdev << "," << r.min << "," << r.p50 << "," << r.p90 << "," << r.p99 << "," << r.max
+           << "," << r.bytes << "," << r.flops << "," << r.gigabytesPerSecond() << "," << r.gigaflopsPerSecond()
+           << "\n";
+  }
+
+  return stream.str();
+}
+}  // namespace sd
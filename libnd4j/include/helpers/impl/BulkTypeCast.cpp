@@ -0,0 +1,297 @@
+/* ******************************************************************************
+ *
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ *  See the NOTICE file distributed with this work for additional
+ *  information regarding copyright ownership.
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ******************************************************************************/
+
+//
+// Bulk conversions between floating point types over contiguous buffers
+//
+#include <array/DataTypeUtils.h>
+#include <execution/Threads.h>
+#include <helpers/BulkTypeCast.h>
+#include <math/templatemath.h>
+
+#include <cstring>
+
+#if defined(__AVX512F__) || defined(__AVX2__) || defined(__F16C__) || defined(SD_F16C)
+#include <immintrin.h>
+#endif
+
+namespace sd {
+
+static_assert(sizeof(float16) == sizeof(uint16_t), "float16 is expected to be stored as 16 bit word");
+static_assert(sizeof(bfloat16) == sizeof(uint16_t), "bfloat16 is expected to be stored as 16 bit word");
+static_assert(sizeof(float8) == sizeof(uint8_t), "float8 is expected to be stored as single byte");
+
+// number of elements converted through single stack buffer, and minimal unit of work per thread
+static const LongType BULK_CAST_BLOCK = 1024;
+
+static SD_INLINE uint32_t floatBits(float f) {
+  uint32_t u;
+  memcpy(&u, &f, sizeof(u));
+  return u;
+}
+
+static SD_INLINE float bitsFloat(uint32_t u) {
+  float f;
+  memcpy(&f, &u, sizeof(f));
+  return f;
+}
+
+//////////////////////////////////////////////////////////////////////////
+// branchless scalar kernels: these are exact counterparts of cpu_float2ihalf_rn/cpu_ihalf2float and bfloat16
+// operators, written without data-dependent branches so compiler can vectorize them for any target
+
+static SD_INLINE uint16_t floatToHalfBits(float f) {
+  const uint32_t x = floatBits(f);
+  const uint32_t sign = (x >> 16) & 0x8000u;
+  const uint32_t u = x & 0x7fffffffu;
+
+  // subnormal results: let FPU do the rounding by aligning mantissa against 0.5
+  const float denormMagic = bitsFloat(126u << 23);
+  const uint32_t denorm = floatBits(bitsFloat(u) + denormMagic) - (126u << 23);
+
+  // normal results: rebias exponent and round to nearest even
+  const uint32_t odd = (u >> 13) & 1u;
+  const uint32_t normal = (u + (static_cast<uint32_t>(15 - 127) << 23) + 0xfffu + odd) >> 13;
+
+  uint32_t result = u < (113u << 23) ? denorm : normal;
+  result = u >= 0x477ff000u ? 0x7c00u : result;
+  result |= sign;
+
+  // NaN is always converted to canonical one
+  return static_cast<uint16_t>(u > 0x7f800000u ? 0x7fffu : result);
+}
+
+static SD_INLINE float halfBitsToFloat(uint16_t h) {
+  const uint32_t shiftedExp = 0x7c00u << 13;
+  const uint32_t magnitude = static_cast<uint32_t>(h & 0x7fffu) << 13;
+  const uint32_t exponent = magnitude & shiftedExp;
+  const uint32_t rebiased = magnitude + (static_cast<uint32_t>(127 - 15) << 23);
+
+  // subnormal inputs are renormalized through FPU
+  const uint32_t denorm = floatBits(bitsFloat(rebiased + (1u << 23)) - bitsFloat(113u << 23));
+
+  uint32_t result = exponent == 0 ? denorm : rebiased;
+  result = exponent == shiftedExp ? (magnitude == shiftedExp ? 0x7f800000u : 0x7fffffffu) : result;
+
+  // sign is dropped for NaN, same as cpu_ihalf2float does
+  const uint32_t sign = static_cast<uint32_t>(h & 0x8000u) << 16;
+  return bitsFloat(result == 0x7fffffffu ? result : (result | sign));
+}
+
+static SD_INLINE uint16_t floatToBfloat16Bits(float f) {
+  const uint32_t x = floatBits(f);
+  const uint32_t rounded = (x + 0x7fffu + ((x >> 16) & 1u)) >> 16;
+  const uint32_t qnan = (x >> 16) | 0x40u;
+  return static_cast<uint16_t>((x & 0x7fffffffu) > 0x7f800000u ? qnan : rounded);
+}
+
+static SD_INLINE float bfloat16BitsToFloat(uint16_t h) { return bitsFloat(static_cast<uint32_t>(h) << 16); }
+
+//////////////////////////////////////////////////////////////////////////
+void BulkTypeCast::floatToHalf(const float *x, float16 *z, LongType length) {
+  auto hz = reinterpret_cast<uint16_t *>(z);
+  LongType e = 0;
+#if defined(__AVX512F__)
+  for (; e + 16 <= length; e += 16)
+    _mm256_storeu_si256(reinterpret_cast<__m256i *>(hz + e),
+                        _mm512_cvtps_ph(_mm512_loadu_ps(x + e), _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC));
+#endif
+#if defined(__F16C__) || defined(SD_F16C)
+  for (; e + 8 <= length; e += 8)
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(hz + e),
+                     _mm256_cvtps_ph(_mm256_loadu_ps(x + e), _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC));
+#endif
+  PRAGMA_OMP_SIMD
+  for (LongType i = e; i < length; i++) hz[i] = floatToHalfBits(x[i]);
+}
+
+void BulkTypeCast::halfToFloat(const float16 *x, float *z, LongType length) {
+  auto hx = reinterpret_cast<const uint16_t *>(x);
+  LongType e = 0;
+#if defined(__AVX512F__)
+  for (; e + 16 <= length; e += 16)
+    _mm512_storeu_ps(z + e, _mm512_cvtph_ps(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(hx + e))));
+#endif
+#if defined(__F16C__) || defined(SD_F16C)
+  for (; e + 8 <= length; e += 8)
+    _mm256_storeu_ps(z + e, _mm256_cvtph_ps(_mm_loadu_si128(reinterpret_cast<const __m128i *>(hx + e))));
+#endif
+  PRAGMA_OMP_SIMD
+  for (LongType i = e; i < length; i++) z[i] = halfBitsToFloat(hx[i]);
+}
+
+void BulkTypeCast::floatToBfloat16(const float *x, bfloat16 *z, LongType length) {
+  // AVX512_BF16 vcvtneps2bf16 flushes denormals, so we stick to integer arithmetic to stay bit-exact
+  auto hz = reinterpret_cast<uint16_t *>(z);
+  LongType e = 0;
+#if defined(__AVX2__)
+  const __m256i bias = _mm256_set1_epi32(0x7fff);
+  const __m256i one = _mm256_set1_epi32(1);
+  const __m256i absMask = _mm256_set1_epi32(0x7fffffff);
+  const __m256i inf = _mm256_set1_epi32(0x7f800000);
+  const __m256i quiet = _mm256_set1_epi32(0x400000);
+  for (; e + 16 <= length; e += 16) {
+    __m256i r[2];
+    for (int p = 0; p < 2; p++) {
+      auto v = _mm256_castps_si256(_mm256_loadu_ps(x + e + p * 8));
+      auto lsb = _mm256_and_si256(_mm256_srli_epi32(v, 16), one);
+      auto rounded = _mm256_srli_epi32(_mm256_add_epi32(_mm256_add_epi32(v, bias), lsb), 16);
+      auto qnan = _mm256_srli_epi32(_mm256_or_si256(v, quiet), 16);
+      auto isNan = _mm256_cmpgt_epi32(_mm256_and_si256(v, absMask), inf);
+      r[p] = _mm256_blendv_epi8(rounded, qnan, isNan);
+    }
+
+    // packus works within 128 bit lanes, so lanes are reordered back afterwards
+    auto packed = _mm256_permute4x64_epi64(_mm256_packus_epi32(r[0], r[1]), 0xd8);
+    _mm256_storeu_si256(reinterpret_cast<__m256i *>(hz + e), packed);
+  }
+#endif
+  PRAGMA_OMP_SIMD
+  for (LongType i = e; i < length; i++) hz[i] = floatToBfloat16Bits(x[i]);
+}
+
+void BulkTypeCast::bfloat16ToFloat(const bfloat16 *x, float *z, LongType length) {
+  auto hx = reinterpret_cast<const uint16_t *>(x);
+  LongType e = 0;
+#if defined(__AVX2__)
+  for (; e + 8 <= length; e += 8) {
+    auto v = _mm256_cvtepu16_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i *>(hx + e)));
+    _mm256_storeu_ps(z + e, _mm256_castsi256_ps(_mm256_slli_epi32(v, 16)));
+  }
+#endif
+  PRAGMA_OMP_SIMD
+  for (LongType i = e; i < length; i++) z[i] = bfloat16BitsToFloat(hx[i]);
+}
+
+void BulkTypeCast::floatToFloat8(const float *x, float8 *z, LongType length) {
+  for (LongType e = 0; e < length; e++) z[e].data = cpu_float2quarter_rn(x[e]);
+}
+
+void BulkTypeCast::float8ToFloat(const float8 *x, float *z, LongType length) {
+  // there're only 256 possible inputs, so decoding is a table lookup
+  static const struct Float8Table {
+    float values[256];
+    Float8Table() {
+      for (int e = 0; e < 256; e++) {
+        quarter q;
+        q.x = static_cast<unsigned char>(e);
+        values[e] = cpu_quarter2float(q);
+      }
+    }
+  } table;
+
+  for (LongType e = 0; e < length; e++) z[e] = table.values[x[e].data.x];
+}
+
+//////////////////////////////////////////////////////////////////////////
+static bool isBulkType(DataType type) {
+  return type == FLOAT32 || type == DOUBLE || type == HALF || type == BFLOAT16 || type == FLOAT8;
+}
+
+static bool isNarrowType(DataType type) { return type == HALF || type == BFLOAT16 || type == FLOAT8; }
+
+// widens length elements of x into float buffer
+static void loadBlock(const void *x, DataType xType, LongType length, float *buffer) {
+  switch (xType) {
+    case DOUBLE: {
+      auto dx = reinterpret_cast<const double *>(x);
+      PRAGMA_OMP_SIMD
+      for (LongType e = 0; e < length; e++) buffer[e] = static_cast<float>(dx[e]);
+    } break;
+    case HALF:
+      BulkTypeCast::halfToFloat(reinterpret_cast<const float16 *>(x), buffer, length);
+      break;
+    case BFLOAT16:
+      BulkTypeCast::bfloat16ToFloat(reinterpret_cast<const bfloat16 *>(x), buffer, length);
+      break;
+    case FLOAT8:
+      BulkTypeCast::float8ToFloat(reinterpret_cast<const float8 *>(x), buffer, length);
+      break;
+    default:
+      memcpy(buffer, x, length * sizeof(float));
+  }
+}
+
+// narrows length elements of float buffer into z
+static void storeBlock(const float *buffer, LongType length, void *z, DataType zType) {
+  switch (zType) {
+    case DOUBLE: {
+      auto dz = reinterpret_cast<double *>(z);
+      PRAGMA_OMP_SIMD
+      for (LongType e = 0; e < length; e++) dz[e] = static_cast<double>(buffer[e]);
+    } break;
+    case HALF:
+      BulkTypeCast::floatToHalf(buffer, reinterpret_cast<float16 *>(z), length);
+      break;
+    case BFLOAT16:
+      BulkTypeCast::floatToBfloat16(buffer, reinterpret_cast<bfloat16 *>(z), length);
+      break;
+    case FLOAT8:
+      BulkTypeCast::floatToFloat8(buffer, reinterpret_cast<float8 *>(z), length);
+      break;
+    default:
+      memcpy(z, buffer, length * sizeof(float));
+  }
+}
+
+bool BulkTypeCast::canConvert(DataType from, DataType to) {
+  return from != to && isBulkType(from) && isBulkType(to) && (isNarrowType(from) || isNarrowType(to));
+}
+
+bool BulkTypeCast::convert(const void *x, DataType xType, void *z, DataType zType, LongType length,
+                           bool allowParallelism) {
+  if (!canConvert(xType, zType)) return false;
+
+  if (length <= 0) return true;
+
+  auto xSize = DataTypeUtils::sizeOfElement(xType);
+  auto zSize = DataTypeUtils::sizeOfElement(zType);
+  auto bx = reinterpret_cast<const int8_t *>(x);
+  auto bz = reinterpret_cast<int8_t *>(z);
+
+  auto func = PRAGMA_THREADS_FOR {
+    alignas(64) float buffer[BULK_CAST_BLOCK];
+
+    for (auto b = start; b < stop; b++) {
+      auto offset = b * BULK_CAST_BLOCK;
+      auto len = sd::math::sd_min<LongType>(BULK_CAST_BLOCK, length - offset);
+      auto src = bx + offset * xSize;
+      auto dst = bz + offset * zSize;
+
+      // float on either side means we can skip staging buffer
+      if (xType == FLOAT32) {
+        storeBlock(reinterpret_cast<const float *>(src), len, dst, zType);
+      } else if (zType == FLOAT32) {
+        loadBlock(src, xType, len, reinterpret_cast<float *>(dst));
+      } else {
+        loadBlock(src, xType, len, buffer);
+        storeBlock(buffer, len, dst, zType);
+      }
+    }
+  };
+
+  auto numBlocks = (length + BULK_CAST_BLOCK - 1) / BULK_CAST_BLOCK;
+  auto numThreads = allowParallelism ? sd::math::sd_max<LongType>(1, sd::math::sd_min<LongType>(
+                                                                          numBlocks / 16,
+                                                                          Environment::getInstance().maxMasterThreads()))
+                                     : 1;
+
+  samediff::Threads::parallel_for(func, 0, numBlocks, 1, numThreads);
+  return true;
+}
+}  // namespace sd
@@ -0,0 +1,264 @@
+/* ******************************************************************************
+ *
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ *  See the NOTICE file distributed with this work for additional
+ *  information regarding copyright ownership.
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ******************************************************************************/
+
+//
+// OpBenchmark implementation for DeclarableOps, legacy ops included via their Legacy*Op wrappers
+//
+#include <helpers/DeclarableBenchmark.h>
+#include <ops/declarable/LegacyBroadcastBoolOp.h>
+#include <ops/declarable/LegacyBroadcastOp.h>
+#include <ops/declarable/LegacyIndexReduceOp.h>
+#include <ops/declarable/LegacyPairwiseTransformBoolOp.h>
+#include <ops/declarable/LegacyPairwiseTransformOp.h>
+#include <ops/declarable/LegacyRandomOp.h>
+#include <ops/declarable/LegacyReduce3Op.h>
+#include <ops/declarable/LegacyReduceBoolOp.h>
+#include <ops/declarable/LegacyReduceFloatOp.h>
+#include <ops/declarable/LegacyReduceLongOp.h>
+#include <ops/declarable/LegacyReduceSameOp.h>
+#include <ops/declarable/LegacyScalarBoolOp.h>
+#include <ops/declarable/LegacyScalarOp.h>
+#include <ops/declarable/LegacyStatsOp.h>
+#include <ops/declarable/LegacyTransformAnyOp.h>
+#include <ops/declarable/LegacyTransformBoolOp.h>
+#include <ops/declarable/LegacyTransformFloatOp.h>
+#include <ops/declarable/LegacyTransformSameOp.h>
+#include <ops/declarable/LegacyTransformStrictOp.h>
+#include <ops/declarable/OpRegistrator.h>
+
+#include <algorithm>
+#include <sstream>
+
+namespace sd {
+template <typename T>
+static std::string joinValues(const std::vector<T> &values) {
+  std::stringstream stream;
+  stream << "[";
+  for (size_t e = 0; e < values.size(); e++) {
+    if (e > 0) stream << ",";
+    stream << values[e];
+  }
+  stream << "]";
+  return stream.str();
+}
+
+DeclarableBenchmark::DeclarableBenchmark(ops::DeclarableOp *op, std::string name, const std::vector<NDArray *> &inputs,
+                                         const std::vector<NDArray *> &outputs, const std::vector<double> &tArgs,
+                                         const std::vector<LongType> &iArgs, const std::vector<bool> &bArgs,
+                                         const std::vector<DataType> &dArgs, bool inplace)
+    : OpBenchmark(name, inputs.empty() ? nullptr : inputs[0], nullptr),
+      _op(op),
+      _inputs(inputs),
+      _outputs(outputs),
+      _tArgs(tArgs),
+      _iArgs(iArgs),
+      _bArgs(bArgs),
+      _dArgs(dArgs),
+      _inplace(inplace) {
+  if (op == nullptr) THROW_EXCEPTION("DeclarableBenchmark: op can't be null");
+
+  if (inputs.empty()) THROW_EXCEPTION("DeclarableBenchmark: at least one input is required");
+
+  if (inputs.size() > 1) _y = inputs[1];
+
+  if (_inplace) {
+    for (auto output : _outputs)
+      if (std::find(_inputs.begin(), _inputs.end(), output) == _inputs.end()) delete output;
+
+    _outputs = {_inputs[0]};
+  } else if (_outputs.empty()) {
+    // preallocating outputs once, so timed calls don't include allocations
+    auto result = _op->evaluate(_inputs, _tArgs, _iArgs, _bArgs, _dArgs);
+    if (result.status() != Status::OK)
+      THROW_EXCEPTION("DeclarableBenchmark: op failed during output shapes evaluation");
+
+    for (int e = 0; e < result.size(); e++) _outputs.emplace_back(new NDArray(result.at(e)->dup()));
+  }
+
+  _z = _outputs.empty() ? nullptr : _outputs[0];
+}
+
+DeclarableBenchmark::~DeclarableBenchmark() {
+  for (auto output : _outputs)
+    if (std::find(_inputs.begin(), _inputs.end(), output) == _inputs.end()) delete output;
+
+  for (auto input : _inputs) delete input;
+
+  if (_ownsOp) delete _op;
+}
+
+ops::DeclarableOp *DeclarableBenchmark::legacyOp(const std::string &opType, int opNum) {
+  if (opType == "transform_float") return new ops::LegacyTransformFloatOp(opNum);
+  if (opType == "transform_same") return new ops::LegacyTransformSameOp(opNum);
+  if (opType == "transform_strict") return new ops::LegacyTransformStrictOp(opNum);
+  if (opType == "transform_bool") return new ops::LegacyTransformBoolOp(opNum);
+  if (opType == "transform_any") return new ops::LegacyTransformAnyOp(opNum);
+  if (opType == "reduce_float") return new ops::LegacyReduceFloatOp(opNum);
+  if (opType == "reduce_same") return new ops::LegacyReduceSameOp(opNum);
+  if (opType == "reduce_long") return new ops::LegacyReduceLongOp(opNum);
+  if (opType == "reduce_bool") return new ops::LegacyReduceBoolOp(opNum);
+  if (opType == "reduce3") return new ops::LegacyReduce3Op(opNum);
+  if (opType == "index_reduce") return new ops::LegacyIndexReduceOp(opNum);
+  if (opType == "summarystats") return new ops::LegacyStatsOp(opNum);
+  if (opType == "scalar") return new ops::LegacyScalarOp(opNum);
+  if (opType == "scalar_bool") return new ops::LegacyScalarBoolOp(opNum);
+  if (opType == "pairwise") return new ops::LegacyPairwiseTransformOp(opNum);
+  if (opType == "pairwise_bool") return new ops::LegacyPairwiseTransformBoolOp(opNum);
+  if (opType == "broadcast") return new ops::LegacyBroadcastOp(opNum);
+  if (opType == "broadcast_bool") return new ops::LegacyBroadcastBoolOp(opNum);
+  if (opType == "random") return new ops::LegacyRandomOp(opNum);
+
+  std::string errorMessage;
+  errorMessage += "DeclarableBenchmark::legacyOp - unknown legacy op type: ";
+  errorMessage += opType;
+  THROW_EXCEPTION(errorMessage.c_str());
+}
+
+static NDArray *syntheticArray(const LongType *shapeInfo) {
+  auto array = new NDArray(const_cast<LongType *>(shapeInfo), ArrayOptions::dataType(shapeInfo), false);
+  if (array->isEmpty()) return array;
+
+  if (array->isR()) {
+    array->linspace(0.5, 1.0 / sd::math::sd_max<LongType>(1, array->lengthOf()));
+  } else {
+    array->nullify();
+  }
+
+  return array;
+}
+
+DeclarableBenchmark *DeclarableBenchmark::fromTrace(const ops::OpExecTrace &trace) {
+  if (trace.opName == nullptr || trace.inputShapeBuffers == nullptr || trace.inputShapeBuffers->empty())
+    return nullptr;
+
+  // legacy wrappers are all registered under the same name, so there's nothing to look up
+  auto name = *trace.opName;
+  if (name == "LegacyOp" || name == "unknown") return nullptr;
+
+  auto op = ops::OpRegistrator::getInstance().getOperation(name);
+  if (op == nullptr) return nullptr;
+
+  for (auto shapeInfo : *trace.inputShapeBuffers)
+    if (DataTypeUtils::isS(ArrayOptions::dataType(shapeInfo))) return nullptr;
+
+  std::vector<NDArray *> inputs;
+  for (auto shapeInfo : *trace.inputShapeBuffers) inputs.emplace_back(syntheticArray(shapeInfo));
+
+  std::vector<NDArray *> outputs;
+  if (trace.outputShapeBuffers != nullptr)
+    for (auto shapeInfo : *trace.outputShapeBuffers)
+      outputs.emplace_back(new NDArray(const_cast<LongType *>(shapeInfo), ArrayOptions::dataType(shapeInfo), false));
+
+  return new DeclarableBenchmark(op, name, inputs, outputs, trace.tArgs, trace.iArgs, trace.bArgs, trace.dArgs);
+}
+
+void DeclarableBenchmark::takeOwnership() { _ownsOp = true; }
+
+void DeclarableBenchmark::setFlops(double flops) { _flops = flops; }
+
+const std::vector<NDArray *> &DeclarableBenchmark::inputs() const { return _inputs; }
+
+const std::vector<NDArray *> &DeclarableBenchmark::outputs() const { return _outputs; }
+
+std::string DeclarableBenchmark::axis() { return _axis.empty() ? std::string("N/A") : joinValues(_axis); }
+
+std::string DeclarableBenchmark::orders() {
+  std::string result;
+  for (auto input : _inputs) result += input->ordering();
+
+  return result;
+}
+
+std::string DeclarableBenchmark::strides() {
+  std::string result;
+  for (size_t e = 0; e < _inputs.size(); e++) {
+    if (e > 0) result += "/";
+    result += ShapeUtils::strideAsString(_inputs[e]);
+  }
+
+  return result;
+}
+
+std::string DeclarableBenchmark::shape() {
+  std::string result;
+  for (size_t e = 0; e < _inputs.size(); e++) {
+    if (e > 0) result += "/";
+    result += ShapeUtils::shapeAsString(_inputs[e]);
+  }
+
+  return result;
+}
+
+std::string DeclarableBenchmark::inplace() { return _inplace ? "true" : "false"; }
+
+std::string DeclarableBenchmark::extra() {
+  std::string result;
+  if (!_tArgs.empty()) result += "tArgs=" + joinValues(_tArgs);
+
+  if (!_iArgs.empty()) result += (result.empty() ? "" : " ") + std::string("iArgs=") + joinValues(_iArgs);
+
+  return result.empty() ? OpBenchmark::extra() : result;
+}
+
+LongType DeclarableBenchmark::bytesMoved() {
+  LongType bytes = 0;
+  for (auto input : _inputs) bytes += input->lengthOf() * input->sizeOfT();
+
+  for (auto output : _outputs) bytes += output->lengthOf() * output->sizeOfT();
+
+  return bytes;
+}
+
+double DeclarableBenchmark::flops() {
+  if (_flops >= 0.0) return _flops;
+
+  LongType length = 0;
+  for (auto input : _inputs) length = sd::math::sd_max<LongType>(length, input->lengthOf());
+
+  for (auto output : _outputs) length = sd::math::sd_max<LongType>(length, output->lengthOf());
+
+  return static_cast<double>(length);
+}
+
+void DeclarableBenchmark::executeOnce() {
+  auto status = _op->execute(_inputs, _outputs, _tArgs, _iArgs, _bArgs, _dArgs, _inplace);
+  if (status != Status::OK) {
+    std::string errorMessage;
+    errorMessage += "DeclarableBenchmark: op execution failed for ";
+    errorMessage += _testName;
+    THROW_EXCEPTION(errorMessage.c_str());
+  }
+}
+
+OpBenchmark *DeclarableBenchmark::clone() {
+  std::vector<NDArray *> inputs;
+  for (auto input : _inputs) inputs.emplace_back(new NDArray(input->dup(input->ordering())));
+
+  // legacy ops are the only ones we own, and they're cheap to copy
+  auto legacy = _ownsOp ? dynamic_cast<ops::LegacyOp *>(_op) : nullptr;
+  auto op = legacy != nullptr ? legacy->clone() : _op;
+
+  auto result = new DeclarableBenchmark(op, _testName, inputs, {}, _tArgs, _iArgs, _bArgs, _dArgs, _inplace);
+  if (legacy != nullptr) result->takeOwnership();
+
+  result->setAxis(_axis);
+  result->setOpNum(_opNum);
+  result->setFlops(_flops);
+  return result;
+}
+}  // namespace sd
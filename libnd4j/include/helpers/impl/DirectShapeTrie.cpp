@@ -3,6 +3,7 @@
 #include <array/PrimaryPointerDeallocator.h>
 #include <array/DataType.h>
 #include <array/ArrayOptions.h>
+#include <helpers/TimelineTracer.h>
 #include <helpers/shape.h>
 #include <system/common.h>
 #include <memory>
@@ -234,6 +235,7 @@ ConstantShapeBuffer* DirectShapeTrie::getOrCreate(const LongType* shapeInfo) {
     }
     
     // Not found or not matching, need to create a new shape buffer
+    TimelineSpan timelineSpan(TimelineCategory::SHAPES, "shape_cache_miss", shape::rank(shapeInfo));
     ShapeTrieNode* current = _roots[stripeIdx].get();
     const int rank = shape::rank(shapeInfo);
     
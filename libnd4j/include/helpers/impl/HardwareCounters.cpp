@@ -0,0 +1,303 @@
+/* ******************************************************************************
+ *
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ *  See the NOTICE file distributed with this work for additional
+ *  information regarding copyright ownership.
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ******************************************************************************/
+
+//
+// Hardware performance counters sampled around op execution
+//
+#include <helpers/HardwareCounters.h>
+#include <helpers/logger.h>
+#include <helpers/shape.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <sstream>
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace sd {
+
+std::atomic<bool> HardwareCounters::_enabled(false);
+
+HardwareCounters &HardwareCounters::getInstance() {
+  static HardwareCounters instance;
+  return instance;
+}
+
+void HardwareCounters::setEnabled(bool enabled) { _enabled.store(enabled, std::memory_order_relaxed); }
+
+#if defined(__linux__)
+// counter group of single thread, closed when thread exits
+struct CounterGroup {
+  int fds[HardwareCounterValues::NUM_COUNTERS];
+  bool opened = false;
+  bool failed = false;
+
+  CounterGroup() { std::fill(fds, fds + HardwareCounterValues::NUM_COUNTERS, -1); }
+
+  ~CounterGroup() { close(); }
+
+  void close() {
+    for (auto &fd : fds) {
+      if (fd >= 0) ::close(fd);
+      fd = -1;
+    }
+  }
+
+  bool open() {
+    if (opened || failed) return opened;
+
+    const uint64_t configs[HardwareCounterValues::NUM_COUNTERS] = {
+        PERF_COUNT_HW_CPU_CYCLES, PERF_COUNT_HW_INSTRUCTIONS, PERF_COUNT_HW_CACHE_REFERENCES,
+        PERF_COUNT_HW_CACHE_MISSES, PERF_COUNT_HW_BRANCH_MISSES};
+
+    for (int e = 0; e < HardwareCounterValues::NUM_COUNTERS; e++) {
+      perf_event_attr attr;
+      memset(&attr, 0, sizeof(attr));
+      attr.size = sizeof(attr);
+      attr.type = PERF_TYPE_HARDWARE;
+      attr.config = configs[e];
+      attr.disabled = e == 0 ? 1 : 0;
+      attr.exclude_kernel = 1;
+      attr.exclude_hv = 1;
+      attr.read_format = PERF_FORMAT_GROUP | PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+
+      // pid = 0, cpu = -1: calling thread on any cpu. Other threads, thread pool workers included, aren't counted,
+      // and inherit isn't set, so neither are threads spawned later. First counter leads the group
+      fds[e] = static_cast<int>(syscall(__NR_perf_event_open, &attr, 0, -1, e == 0 ? -1 : fds[0], 0));
+      if (fds[e] < 0) {
+        sd_debug("HardwareCounters: perf_event_open failed for counter %i\n", e);
+        close();
+        failed = true;
+        return false;
+      }
+    }
+
+    ioctl(fds[0], PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+    ioctl(fds[0], PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+    opened = true;
+    return true;
+  }
+
+  bool read(HardwareCounterValues &values) {
+    if (!open()) return false;
+
+    // nr, time enabled, time running, then values in group order
+    uint64_t buffer[3 + HardwareCounterValues::NUM_COUNTERS];
+    auto expected = static_cast<ssize_t>(sizeof(buffer));
+    if (::read(fds[0], buffer, sizeof(buffer)) != expected || buffer[0] != HardwareCounterValues::NUM_COUNTERS)
+      return false;
+
+    // group may be multiplexed with other perf users, so values are extrapolated to full time
+    auto scale = buffer[2] > 0 ? static_cast<double>(buffer[1]) / static_cast<double>(buffer[2]) : 0.0;
+    for (int e = 0; e < HardwareCounterValues::NUM_COUNTERS; e++)
+      values.values[e] = static_cast<uint64_t>(static_cast<double>(buffer[3 + e]) * scale);
+
+    return true;
+  }
+};
+
+static thread_local CounterGroup localGroup;
+#endif
+
+bool HardwareCounters::isSupported() {
+#if defined(__linux__)
+  return localGroup.open();
+#else
+  return false;
+#endif
+}
+
+bool HardwareCounters::read(HardwareCounterValues &values) {
+#if defined(__linux__)
+  return localGroup.read(values);
+#else
+  return false;
+#endif
+}
+
+int HardwareCounters::shapeClass(const LongType *shapeInfo) {
+  if (shapeInfo == nullptr) return 0;
+
+  auto length = static_cast<uint64_t>(shape::length(shapeInfo));
+  int exponent = 0;
+  while (length > 1) {
+    length >>= 1;
+    exponent++;
+  }
+
+  return shape::rank(shapeInfo) * 64 + exponent;
+}
+
+std::string HardwareCounters::shapeClassName(int shapeClass) {
+  return "rank" + std::to_string(shapeClass / 64) + "_len2^" + std::to_string(shapeClass % 64);
+}
+
+void HardwareCounters::record(LongType key, const std::string &name, int shapeClass, uint64_t nanos,
+                              const HardwareCounterValues &before, const HardwareCounterValues &after) {
+  std::lock_guard<std::mutex> lock(_lock);
+  auto &totals = _totals[std::make_pair(key, shapeClass)];
+  if (totals.name.empty()) totals.name = name;
+
+  totals.count++;
+  totals.nanos += nanos;
+  for (int e = 0; e < HardwareCounterValues::NUM_COUNTERS; e++)
+    totals.counters.values[e] += after.values[e] > before.values[e] ? after.values[e] - before.values[e] : 0;
+}
+
+std::vector<HardwareCounterSnapshot> HardwareCounters::snapshots() {
+  std::vector<HardwareCounterSnapshot> result;
+  {
+    std::lock_guard<std::mutex> lock(_lock);
+    for (auto &v : _totals) {
+      HardwareCounterSnapshot snapshot;
+      snapshot.key = v.first.first;
+      snapshot.shapeClass = v.first.second;
+      snapshot.name = v.second.name;
+      snapshot.count = v.second.count;
+      snapshot.nanos = v.second.nanos;
+      snapshot.counters = v.second.counters;
+      result.emplace_back(snapshot);
+    }
+  }
+
+  std::sort(result.begin(), result.end(), [](const HardwareCounterSnapshot &a, const HardwareCounterSnapshot &b) {
+    return a.counters.get(HardwareCounter::CYCLES) > b.counters.get(HardwareCounter::CYCLES);
+  });
+
+  return result;
+}
+
+void HardwareCounters::reset() {
+  std::lock_guard<std::mutex> lock(_lock);
+  _totals.clear();
+}
+
+double HardwareCounterSnapshot::instructionsPerCycle() const {
+  auto cycles = counters.get(HardwareCounter::CYCLES);
+  return cycles == 0 ? 0.0 : static_cast<double>(counters.get(HardwareCounter::INSTRUCTIONS)) / cycles;
+}
+
+double HardwareCounterSnapshot::cacheMissRate() const {
+  auto references = counters.get(HardwareCounter::CACHE_REFERENCES);
+  return references == 0 ? 0.0 : static_cast<double>(counters.get(HardwareCounter::CACHE_MISSES)) / references;
+}
+
+double HardwareCounterSnapshot::estimatedBandwidth() const {
+  return nanos == 0 ? 0.0 : static_cast<double>(counters.get(HardwareCounter::CACHE_MISSES)) * 64.0 / nanos;
+}
+
+const char *HardwareCounters::report() {
+  auto all = snapshots();
+
+  std::stringstream stream;
+  stream << "op,key,shape_class,count,cycles,instructions,ipc,cache_references,cache_misses,miss_rate,"
+            "est_bandwidth_gbs,branch_misses\n";
+  char line[512];
+  for (const auto &s : all) {
+    snprintf(line, sizeof(line), "%s,%lld,%s,%llu,%llu,%llu,%.3f,%llu,%llu,%.4f,%.3f,%llu\n", s.name.c_str(),
+             static_cast<long long>(s.key), shapeClassName(s.shapeClass).c_str(),
+             static_cast<unsigned long long>(s.count),
+             static_cast<unsigned long long>(s.counters.get(HardwareCounter::CYCLES)),
+             static_cast<unsigned long long>(s.counters.get(HardwareCounter::INSTRUCTIONS)), s.instructionsPerCycle(),
+             static_cast<unsigned long long>(s.counters.get(HardwareCounter::CACHE_REFERENCES)),
+             static_cast<unsigned long long>(s.counters.get(HardwareCounter::CACHE_MISSES)), s.cacheMissRate(),
+             s.estimatedBandwidth(), static_cast<unsigned long long>(s.counters.get(HardwareCounter::BRANCH_MISSES)));
+    stream << line;
+  }
+
+  std::lock_guard<std::mutex> lock(_lock);
+  _report = stream.str();
+  return _report.c_str();
+}
+
+void HardwareCounters::printOut(int limit) {
+  auto all = snapshots();
+  if (all.empty()) return;
+
+  sd_printf("\nHardware counters, top %i by cycles:\n", limit);
+  auto count = std::min<size_t>(all.size(), static_cast<size_t>(limit));
+  for (size_t e = 0; e < count; e++) {
+    auto &s = all[e];
+    sd_printf("%s [%s]: calls: %llu; cycles: %llu; IPC: %.2f; LLC miss rate: %.3f; est. bandwidth: %.2f GB/s;\n",
+              s.name.c_str(), shapeClassName(s.shapeClass).c_str(), static_cast<unsigned long long>(s.count),
+              static_cast<unsigned long long>(s.counters.get(HardwareCounter::CYCLES)), s.instructionsPerCycle(),
+              s.cacheMissRate(), s.estimatedBandwidth());
+  }
+}
+
+////////////////////////////////////////////////////////////////////////
+HardwareCounterScope::HardwareCounterScope(LongType key, const std::string *name, const LongType *shapeInfo)
+    : _key(key), _name(name), _shapeClass(0), _enabled(HardwareCounters::isEnabled()) {
+  if (_enabled) {
+    _shapeClass = HardwareCounters::shapeClass(shapeInfo);
+    start();
+  }
+}
+
+HardwareCounterScope::HardwareCounterScope(LegacyOpKind kind, int opNum, const LongType *shapeInfo)
+    : _key(OpLatencyHistograms::legacyKey(kind, opNum)),
+      _name(nullptr),
+      _shapeClass(0),
+      _kind(kind),
+      _opNum(opNum),
+      _enabled(HardwareCounters::isEnabled()) {
+  if (_enabled) {
+    _shapeClass = HardwareCounters::shapeClass(shapeInfo);
+    start();
+  }
+}
+
+void HardwareCounterScope::start() {
+  // counters are read last, so our own bookkeeping stays out of the sample
+  _start = std::chrono::steady_clock::now();
+  _enabled = HardwareCounters::read(_before);
+}
+
+bool HardwareCounterScope::current(HardwareCounterValues &delta) {
+  if (!_enabled) return false;
+
+  HardwareCounterValues after;
+  if (!HardwareCounters::read(after)) return false;
+
+  for (int e = 0; e < HardwareCounterValues::NUM_COUNTERS; e++)
+    delta.values[e] = after.values[e] > _before.values[e] ? after.values[e] - _before.values[e] : 0;
+
+  return true;
+}
+
+HardwareCounterScope::~HardwareCounterScope() {
+  if (!_enabled) return;
+
+  HardwareCounterValues after;
+  if (!HardwareCounters::read(after)) return;
+
+  auto nanos = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - _start).count();
+  auto &counters = HardwareCounters::getInstance();
+  if (_name != nullptr)
+    counters.record(_key, *_name, _shapeClass, static_cast<uint64_t>(nanos), _before, after);
+  else
+    counters.record(_key, OpLatencyHistograms::legacyName(_kind, _opNum), _shapeClass, static_cast<uint64_t>(nanos),
+                    _before, after);
+}
+}  // namespace sd
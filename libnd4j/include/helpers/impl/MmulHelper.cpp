@@ -480,10 +480,11 @@ void MmulHelper::matmul(NDArray* x, NDArray* y, NDArray* z, const bool transX, c
     // dot (1Dx1D), vector-matrix (1Dx2D), matrix-vector (2Dx1D), matrix-matrix (2Dx2D) product cases
     if (xRank == 1 && yRank == 2) {
       // reduce vector-matrix to matrix-matrix case
-      //note we dup to avoid mutating input data
+      //reshape into new view doesn't mutate input data, so x is copied only if it isn't dense
       std::vector<sd::LongType> xShape = {1, xT->lengthOf()};
       std::vector<sd::LongType> zShape = {1, z->lengthOf()};
-      NDArray &xReshape = x->dup(x->ordering()).reshape(xT->ordering(), xShape,false);
+      NDArray xDense = x->contiguous();
+      NDArray &xReshape = xDense.reshape(xT->ordering(), xShape, false);
       xT = new NDArray(xReshape);  // please note x is not transposed in this case (since xRank=1)
       NDArray &zReshape = z->dup(z->ordering()).reshape(z->ordering(), zShape,false);
       zT = new NDArray(zReshape);
@@ -0,0 +1,354 @@
+/* ******************************************************************************
+ *
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ *  See the NOTICE file distributed with this work for additional
+ *  information regarding copyright ownership.
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ******************************************************************************/
+
+//
+// Always-on per-op latency histograms, sharded per thread
+//
+#include <array/ArrayOptions.h>
+#include <array/DataTypeUtils.h>
+#include <helpers/OpLatencyHistograms.h>
+#include <helpers/shape.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <sstream>
+
+namespace sd {
+
+static int highestBit(uint64_t value) {
+#if defined(__GNUC__) || defined(__clang__)
+  return 63 - __builtin_clzll(value);
+#else
+  int bit = 0;
+  while (value >>= 1) bit++;
+  return bit;
+#endif
+}
+
+int LatencyBuckets::bucketFor(uint64_t nanos) {
+  if (nanos < SUB_BUCKETS) return static_cast<int>(nanos);
+
+  auto exponent = highestBit(nanos);
+  if (exponent > MAX_EXPONENT) return NUM_BUCKETS - 1;
+
+  // top SUB_BUCKET_BITS bits below the leading one select linear sub-bucket
+  auto sub = static_cast<int>(nanos >> (exponent - SUB_BUCKET_BITS)) - SUB_BUCKETS;
+  return SUB_BUCKETS * (exponent - SUB_BUCKET_BITS + 1) + sub;
+}
+
+uint64_t LatencyBuckets::lowerBound(int bucket) {
+  if (bucket < SUB_BUCKETS) return static_cast<uint64_t>(bucket);
+
+  auto exponent = bucket / SUB_BUCKETS + SUB_BUCKET_BITS - 1;
+  auto sub = static_cast<uint64_t>(bucket % SUB_BUCKETS);
+  return (SUB_BUCKETS + sub) << (exponent - SUB_BUCKET_BITS);
+}
+
+uint64_t LatencyBuckets::upperBound(int bucket) {
+  if (bucket < SUB_BUCKETS) return static_cast<uint64_t>(bucket);
+
+  auto exponent = bucket / SUB_BUCKETS + SUB_BUCKET_BITS - 1;
+  auto sub = static_cast<uint64_t>(bucket % SUB_BUCKETS);
+  return ((SUB_BUCKETS + sub + 1) << (exponent - SUB_BUCKET_BITS)) - 1;
+}
+
+double OpLatencySnapshot::percentile(double q) const {
+  if (count == 0 || buckets.empty()) return 0.0;
+
+  q = std::min(1.0, std::max(0.0, q));
+  auto rank = std::max<uint64_t>(1, static_cast<uint64_t>(std::ceil(q * static_cast<double>(count))));
+
+  uint64_t seen = 0;
+  for (size_t e = 0; e < buckets.size(); e++) {
+    seen += buckets[e];
+    if (seen >= rank) {
+      auto middle = (LatencyBuckets::lowerBound(e) + LatencyBuckets::upperBound(e)) / 2.0;
+      return std::min(middle, static_cast<double>(maxNanos));
+    }
+  }
+
+  return static_cast<double>(maxNanos);
+}
+
+double OpLatencySnapshot::meanNanos() const {
+  return count == 0 ? 0.0 : static_cast<double>(totalNanos) / static_cast<double>(count);
+}
+
+////////////////////////////////////////////////////////////////////////
+std::atomic<bool> OpLatencyHistograms::_enabled(true);
+
+OpLatencyHistograms::OpCounters::OpCounters() {
+  for (auto &bucket : buckets) bucket.store(0, std::memory_order_relaxed);
+}
+
+void OpLatencyHistograms::OpCounters::reset() {
+  count.store(0, std::memory_order_relaxed);
+  totalNanos.store(0, std::memory_order_relaxed);
+  maxNanos.store(0, std::memory_order_relaxed);
+  bytesIn.store(0, std::memory_order_relaxed);
+  bytesOut.store(0, std::memory_order_relaxed);
+  for (auto &bucket : buckets) bucket.store(0, std::memory_order_relaxed);
+}
+
+OpLatencyHistograms::Shard::~Shard() {
+  for (auto &v : ops) delete v.second;
+}
+
+// shard goes back to the pool when its thread exits, so short-living threads don't grow shards list
+struct ShardHandle {
+  OpLatencyHistograms::Shard *shard = nullptr;
+
+  ~ShardHandle() {
+    if (shard != nullptr) OpLatencyHistograms::getInstance().releaseShard(shard);
+  }
+};
+
+static thread_local ShardHandle localHandle;
+
+OpLatencyHistograms::~OpLatencyHistograms() {
+  for (auto shard : _shards) delete shard;
+}
+
+OpLatencyHistograms &OpLatencyHistograms::getInstance() {
+  // never destroyed: thread-local shard handles may outlive static destructors
+  static auto instance = new OpLatencyHistograms();
+  return *instance;
+}
+
+void OpLatencyHistograms::setEnabled(bool enabled) { _enabled.store(enabled, std::memory_order_relaxed); }
+
+OpLatencyHistograms::Shard *OpLatencyHistograms::acquireShard() {
+  std::lock_guard<std::mutex> lock(_lock);
+  for (auto shard : _shards) {
+    bool expected = true;
+    if (shard->free.compare_exchange_strong(expected, false)) return shard;
+  }
+
+  auto shard = new Shard();
+  _shards.emplace_back(shard);
+  return shard;
+}
+
+OpLatencyHistograms::Shard *OpLatencyHistograms::localShard() {
+  if (localHandle.shard == nullptr) localHandle.shard = acquireShard();
+
+  return localHandle.shard;
+}
+
+void OpLatencyHistograms::releaseShard(Shard *shard) { shard->free.store(true); }
+
+OpLatencyHistograms::OpCounters *OpLatencyHistograms::lookup(Shard *shard, LongType key) {
+  // only owning thread modifies this map, so it can read it without lock
+  auto it = shard->ops.find(key);
+  return it == shard->ops.end() ? nullptr : it->second;
+}
+
+OpLatencyHistograms::OpCounters *OpLatencyHistograms::insert(Shard *shard, LongType key, const std::string &name) {
+  auto counters = new OpCounters();
+  counters->name = name;
+
+  std::lock_guard<std::mutex> lock(shard->lock);
+  shard->ops[key] = counters;
+  return counters;
+}
+
+static SD_INLINE void increment(std::atomic<uint64_t> &counter, uint64_t value) {
+  // single writer per shard, plain load + store is enough and avoids locked instructions
+  counter.store(counter.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+}
+
+void OpLatencyHistograms::update(OpCounters *counters, uint64_t nanos, uint64_t bytesIn, uint64_t bytesOut) {
+  increment(counters->buckets[LatencyBuckets::bucketFor(nanos)], 1);
+  increment(counters->count, 1);
+  increment(counters->totalNanos, nanos);
+  increment(counters->bytesIn, bytesIn);
+  increment(counters->bytesOut, bytesOut);
+
+  if (nanos > counters->maxNanos.load(std::memory_order_relaxed))
+    counters->maxNanos.store(nanos, std::memory_order_relaxed);
+}
+
+static const char *legacyKindName(LegacyOpKind kind) {
+  switch (kind) {
+    case LegacyOpKind::INDEX_REDUCE: return "index_reduce";
+    case LegacyOpKind::REDUCE3: return "reduce3";
+    case LegacyOpKind::SCALAR: return "scalar";
+    case LegacyOpKind::SCALAR_BOOL: return "scalar_bool";
+    case LegacyOpKind::SCALAR_INT: return "scalar_int";
+    case LegacyOpKind::BROADCAST: return "broadcast";
+    case LegacyOpKind::BROADCAST_BOOL: return "broadcast_bool";
+    case LegacyOpKind::BROADCAST_INT: return "broadcast_int";
+    case LegacyOpKind::PAIRWISE: return "pairwise";
+    case LegacyOpKind::PAIRWISE_BOOL: return "pairwise_bool";
+    case LegacyOpKind::PAIRWISE_INT: return "pairwise_int";
+    case LegacyOpKind::TRANSFORM_FLOAT: return "transform_float";
+    case LegacyOpKind::TRANSFORM_ANY: return "transform_any";
+    case LegacyOpKind::TRANSFORM_STRICT: return "transform_strict";
+    case LegacyOpKind::TRANSFORM_SAME: return "transform_same";
+    case LegacyOpKind::TRANSFORM_BOOL: return "transform_bool";
+    case LegacyOpKind::REDUCE_FLOAT: return "reduce_float";
+    case LegacyOpKind::REDUCE_SAME: return "reduce_same";
+    case LegacyOpKind::REDUCE_BOOL: return "reduce_bool";
+    case LegacyOpKind::REDUCE_LONG: return "reduce_long";
+    case LegacyOpKind::SUMMARY_STATS: return "summarystats";
+    case LegacyOpKind::RANDOM: return "random";
+    default: return "unknown";
+  }
+}
+
+LongType OpLatencyHistograms::legacyKey(LegacyOpKind kind, int opNum) {
+  auto packed = (static_cast<LongType>(kind) << 32) | static_cast<LongType>(static_cast<uint32_t>(opNum));
+  return -packed - 1;
+}
+
+std::string OpLatencyHistograms::legacyName(LegacyOpKind kind, int opNum) {
+  return std::string("legacy:") + legacyKindName(kind) + ":" + std::to_string(opNum);
+}
+
+void OpLatencyHistograms::record(LongType key, const std::string &name, uint64_t nanos, uint64_t bytesIn,
+                                 uint64_t bytesOut) {
+  auto shard = localShard();
+  auto counters = lookup(shard, key);
+  if (counters == nullptr) counters = insert(shard, key, name);
+
+  update(counters, nanos, bytesIn, bytesOut);
+}
+
+void OpLatencyHistograms::record(LegacyOpKind kind, int opNum, uint64_t nanos, uint64_t bytesIn,
+                                 uint64_t bytesOut) {
+  auto shard = localShard();
+  auto key = legacyKey(kind, opNum);
+  auto counters = lookup(shard, key);
+  if (counters == nullptr) counters = insert(shard, key, legacyName(kind, opNum));
+
+  update(counters, nanos, bytesIn, bytesOut);
+}
+
+static void mergeInto(OpLatencySnapshot &snapshot, LongType key, const std::string &name, uint64_t count,
+                      uint64_t totalNanos, uint64_t maxNanos, uint64_t bytesIn, uint64_t bytesOut) {
+  snapshot.key = key;
+  if (snapshot.name.empty()) snapshot.name = name;
+
+  snapshot.count += count;
+  snapshot.totalNanos += totalNanos;
+  snapshot.maxNanos = std::max(snapshot.maxNanos, maxNanos);
+  snapshot.bytesIn += bytesIn;
+  snapshot.bytesOut += bytesOut;
+  if (snapshot.buckets.empty()) snapshot.buckets.resize(LatencyBuckets::NUM_BUCKETS, 0);
+}
+
+OpLatencySnapshot OpLatencyHistograms::snapshot(LongType key) {
+  OpLatencySnapshot result;
+  result.key = key;
+
+  std::lock_guard<std::mutex> lock(_lock);
+  for (auto shard : _shards) {
+    std::lock_guard<std::mutex> shardLock(shard->lock);
+    auto it = shard->ops.find(key);
+    if (it == shard->ops.end()) continue;
+
+    auto c = it->second;
+    mergeInto(result, key, c->name, c->count.load(std::memory_order_relaxed),
+              c->totalNanos.load(std::memory_order_relaxed), c->maxNanos.load(std::memory_order_relaxed),
+              c->bytesIn.load(std::memory_order_relaxed), c->bytesOut.load(std::memory_order_relaxed));
+
+    for (int e = 0; e < LatencyBuckets::NUM_BUCKETS; e++)
+      result.buckets[e] += c->buckets[e].load(std::memory_order_relaxed);
+  }
+
+  return result;
+}
+
+std::vector<OpLatencySnapshot> OpLatencyHistograms::snapshots() {
+  std::vector<LongType> keys;
+  {
+    std::lock_guard<std::mutex> lock(_lock);
+    for (auto shard : _shards) {
+      std::lock_guard<std::mutex> shardLock(shard->lock);
+      for (auto &v : shard->ops)
+        if (std::find(keys.begin(), keys.end(), v.first) == keys.end()) keys.emplace_back(v.first);
+    }
+  }
+
+  std::vector<OpLatencySnapshot> result;
+  for (auto key : keys) {
+    auto merged = snapshot(key);
+    if (merged.count > 0) result.emplace_back(merged);
+  }
+
+  std::sort(result.begin(), result.end(), [](const OpLatencySnapshot &a, const OpLatencySnapshot &b) {
+    return a.totalNanos > b.totalNanos;
+  });
+
+  return result;
+}
+
+void OpLatencyHistograms::reset() {
+  // counters are zeroed in place, concurrent recording may survive reset partially
+  std::lock_guard<std::mutex> lock(_lock);
+  for (auto shard : _shards) {
+    std::lock_guard<std::mutex> shardLock(shard->lock);
+    for (auto &v : shard->ops) v.second->reset();
+  }
+}
+
+const char *OpLatencyHistograms::report() {
+  auto all = snapshots();
+
+  std::stringstream stream;
+  stream << "op,key,count,bytes_in,bytes_out,mean_us,p50_us,p99_us,p999_us,max_us\n";
+  char line[512];
+  for (const auto &s : all) {
+    snprintf(line, sizeof(line), "%s,%lld,%llu,%llu,%llu,%.3f,%.3f,%.3f,%.3f,%.3f\n", s.name.c_str(),
+             static_cast<long long>(s.key), static_cast<unsigned long long>(s.count),
+             static_cast<unsigned long long>(s.bytesIn), static_cast<unsigned long long>(s.bytesOut),
+             s.meanNanos() / 1000.0, s.percentile(0.5) / 1000.0, s.percentile(0.99) / 1000.0,
+             s.percentile(0.999) / 1000.0, s.maxNanos / 1000.0);
+    stream << line;
+  }
+
+  std::lock_guard<std::mutex> lock(_lock);
+  _report = stream.str();
+  return _report.c_str();
+}
+
+////////////////////////////////////////////////////////////////////////
+static uint64_t bytesOf(const LongType *shapeInfo) {
+  if (shapeInfo == nullptr) return 0;
+
+  return static_cast<uint64_t>(shape::length(shapeInfo)) *
+         DataTypeUtils::sizeOfElement(ArrayOptions::dataType(shapeInfo));
+}
+
+LegacyOpLatencyScope::~LegacyOpLatencyScope() {
+  if (!_histograms && !_timeline) return;
+
+  auto nanos = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - _start).count();
+  if (_histograms)
+    OpLatencyHistograms::getInstance().record(_kind, _opNum, static_cast<uint64_t>(nanos),
+                                              bytesOf(_xShapeInfo) + bytesOf(_yShapeInfo), bytesOf(_zShapeInfo));
+
+  if (_timeline) {
+    auto &tracer = TimelineTracer::getInstance();
+    auto end = tracer.now();
+    auto start = end > static_cast<uint64_t>(nanos) ? end - static_cast<uint64_t>(nanos) : 0;
+    tracer.span(TimelineCategory::OP, OpLatencyHistograms::legacyName(_kind, _opNum).c_str(), start, end);
+  }
+}
+}  // namespace sd
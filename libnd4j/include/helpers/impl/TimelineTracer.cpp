@@ -0,0 +1,213 @@
+/* ******************************************************************************
+ *
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ *  See the NOTICE file distributed with this work for additional
+ *  information regarding copyright ownership.
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ******************************************************************************/
+
+//
+// Per-thread timeline of native execution, exported as Chrome trace JSON
+//
+#include <helpers/TimelineTracer.h>
+#include <system/op_boilerplate.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+
+namespace sd {
+
+std::atomic<bool> TimelineTracer::_enabled(false);
+
+// buffer goes back to the pool when its thread exits, recorded events are kept
+struct TimelineBufferHandle {
+  TimelineTracer::ThreadBuffer *buffer = nullptr;
+
+  ~TimelineBufferHandle() {
+    if (buffer != nullptr) TimelineTracer::getInstance().releaseBuffer(buffer);
+  }
+};
+
+static thread_local TimelineBufferHandle localHandle;
+
+TimelineTracer::TimelineTracer() { _epoch = std::chrono::steady_clock::now(); }
+
+TimelineTracer::~TimelineTracer() {
+  for (auto buffer : _buffers) delete buffer;
+}
+
+TimelineTracer &TimelineTracer::getInstance() {
+  // never destroyed: thread-local buffer handles may outlive static destructors
+  static auto instance = new TimelineTracer();
+  return *instance;
+}
+
+void TimelineTracer::setEnabled(bool enabled) { _enabled.store(enabled, std::memory_order_relaxed); }
+
+void TimelineTracer::setCapacity(int eventsPerThread) {
+  if (eventsPerThread < 1) THROW_EXCEPTION("TimelineTracer: capacity should be positive");
+
+  _capacity.store(eventsPerThread);
+}
+
+uint64_t TimelineTracer::now() {
+  return static_cast<uint64_t>(
+      std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - _epoch).count());
+}
+
+TimelineTracer::ThreadBuffer *TimelineTracer::localBuffer() {
+  if (localHandle.buffer != nullptr) return localHandle.buffer;
+
+  std::lock_guard<std::mutex> lock(_lock);
+  ThreadBuffer *result = nullptr;
+  for (auto buffer : _buffers) {
+    bool expected = true;
+    if (buffer->free.compare_exchange_strong(expected, false)) {
+      result = buffer;
+      break;
+    }
+  }
+
+  if (result == nullptr) {
+    result = new ThreadBuffer();
+    result->events.resize(_capacity.load());
+    _buffers.emplace_back(result);
+  }
+
+  // reused buffers get new thread id, events of exited thread keep the old one
+  result->thread = ++_threadCounter;
+  localHandle.buffer = result;
+  return result;
+}
+
+void TimelineTracer::releaseBuffer(ThreadBuffer *buffer) { buffer->free.store(true); }
+
+void TimelineTracer::push(TimelineCategory category, const char *name, char phase, uint64_t start,
+                          uint64_t duration, LongType arg) {
+  auto buffer = localBuffer();
+
+  // lock is contended only while events are being exported
+  std::lock_guard<std::mutex> lock(buffer->lock);
+  auto &event = buffer->events[buffer->written % buffer->events.size()];
+  strncpy(event.name, name == nullptr ? "unknown" : name, TimelineEvent::MAX_NAME_LENGTH);
+  event.name[TimelineEvent::MAX_NAME_LENGTH] = 0;
+  event.start = start;
+  event.duration = duration;
+  event.arg = arg;
+  event.thread = buffer->thread;
+  event.category = category;
+  event.phase = phase;
+  buffer->written++;
+}
+
+void TimelineTracer::span(TimelineCategory category, const char *name, uint64_t start, uint64_t end, LongType arg) {
+  push(category, name, 'X', start, end > start ? end - start : 0, arg);
+}
+
+void TimelineTracer::instant(TimelineCategory category, const char *name, LongType arg) {
+  push(category, name, 'i', now(), 0, arg);
+}
+
+LongType TimelineTracer::numEvents() {
+  LongType result = 0;
+  std::lock_guard<std::mutex> lock(_lock);
+  for (auto buffer : _buffers) {
+    std::lock_guard<std::mutex> bufferLock(buffer->lock);
+    result += static_cast<LongType>(std::min<uint64_t>(buffer->written, buffer->events.size()));
+  }
+
+  return result;
+}
+
+void TimelineTracer::purge() {
+  std::lock_guard<std::mutex> lock(_lock);
+  for (auto buffer : _buffers) {
+    std::lock_guard<std::mutex> bufferLock(buffer->lock);
+    buffer->written = 0;
+  }
+}
+
+static const char *categoryName(TimelineCategory category) {
+  switch (category) {
+    case TimelineCategory::OP: return "op";
+    case TimelineCategory::THREADS: return "threads";
+    case TimelineCategory::MEMORY: return "memory";
+    case TimelineCategory::SHAPES: return "shapes";
+    default: return "unknown";
+  }
+}
+
+static void writeEscaped(std::ostream &stream, const char *value) {
+  for (auto c = value; *c != 0; c++) {
+    if (*c == '"' || *c == '\\')
+      stream << '\\' << *c;
+    else if (static_cast<unsigned char>(*c) < 0x20)
+      stream << ' ';
+    else
+      stream << *c;
+  }
+}
+
+void TimelineTracer::write(std::ostream &stream) {
+  std::vector<TimelineEvent> events;
+  {
+    std::lock_guard<std::mutex> lock(_lock);
+    for (auto buffer : _buffers) {
+      std::lock_guard<std::mutex> bufferLock(buffer->lock);
+      auto capacity = buffer->events.size();
+      auto count = std::min<uint64_t>(buffer->written, capacity);
+      for (uint64_t e = buffer->written - count; e < buffer->written; e++)
+        events.emplace_back(buffer->events[e % capacity]);
+    }
+  }
+
+  std::stable_sort(events.begin(), events.end(),
+                   [](const TimelineEvent &a, const TimelineEvent &b) { return a.start < b.start; });
+
+  // Chrome trace timestamps are in microseconds
+  char timing[96];
+  stream << "{\"traceEvents\":[";
+  for (size_t e = 0; e < events.size(); e++) {
+    auto &event = events[e];
+    stream << (e > 0 ? ",\n" : "\n") << "{\"name\":\"";
+    writeEscaped(stream, event.name);
+    stream << "\",\"cat\":\"" << categoryName(event.category) << "\",\"ph\":\"" << event.phase << "\"";
+
+    if (event.phase == 'X')
+      snprintf(timing, sizeof(timing), ",\"ts\":%.3f,\"dur\":%.3f", event.start / 1000.0, event.duration / 1000.0);
+    else
+      snprintf(timing, sizeof(timing), ",\"ts\":%.3f,\"s\":\"t\"", event.start / 1000.0);
+
+    stream << timing << ",\"pid\":1,\"tid\":" << event.thread;
+    if (event.arg >= 0) stream << ",\"args\":{\"value\":" << event.arg << "}";
+
+    stream << "}";
+  }
+
+  stream << "\n],\"displayTimeUnit\":\"ns\"}\n";
+}
+
+void TimelineTracer::save(const std::string &path) {
+  std::ofstream stream(path);
+  if (!stream.good()) {
+    std::string errorMessage;
+    errorMessage += "TimelineTracer: can't open file for writing: ";
+    errorMessage += path;
+    THROW_EXCEPTION(errorMessage.c_str());
+  }
+
+  write(stream);
+}
+}  // namespace sd
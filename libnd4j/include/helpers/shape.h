@@ -744,6 +744,86 @@ SD_LIB_EXPORT SD_INLINE SD_HOST_DEVICE bool strideDescendingCAscendingF( sd::Lon
   }
 }
 
+/**
+ * returns true if elements occupy dense block of memory laid out in given order ('c' or 'f'),
+ * regardless of order flag stored in shapeInfo. Unit dimensions are ignored, their strides don't matter
+ */
+SD_LIB_EXPORT SD_INLINE SD_HOST_DEVICE bool isDenseInOrder(const sd::LongType *shapeBuffer, const char order) {
+  const sd::LongType rank = shape::rank(shapeBuffer);
+  const sd::LongType *shape = shape::shapeOf(shapeBuffer);
+  const sd::LongType *strides = shape::stride(shapeBuffer);
+
+  sd::LongType expected = 1;
+  for (sd::LongType i = 0; i < rank; i++) {
+    const sd::LongType dim = order == 'c' ? rank - 1 - i : i;
+    if (shape[dim] == 1) continue;
+    if (strides[dim] != expected) return false;
+    expected *= shape[dim];
+  }
+
+  return true;
+}
+
+/**
+ * canonicalizes iteration space shared by numArrays arrays of the same shape, in place:
+ * unit dimensions are dropped, dimensions are ordered along absolute strides of first array (ties are resolved
+ * by following arrays), from outer to inner, and adjacent dimensions contiguous in all arrays are merged.
+ * Zero (broadcast) strides are fine. Returns new rank, which is 0 for single-element iteration space
+ */
+SD_LIB_EXPORT SD_INLINE SD_HOST_DEVICE int collapseDimensions(int rank, sd::LongType *shape, sd::LongType **strides,
+                                                              const int numArrays) {
+  int newRank = 0;
+  for (int e = 0; e < rank; e++) {
+    if (shape[e] == 1) continue;
+
+    shape[newRank] = shape[e];
+    for (int a = 0; a < numArrays; a++) strides[a][newRank] = strides[a][e];
+    newRank++;
+  }
+
+  // rank is tiny, so insertion sort is fine here
+  for (int i = 1; i < newRank; i++) {
+    for (int j = i; j > 0; j--) {
+      int order = 0;
+      for (int a = 0; a < numArrays && order == 0; a++) {
+        const auto prev = strides[a][j - 1] < 0 ? -strides[a][j - 1] : strides[a][j - 1];
+        const auto cur = strides[a][j] < 0 ? -strides[a][j] : strides[a][j];
+        order = prev < cur ? -1 : prev > cur ? 1 : 0;
+      }
+
+      if (order >= 0) break;
+
+      const auto tmp = shape[j - 1];
+      shape[j - 1] = shape[j];
+      shape[j] = tmp;
+      for (int a = 0; a < numArrays; a++) {
+        const auto s = strides[a][j - 1];
+        strides[a][j - 1] = strides[a][j];
+        strides[a][j] = s;
+      }
+    }
+  }
+
+  if (newRank < 2) return newRank;
+
+  int last = 0;
+  for (int e = 1; e < newRank; e++) {
+    bool mergeable = true;
+    for (int a = 0; a < numArrays && mergeable; a++) mergeable = strides[a][last] == strides[a][e] * shape[e];
+
+    if (mergeable) {
+      shape[last] *= shape[e];
+    } else {
+      last++;
+      shape[last] = shape[e];
+    }
+
+    for (int a = 0; a < numArrays; a++) strides[a][last] = strides[a][e];
+  }
+
+  return last + 1;
+}
+
 SD_LIB_EXPORT SD_INLINE SD_HOST int outerArrayOffsets(sd::LongType *maxOffsets, const sd::LongType minIdx,
                                                       const sd::LongType *maxShapeInfo, const sd::LongType *minShapeInfo,
                                                       sd::LongType *memBuff, const sd::LongType *dimsToExclude) {
@@ -323,7 +323,8 @@ class SD_LIB_EXPORT NativeOpExecutioner {
   static void execTransformSame(sd::LaunchContext *lc, int opNum, const void *hX, const sd::LongType *hXShapeInfo,
                                 const void *dX, const sd::LongType *dXShapeInfo, void *hZ,
                                 const sd::LongType *hZShapeInfo, void *dZ, const sd::LongType *dZShapeInfo,
-                                void *extraParams, const sd::LongType *tadShapeInfo, const sd::LongType *tadOffsets);
+                                void *extraParams, const sd::LongType *tadShapeInfo, const sd::LongType *tadOffsets,
+                                bool allowParallelism = true);
 
   static void execTransformBool(sd::LaunchContext *lc, int opNum, const void *hX, const sd::LongType *hXShapeInfo,
                                 const void *dX, const sd::LongType *dXShapeInfo, void *hZ,
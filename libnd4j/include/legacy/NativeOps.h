@@ -33,6 +33,7 @@
 #include <cnpy/cnpy.h>
 #include <execinfo.h>
 #include <graph/GraphState.h>
+#include <graph/PreparedCall.h>
 #include <graph/ResultWrapper.h>
 #include <graph/VariablesSet.h>
 #include <graph/execution/LogicExecutor.h>
@@ -58,6 +59,7 @@ typedef sd::graph::ResultWrapper OpaqueResultWrapper;
 typedef sd::graph::VariablesSet OpaqueVariablesSet;
 typedef sd::graph::Variable OpaqueVariable;
 typedef sd::TadPack OpaqueTadPack;
+typedef sd::graph::PreparedCall OpaquePreparedCall;
 
 typedef sd::ConstantDataBuffer* OpaqueConstantDataBuffer;
 typedef sd::ConstantShapeBuffer* OpaqueConstantShapeBuffer;
@@ -173,6 +175,40 @@ SD_LIB_EXPORT sd::LongType dbBufferLength(OpaqueDataBuffer *dataBuffer) ;
 SD_LIB_EXPORT void toggleOpTrace(bool opTrace) ;
 SD_LIB_EXPORT void purgeOpTrace() ;
 SD_LIB_EXPORT void printOpTrace() ;
+SD_LIB_EXPORT void exportOpTrace(const char *path) ;
+SD_LIB_EXPORT void toggleOpLatencyHistograms(bool enabled) ;
+SD_LIB_EXPORT void purgeOpLatencyHistograms() ;
+SD_LIB_EXPORT sd::LongType opLatencyCount(sd::LongType opHash) ;
+SD_LIB_EXPORT double opLatencyPercentile(sd::LongType opHash, double quantile) ;
+SD_LIB_EXPORT sd::LongType opLatencyBytesIn(sd::LongType opHash) ;
+SD_LIB_EXPORT sd::LongType opLatencyBytesOut(sd::LongType opHash) ;
+SD_LIB_EXPORT const char *opLatencyReport() ;
+SD_LIB_EXPORT void toggleTimelineTrace(bool enabled) ;
+SD_LIB_EXPORT void purgeTimelineTrace() ;
+SD_LIB_EXPORT void exportTimelineTrace(const char *path) ;
+SD_LIB_EXPORT void calibrateThreading(const char *path) ;
+SD_LIB_EXPORT void resetThreadingCalibration() ;
+SD_LIB_EXPORT bool toggleHardwareCounters(bool enabled) ;
+SD_LIB_EXPORT void purgeHardwareCounters() ;
+SD_LIB_EXPORT const char *hardwareCountersReport() ;
+SD_LIB_EXPORT void toggleShapeFunctionCache(bool enabled) ;
+SD_LIB_EXPORT void purgeShapeFunctionCache() ;
+SD_LIB_EXPORT void setShapeFunctionCacheCapacity(int entries) ;
+SD_LIB_EXPORT sd::LongType shapeFunctionCacheHits() ;
+SD_LIB_EXPORT sd::LongType shapeFunctionCacheMisses() ;
+SD_LIB_EXPORT sd::Status execCommandBuffer(sd::Pointer *extraPointers, sd::LongType *buffer, sd::LongType length,
+                                          OpaqueNDArrayArr arrays, int numArrays, int *statuses, bool parallel) ;
+SD_LIB_EXPORT OpaquePreparedCall *prepareCall(sd::LongType opHash, sd::LongType *iArgs, int numIArgs, double *tArgs,
+                                             int numTArgs, bool *bArgs, int numBArgs, int *dArgs, int numDArgs,
+                                             bool inplace) ;
+SD_LIB_EXPORT void setPreparedCallInput(OpaquePreparedCall *call, int index, OpaqueNDArray array) ;
+SD_LIB_EXPORT void setPreparedCallOutput(OpaquePreparedCall *call, int index, OpaqueNDArray array) ;
+SD_LIB_EXPORT int bindPreparedCallOutputShapes(OpaquePreparedCall *call) ;
+SD_LIB_EXPORT sd::LongType *preparedCallOutputShape(OpaquePreparedCall *call, int index) ;
+SD_LIB_EXPORT sd::Status execPreparedCall(sd::Pointer *extraPointers, OpaquePreparedCall *call) ;
+SD_LIB_EXPORT void releasePreparedCall(OpaquePreparedCall *call) ;
+SD_LIB_EXPORT void setContextPoolMaxIdle(int maxIdle) ;
+SD_LIB_EXPORT void purgeContextPool() ;
 SD_LIB_EXPORT void copyBuffer(OpaqueDataBuffer *target, long n,  OpaqueDataBuffer *from, long fromOffset, long targetOffset) ;
 SD_LIB_EXPORT int contextNumInputs(void *contextPointer) ;
 SD_LIB_EXPORT int contextNumOutputs(void *contextPointer) ;
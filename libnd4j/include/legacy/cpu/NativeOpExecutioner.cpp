@@ -18,7 +18,10 @@
 
 #include <array/TadPack.h>
 #include <exceptions/datatype_exception.h>
+#include <helpers/BulkTypeCast.h>
+#include <helpers/StridedCopy.h>
 #include <helpers/ConstantTadHelper.h>
+#include <helpers/HardwareCounters.h>
 #include <helpers/LoopKind.h>
 #include <legacy/NativeOpExecutioner.h>
 #include <loops/broadcasting.h>
@@ -67,6 +70,7 @@ void NativeOpExecutioner::execIndexReduceScalar(sd::LaunchContext *lc, int opNum
                                                 const sd::LongType *dXShapeInfo, void *extraParams, void *hZ,
                                                 const sd::LongType *hZShapeInfo, void *dZ,
                                                 const sd::LongType *dZShapeInfo) {
+  sd::LegacyOpScope opScope(sd::LegacyOpKind::INDEX_REDUCE, opNum, hXShapeInfo, nullptr, hZShapeInfo);
   auto xType = sd::ArrayOptions::dataType(hXShapeInfo);
   auto zType = sd::ArrayOptions::dataType(hZShapeInfo);
   auto hz = reinterpret_cast<sd::LongType *>(hZ);
@@ -94,6 +98,7 @@ void NativeOpExecutioner::execIndexReduce(sd::LaunchContext *lc, int opNum, cons
                                           const sd::LongType *hZShapeInfo, void *dZ, const sd::LongType *dZShapeInfo,
                                           sd::LongType *dimension, sd::LongType dimensionLength, const sd::LongType *tadShapeInfo,
                                           const sd::LongType *tadOffsets) {
+  sd::LegacyOpScope opScope(sd::LegacyOpKind::INDEX_REDUCE, opNum, hXShapeInfo, nullptr, hZShapeInfo);
   auto xType = sd::ArrayOptions::dataType(hXShapeInfo);
   auto zType = sd::ArrayOptions::dataType(hZShapeInfo);
   auto hz = reinterpret_cast<sd::LongType *>(hZ);
@@ -126,6 +131,7 @@ void NativeOpExecutioner::execBroadcast(sd::LaunchContext *lc, int opNum, const
                                         void *dZ, const sd::LongType *dZShapeInfo, sd::LongType *dimension, sd::LongType dimensionLength,
                                         const sd::LongType *tadOnlyShapeInfo, const sd::LongType *tadOffsets,
                                         const sd::LongType *tadOnlyShapeInfoZ, const sd::LongType *tadOffsetsZ) {
+  sd::LegacyOpScope opScope(sd::LegacyOpKind::BROADCAST, opNum, hXShapeInfo, hYShapeInfo, hZShapeInfo);
   auto xType = sd::ArrayOptions::dataType(hXShapeInfo);
   auto yType = sd::ArrayOptions::dataType(hYShapeInfo);
   auto zType = sd::ArrayOptions::dataType(hZShapeInfo);
@@ -140,7 +146,10 @@ void NativeOpExecutioner::execBroadcast(sd::LaunchContext *lc, int opNum, const
   };
 
   sd::LongType numTads = shape::tensorsAlongDimension(hXShapeInfo, dimension, dimensionLength);
-  samediff::Threads::parallel_tad(func, 0, numTads);
+  samediff::Threads::parallel_tad(
+      func, 0, numTads, 1,
+      samediff::ThreadsHelper::numberOfThreadsTad(sd::Environment::getInstance().maxMasterThreads(), numTads,
+                                                  shape::length(hZShapeInfo), samediff::OpCostClass::PAIRWISE));
 }
 
 ////////////////////////////////////////////////////////////////////////
@@ -150,6 +159,7 @@ void NativeOpExecutioner::execBroadcast(sd::LaunchContext *lc, const int opNum,
                                         const sd::LongType *hYShapeInfo, const void *dY,
                                         const sd::LongType *dYShapeInfo, void *hZ, const sd::LongType *hZShapeInfo,
                                         void *dZ, const sd::LongType *dZShapeInfo) {
+  sd::LegacyOpScope opScope(sd::LegacyOpKind::BROADCAST, opNum, hXShapeInfo, hYShapeInfo, hZShapeInfo);
 
   auto xType = sd::ArrayOptions::dataType(hXShapeInfo);
   auto yType = sd::ArrayOptions::dataType(hYShapeInfo);
@@ -167,6 +177,7 @@ void NativeOpExecutioner::execInverseBroadcast(
     const sd::LongType *dYShapeInfo, void *hZ, const sd::LongType *hZShapeInfo, void *dZ,
     const sd::LongType *dZShapeInfo,sd::LongType *dimension, sd::LongType dimensionLength, const sd::LongType *tadOnlyShapeInfo,
     const sd::LongType *tadOffsets, const sd::LongType *tadOnlyShapeInfoZ, const sd::LongType *tadOffsetsZ) {
+  sd::LegacyOpScope opScope(sd::LegacyOpKind::BROADCAST, opNum, hXShapeInfo, hYShapeInfo, hZShapeInfo);
   auto xType = sd::ArrayOptions::dataType(hXShapeInfo);
   auto yType = sd::ArrayOptions::dataType(hYShapeInfo);
   auto zType = sd::ArrayOptions::dataType(hZShapeInfo);
@@ -190,7 +201,10 @@ void NativeOpExecutioner::execInverseBroadcast(
   auto yLen = shape::length(hYShapeInfo);
   auto numTads = yLen / xLen;
 
-  samediff::Threads::parallel_tad(func, 0, numTads);
+  samediff::Threads::parallel_tad(
+      func, 0, numTads, 1,
+      samediff::ThreadsHelper::numberOfThreadsTad(sd::Environment::getInstance().maxMasterThreads(), numTads,
+                                                  shape::length(hZShapeInfo), samediff::OpCostClass::PAIRWISE));
 }
 
 ////////////////////////////////////////////////////////////////////////
@@ -203,6 +217,7 @@ void NativeOpExecutioner::execBroadcastBool(sd::LaunchContext *lc, int opNum, co
                                             sd::LongType *dimension, sd::LongType dimensionLength, const sd::LongType *tadOnlyShapeInfo,
                                             const sd::LongType *tadOffsets, const sd::LongType *tadOnlyShapeInfoZ,
                                             const sd::LongType *tadOffsetsZ) {
+  sd::LegacyOpScope opScope(sd::LegacyOpKind::BROADCAST_BOOL, opNum, hXShapeInfo, hYShapeInfo, hZShapeInfo);
 
   auto xType = sd::ArrayOptions::dataType(hXShapeInfo);
   auto zType = sd::ArrayOptions::dataType(hZShapeInfo);
@@ -219,7 +234,10 @@ void NativeOpExecutioner::execBroadcastBool(sd::LaunchContext *lc, int opNum, co
   auto yLen = shape::length(hYShapeInfo);
   auto numTads = xLen / yLen;
 
-  samediff::Threads::parallel_tad(func, 0, numTads);
+  samediff::Threads::parallel_tad(
+      func, 0, numTads, 1,
+      samediff::ThreadsHelper::numberOfThreadsTad(sd::Environment::getInstance().maxMasterThreads(), numTads,
+                                                  shape::length(hZShapeInfo), samediff::OpCostClass::PAIRWISE));
 }
 
 ////////////////////////////////////////////////////////////////////////
@@ -229,6 +247,7 @@ void NativeOpExecutioner::execBroadcastBool(sd::LaunchContext *lc, const int opN
                                             const sd::LongType *hYShapeInfo, const void *dY,
                                             const sd::LongType *dYShapeInfo, void *hZ, const sd::LongType *hZShapeInfo,
                                             void *dZ, const sd::LongType *dZShapeInfo, void *extraParams) {
+  sd::LegacyOpScope opScope(sd::LegacyOpKind::BROADCAST_BOOL, opNum, hXShapeInfo, hYShapeInfo, hZShapeInfo);
 
   auto xType = sd::ArrayOptions::dataType(hXShapeInfo);
   auto zType = sd::ArrayOptions::dataType(hZShapeInfo);
@@ -245,6 +264,7 @@ void NativeOpExecutioner::execInverseBroadcastBool(
     const sd::LongType *dZShapeInfo, void *extraParams,sd::LongType *dimension, sd::LongType dimensionLength,
     const sd::LongType *tadOnlyShapeInfo, const sd::LongType *tadOffsets, const sd::LongType *tadOnlyShapeInfoZ,
     const sd::LongType *tadOffsetsZ) {
+  sd::LegacyOpScope opScope(sd::LegacyOpKind::BROADCAST_BOOL, opNum, hXShapeInfo, hYShapeInfo, hZShapeInfo);
   auto xType = sd::ArrayOptions::dataType(hXShapeInfo);
   auto yType = sd::ArrayOptions::dataType(hYShapeInfo);
   auto zType = sd::ArrayOptions::dataType(hZShapeInfo);
@@ -267,7 +287,10 @@ void NativeOpExecutioner::execInverseBroadcastBool(
   auto yLen = shape::length(hYShapeInfo);
   auto numTads = yLen / xLen;
 
-  samediff::Threads::parallel_tad(func, 0, numTads);
+  samediff::Threads::parallel_tad(
+      func, 0, numTads, 1,
+      samediff::ThreadsHelper::numberOfThreadsTad(sd::Environment::getInstance().maxMasterThreads(), numTads,
+                                                  shape::length(hZShapeInfo), samediff::OpCostClass::PAIRWISE));
 }
 
 ////////////////////////////////////////////////////////////////////////
@@ -277,6 +300,7 @@ void NativeOpExecutioner::execBroadcastInt(
     const sd::LongType *dYShapeInfo, void *hZ, const sd::LongType *hZShapeInfo, void *dZ,
     const sd::LongType *dZShapeInfo,sd::LongType *dimension, sd::LongType dimensionLength, const sd::LongType *tadOnlyShapeInfo,
     const sd::LongType *tadOffsets, const sd::LongType *tadOnlyShapeInfoZ, const sd::LongType *tadOffsetsZ) {
+  sd::LegacyOpScope opScope(sd::LegacyOpKind::BROADCAST_INT, opNum, hXShapeInfo, hYShapeInfo, hZShapeInfo);
   auto xType = sd::ArrayOptions::dataType(hXShapeInfo);
   auto yType = sd::ArrayOptions::dataType(hYShapeInfo);
   auto zType = sd::ArrayOptions::dataType(hZShapeInfo);
@@ -299,7 +323,10 @@ void NativeOpExecutioner::execBroadcastInt(
   auto yLen = shape::length(hYShapeInfo);
   auto numTads = xLen / yLen;
 
-  samediff::Threads::parallel_tad(func, 0, numTads);
+  samediff::Threads::parallel_tad(
+      func, 0, numTads, 1,
+      samediff::ThreadsHelper::numberOfThreadsTad(sd::Environment::getInstance().maxMasterThreads(), numTads,
+                                                  shape::length(hZShapeInfo), samediff::OpCostClass::PAIRWISE));
 }
 
 ////////////////////////////////////////////////////////////////////////
@@ -309,6 +336,7 @@ void NativeOpExecutioner::execBroadcastInt(sd::LaunchContext *lc, const int opNu
                                            const sd::LongType *hYShapeInfo, const void *dY,
                                            const sd::LongType *dYShapeInfo, void *hZ, const sd::LongType *hZShapeInfo,
                                            void *dZ, const sd::LongType *dZShapeInfo) {
+  sd::LegacyOpScope opScope(sd::LegacyOpKind::BROADCAST_INT, opNum, hXShapeInfo, hYShapeInfo, hZShapeInfo);
   auto xType = sd::ArrayOptions::dataType(hXShapeInfo);
   auto yType = sd::ArrayOptions::dataType(hYShapeInfo);
   auto zType = sd::ArrayOptions::dataType(hZShapeInfo);
@@ -330,6 +358,7 @@ void NativeOpExecutioner::execInverseBroadcastInt(
     const sd::LongType *dYShapeInfo, void *hZ, const sd::LongType *hZShapeInfo, void *dZ,
     const sd::LongType *dZShapeInfo,sd::LongType *dimension, sd::LongType dimensionLength, const sd::LongType *tadOnlyShapeInfo,
     const sd::LongType *tadOffsets, const sd::LongType *tadOnlyShapeInfoZ, const sd::LongType *tadOffsetsZ) {
+  sd::LegacyOpScope opScope(sd::LegacyOpKind::BROADCAST_INT, opNum, hXShapeInfo, hYShapeInfo, hZShapeInfo);
   auto xType = sd::ArrayOptions::dataType(hXShapeInfo);
   auto yType = sd::ArrayOptions::dataType(hYShapeInfo);
   auto zType = sd::ArrayOptions::dataType(hZShapeInfo);
@@ -354,7 +383,10 @@ void NativeOpExecutioner::execInverseBroadcastInt(
   auto yLen = shape::length(hYShapeInfo);
   auto numTads = yLen / xLen;
 
-  samediff::Threads::parallel_tad(func, 0, numTads);
+  samediff::Threads::parallel_tad(
+      func, 0, numTads, 1,
+      samediff::ThreadsHelper::numberOfThreadsTad(sd::Environment::getInstance().maxMasterThreads(), numTads,
+                                                  shape::length(hZShapeInfo), samediff::OpCostClass::PAIRWISE));
 }
 
 ////////////////////////////////////////////////////////////////////////
@@ -398,6 +430,7 @@ void NativeOpExecutioner::execPairwiseTransform(sd::LaunchContext *lc, int opNum
                                                 void *dZ,
                                                 const sd::LongType *dZShapeInfo,
                                                 void *extraParams) {
+  sd::LegacyOpScope opScope(sd::LegacyOpKind::PAIRWISE, opNum, hXShapeInfo, hYShapeInfo, hZShapeInfo);
   auto xType = sd::ArrayOptions::dataType(hXShapeInfo);
   auto yType = sd::ArrayOptions::dataType(hYShapeInfo);
   auto zType = sd::ArrayOptions::dataType(hZShapeInfo);
@@ -411,7 +444,8 @@ void NativeOpExecutioner::execPairwiseTransform(sd::LaunchContext *lc, int opNum
   auto zLen = shape::length(hZShapeInfo);
   samediff::Threads::parallel_for(
       func, 0, zLen, 1,
-      sd::math::sd_max<int>(1, sd::math::sd_min<int>(zLen / 1024, sd::Environment::getInstance().maxMasterThreads())));
+      samediff::ThreadsHelper::numberOfThreads(sd::Environment::getInstance().maxMasterThreads(), zLen,
+                                               samediff::OpCostClass::PAIRWISE));
 
 
 
@@ -427,6 +461,7 @@ void NativeOpExecutioner::execPairwiseBoolTransform(sd::LaunchContext *lc, int o
                                                     const sd::LongType *dYShapeInfo, void *hZ,
                                                     const sd::LongType *hZShapeInfo, void *dZ,
                                                     const sd::LongType *dZShapeInfo, void *extraParams) {
+  sd::LegacyOpScope opScope(sd::LegacyOpKind::PAIRWISE_BOOL, opNum, hXShapeInfo, hYShapeInfo, hZShapeInfo);
   auto xType = sd::ArrayOptions::dataType(hXShapeInfo);
   auto yType = sd::ArrayOptions::dataType(hYShapeInfo);
   auto zType = sd::ArrayOptions::dataType(hZShapeInfo);
@@ -448,7 +483,8 @@ void NativeOpExecutioner::execPairwiseBoolTransform(sd::LaunchContext *lc, int o
   auto zLen = shape::length(hZShapeInfo);
   samediff::Threads::parallel_for(
       func, 0, zLen, 1,
-      sd::math::sd_max<int>(1, sd::math::sd_min<int>(zLen / 1024, sd::Environment::getInstance().maxMasterThreads())));
+      samediff::ThreadsHelper::numberOfThreads(sd::Environment::getInstance().maxMasterThreads(), zLen,
+                                               samediff::OpCostClass::PAIRWISE));
 }
 
 ////////////////////////////////////////////////////////////////////////
@@ -459,6 +495,7 @@ void NativeOpExecutioner::execPairwiseIntTransform(sd::LaunchContext *lc, int op
                                                    const sd::LongType *dYShapeInfo, void *hZ,
                                                    const sd::LongType *hZShapeInfo, void *dZ,
                                                    const sd::LongType *dZShapeInfo, void *extraParams) {
+  sd::LegacyOpScope opScope(sd::LegacyOpKind::PAIRWISE_INT, opNum, hXShapeInfo, hYShapeInfo, hZShapeInfo);
   auto xType = sd::ArrayOptions::dataType(hXShapeInfo);
   auto yType = sd::ArrayOptions::dataType(hYShapeInfo);
   auto zType = sd::ArrayOptions::dataType(hZShapeInfo);
@@ -472,7 +509,8 @@ void NativeOpExecutioner::execPairwiseIntTransform(sd::LaunchContext *lc, int op
   auto zLen = shape::length(hZShapeInfo);
   samediff::Threads::parallel_for(
       func, 0, zLen, 1,
-      sd::math::sd_max<int>(1, sd::math::sd_min<int>(zLen / 1024, sd::Environment::getInstance().maxMasterThreads())));
+      samediff::ThreadsHelper::numberOfThreads(sd::Environment::getInstance().maxMasterThreads(), zLen,
+                                               samediff::OpCostClass::PAIRWISE));
 }
 
 ////////////////////////////////////////////////////////////////////////
@@ -490,6 +528,7 @@ void NativeOpExecutioner::execReduceFloat(sd::LaunchContext *lc, int opNum, cons
                                           const sd::LongType *dXShapeInfo, void *extraParams, void *hZ,
                                           const sd::LongType *hZShapeInfo, void *dZ, const sd::LongType *dZShapeInfo,
                                           sd::LongType *dimension, sd::LongType dimensionLength) {
+  sd::LegacyOpScope opScope(sd::LegacyOpKind::REDUCE_FLOAT, opNum, hXShapeInfo, nullptr, hZShapeInfo);
   auto xType = sd::ArrayOptions::dataType(hXShapeInfo);
   auto zType = sd::ArrayOptions::dataType(hZShapeInfo);
   //Note here we continue due to numpy compat which
@@ -508,6 +547,7 @@ void NativeOpExecutioner::execReduceSame(sd::LaunchContext *lc, int opNum, const
                                          const sd::LongType *dXShapeInfo, void *extraParams, void *hZ,
                                          const sd::LongType *hZShapeInfo, void *dZ, const sd::LongType *dZShapeInfo,
                                          sd::LongType *dimension, sd::LongType dimensionLength) {
+  sd::LegacyOpScope opScope(sd::LegacyOpKind::REDUCE_SAME, opNum, hXShapeInfo, nullptr, hZShapeInfo);
   auto xType = sd::ArrayOptions::dataType(hXShapeInfo);
   BUILD_SINGLE_SELECTOR(
       xType, functions::reduce::ReduceSameFunction,
@@ -521,6 +561,7 @@ void NativeOpExecutioner::execReduceBool(sd::LaunchContext *lc, int opNum, const
                                          const sd::LongType *dXShapeInfo, void *extraParams, void *hZ,
                                          const sd::LongType *hZShapeInfo, void *dZ, const sd::LongType *dZShapeInfo,
                                          sd::LongType *dimension, sd::LongType dimensionLength) {
+  sd::LegacyOpScope opScope(sd::LegacyOpKind::REDUCE_BOOL, opNum, hXShapeInfo, nullptr, hZShapeInfo);
   auto xType = sd::ArrayOptions::dataType(hXShapeInfo);
   auto zType = sd::ArrayOptions::dataType(hZShapeInfo);
   BUILD_DOUBLE_SELECTOR(
@@ -535,6 +576,7 @@ void NativeOpExecutioner::execReduceLong(sd::LaunchContext *lc, int opNum, const
                                          const sd::LongType *dXShapeInfo, void *extraParams, void *hZ,
                                          const sd::LongType *hZShapeInfo, void *dZ, const sd::LongType *dZShapeInfo,
                                          sd::LongType *dimension, sd::LongType dimensionLength) {
+  sd::LegacyOpScope opScope(sd::LegacyOpKind::REDUCE_LONG, opNum, hXShapeInfo, nullptr, hZShapeInfo);
   auto xType = sd::ArrayOptions::dataType(hXShapeInfo);
   auto zType = sd::ArrayOptions::dataType(hZShapeInfo);
   BUILD_DOUBLE_SELECTOR(
@@ -557,6 +599,7 @@ void NativeOpExecutioner::execReduceFloatScalar(sd::LaunchContext *lc, int opNum
                                                 const sd::LongType *dXShapeInfo, void *extraParams, void *hZ,
                                                 const sd::LongType *hZShapeInfo, void *dZ,
                                                 const sd::LongType *dZShapeInfo) {
+  sd::LegacyOpScope opScope(sd::LegacyOpKind::REDUCE_FLOAT, opNum, hXShapeInfo, nullptr, hZShapeInfo);
   auto xType = sd::ArrayOptions::dataType(hXShapeInfo);
   auto zType = sd::ArrayOptions::dataType(hZShapeInfo);
 
@@ -571,6 +614,7 @@ void NativeOpExecutioner::execReduceSameScalar(sd::LaunchContext *lc, int opNum,
                                                const sd::LongType *dXShapeInfo, void *extraParams, void *hZ,
                                                const sd::LongType *hZShapeInfo, void *dZ,
                                                const sd::LongType *dZShapeInfo) {
+  sd::LegacyOpScope opScope(sd::LegacyOpKind::REDUCE_SAME, opNum, hXShapeInfo, nullptr, hZShapeInfo);
   auto xType = sd::ArrayOptions::dataType(hXShapeInfo);
   BUILD_SINGLE_SELECTOR(xType, functions::reduce::ReduceSameFunction,
                         ::execScalar(opNum, hX, hXShapeInfo, extraParams, hZ, hZShapeInfo), SD_COMMON_TYPES);
@@ -582,6 +626,7 @@ void NativeOpExecutioner::execReduceBoolScalar(sd::LaunchContext *lc, int opNum,
                                                const sd::LongType *dXShapeInfo, void *extraParams, void *hZ,
                                                const sd::LongType *hZShapeInfo, void *dZ,
                                                const sd::LongType *dZShapeInfo) {
+  sd::LegacyOpScope opScope(sd::LegacyOpKind::REDUCE_BOOL, opNum, hXShapeInfo, nullptr, hZShapeInfo);
   auto xType = sd::ArrayOptions::dataType(hXShapeInfo);
   auto zType = sd::ArrayOptions::dataType(hZShapeInfo);
   BUILD_DOUBLE_SELECTOR(xType, zType, functions::reduce::ReduceBoolFunction,
@@ -595,6 +640,7 @@ void NativeOpExecutioner::execReduceLongScalar(sd::LaunchContext *lc, int opNum,
                                                const sd::LongType *dXShapeInfo, void *extraParams, void *hZ,
                                                const sd::LongType *hZShapeInfo, void *dZ,
                                                const sd::LongType *dZShapeInfo) {
+  sd::LegacyOpScope opScope(sd::LegacyOpKind::REDUCE_LONG, opNum, hXShapeInfo, nullptr, hZShapeInfo);
   auto xType = sd::ArrayOptions::dataType(hXShapeInfo);
   auto zType = sd::ArrayOptions::dataType(hZShapeInfo);
   BUILD_DOUBLE_SELECTOR(xType, zType, functions::reduce::ReduceLongFunction,
@@ -622,6 +668,7 @@ void NativeOpExecutioner::execReduce3Scalar(sd::LaunchContext *lc, int opNum, co
                                             const sd::LongType *hYShapeInfo, const void *dY,
                                             const sd::LongType *dYShapeInfo, void *hZ, const sd::LongType *hZShapeInfo,
                                             void *dZ, const sd::LongType *dZShapeInfo) {
+  sd::LegacyOpScope opScope(sd::LegacyOpKind::REDUCE3, opNum, hXShapeInfo, hYShapeInfo, hZShapeInfo);
   auto xType = sd::ArrayOptions::dataType(hXShapeInfo);
   auto zType = sd::ArrayOptions::dataType(hZShapeInfo);
   BUILD_DOUBLE_SELECTOR(xType, zType, functions::reduce3::Reduce3,
@@ -646,6 +693,7 @@ void NativeOpExecutioner::execReduce3(sd::LaunchContext *lc, int opNum, const vo
                                       const void *hY, const sd::LongType *hYShapeInfo, const void *dY,
                                       const sd::LongType *dYShapeInfo, void *hZ, const sd::LongType *hZShapeInfo,
                                       void *dZ, const sd::LongType *dZShapeInfo) {
+  // latency and counters are recorded by execReduce3Scalar
   NativeOpExecutioner::execReduce3Scalar(lc, opNum, hX, hXShapeInfo, dX, dXShapeInfo, extraParamsVals, hY, hYShapeInfo,
                                          dY, dYShapeInfo, hZ, hZShapeInfo, dZ, dZShapeInfo);
 }
@@ -658,6 +706,7 @@ void NativeOpExecutioner::execReduce3(sd::LaunchContext *lc, int opNum, const vo
                                       void *dZ, const sd::LongType *dZShapeInfo,sd::LongType *dimension, sd::LongType dimensionLength,
                                       const sd::LongType *xTadOnlyShapeInfo, const sd::LongType *xTadOffsets,
                                       const sd::LongType *yTadOnlyShapeInfo, const sd::LongType *yTadOffsets) {
+  sd::LegacyOpScope opScope(sd::LegacyOpKind::REDUCE3, opNum, hXShapeInfo, hYShapeInfo, hZShapeInfo);
   auto xType = sd::ArrayOptions::dataType(hXShapeInfo);
   auto zType = sd::ArrayOptions::dataType(hZShapeInfo);
 
@@ -682,7 +731,12 @@ void NativeOpExecutioner::execReduce3(sd::LaunchContext *lc, int opNum, const vo
                           SD_COMMON_TYPES, SD_FLOAT_TYPES);
   };
 
-  samediff::Threads::parallel_tad(func, 0, tadPack->numberOfTads());
+  samediff::Threads::parallel_tad(
+      func, 0, tadPack->numberOfTads(), 1,
+      samediff::ThreadsHelper::numberOfThreadsTad(sd::Environment::getInstance().maxMasterThreads(),
+                                                  tadPack->numberOfTads(),
+                                                  sd::math::sd_max<sd::LongType>(xLen, yLen),
+                                                  samediff::OpCostClass::REDUCTION));
 }
 
 ////////////////////////////////////////////////////////////////////////
@@ -694,6 +748,7 @@ void NativeOpExecutioner::execReduce3All(sd::LaunchContext *lc, int opNum, const
                                          void *dZ, const sd::LongType *dZShapeInfo,sd::LongType *dimension, sd::LongType dimensionLength,
                                          const sd::LongType *xTadShapeInfo, const sd::LongType *xOffsets,
                                          const sd::LongType *yTadShapeInfo, const sd::LongType *yOffsets) {
+  sd::LegacyOpScope opScope(sd::LegacyOpKind::REDUCE3, opNum, hXShapeInfo, hYShapeInfo, hZShapeInfo);
   auto xType = sd::ArrayOptions::dataType(hXShapeInfo);
   auto zType = sd::ArrayOptions::dataType(hZShapeInfo);
 
@@ -708,7 +763,13 @@ void NativeOpExecutioner::execReduce3All(sd::LaunchContext *lc, int opNum, const
         SD_COMMON_TYPES, SD_FLOAT_TYPES);
   };
 
-  samediff::Threads::parallel_tad(func, 0, tadPack->numberOfTads());
+  // every pair of x and y TADs is reduced
+  auto numElements = shape::length(hZShapeInfo) * shape::length(tadPack->primaryShapeInfo());
+  samediff::Threads::parallel_tad(
+      func, 0, tadPack->numberOfTads(), 1,
+      samediff::ThreadsHelper::numberOfThreadsTad(sd::Environment::getInstance().maxMasterThreads(),
+                                                  tadPack->numberOfTads(), numElements,
+                                                  samediff::OpCostClass::REDUCTION));
 }
 
 ////////////////////////////////////////////////////////////////////////
@@ -720,6 +781,7 @@ void NativeOpExecutioner::execReduce3TAD(sd::LaunchContext *lc, int opNum, const
                                          void *dZ, const sd::LongType *dZShapeInfo,sd::LongType *dimension, sd::LongType dimensionLength,
                                          const sd::LongType *tadShapeInfo, const sd::LongType *tadOffsets,
                                          const sd::LongType *yTadShapeInfo, const sd::LongType *yTadOffsets) {
+  sd::LegacyOpScope opScope(sd::LegacyOpKind::REDUCE3, opNum, hXShapeInfo, hYShapeInfo, hZShapeInfo);
   auto xType = sd::ArrayOptions::dataType(hXShapeInfo);
   auto zType = sd::ArrayOptions::dataType(hZShapeInfo);
 
@@ -744,7 +806,12 @@ void NativeOpExecutioner::execReduce3TAD(sd::LaunchContext *lc, int opNum, const
                           SD_COMMON_TYPES, SD_FLOAT_TYPES);
   };
 
-  samediff::Threads::parallel_tad(func, 0, tadPack->numberOfTads());
+  samediff::Threads::parallel_tad(
+      func, 0, tadPack->numberOfTads(), 1,
+      samediff::ThreadsHelper::numberOfThreadsTad(sd::Environment::getInstance().maxMasterThreads(),
+                                                  tadPack->numberOfTads(),
+                                                  sd::math::sd_max<sd::LongType>(xLen, yLen),
+                                                  samediff::OpCostClass::REDUCTION));
 }
 
 ////////////////////////////////////////////////////////////////////////
@@ -764,6 +831,7 @@ void NativeOpExecutioner::execScalar(sd::LaunchContext *lc, int opNum, const voi
                                      const sd::LongType *hZShapeInfo, void *dZ, const sd::LongType *dZShapeInfo,
                                      const void *hScalar, const sd::LongType *hScalarShapeInfo, const void *dScalar,
                                      const sd::LongType *dScalarShapeInfo, void *extraParams, bool allowParallelism) {
+  sd::LegacyOpScope opScope(sd::LegacyOpKind::SCALAR, opNum, hXShapeInfo, nullptr, hZShapeInfo);
   auto xType = sd::ArrayOptions::dataType(hXShapeInfo);
   auto yType = sd::ArrayOptions::dataType(hScalarShapeInfo);
   auto zType = sd::ArrayOptions::dataType(hZShapeInfo);
@@ -778,8 +846,8 @@ void NativeOpExecutioner::execScalar(sd::LaunchContext *lc, int opNum, const voi
       func, 0, zLen, 1,
       !allowParallelism
       ? 1
-      : sd::math::sd_max<int>(
-          1, sd::math::sd_min<int>(zLen / 1024, sd::Environment::getInstance().maxMasterThreads())));
+      : samediff::ThreadsHelper::numberOfThreads(sd::Environment::getInstance().maxMasterThreads(), zLen,
+                                                 samediff::OpCostClass::ELEMENTWISE));
 
 }
 
@@ -791,6 +859,7 @@ void NativeOpExecutioner::execScalar(sd::LaunchContext *lc, int opNum, void cons
                                      sd::LongType const *dScalarShapeInfo,sd::LongType *dimension, sd::LongType dimensionLength,
                                      sd::LongType const *tadShapeInfo, sd::LongType const *tadOffsets,
                                      sd::LongType const *tadShapeInfoZ, sd::LongType const *tadOffsetsZ) {
+  sd::LegacyOpScope opScope(sd::LegacyOpKind::SCALAR, opNum, hXShapeInfo, nullptr, hZShapeInfo);
   auto xType = sd::ArrayOptions::dataType(hXShapeInfo);
   auto yType = sd::ArrayOptions::dataType(hScalarShapeInfo);
   auto zType = sd::ArrayOptions::dataType(hZShapeInfo);
@@ -804,8 +873,10 @@ void NativeOpExecutioner::execScalar(sd::LaunchContext *lc, int opNum, void cons
   };
 
   auto yLen = shape::length(hScalarShapeInfo);
-  samediff::Threads::parallel_tad(func, 0, yLen, 1,
-                                  sd::math::sd_min<int>(yLen, sd::Environment::getInstance().maxMasterThreads()));
+  samediff::Threads::parallel_tad(
+      func, 0, yLen, 1,
+      samediff::ThreadsHelper::numberOfThreadsTad(sd::Environment::getInstance().maxMasterThreads(), yLen,
+                                                  shape::length(hZShapeInfo), samediff::OpCostClass::ELEMENTWISE));
 
 }
 
@@ -817,6 +888,7 @@ void NativeOpExecutioner::execScalarBool(sd::LaunchContext *lc, int opNum, const
                                          const sd::LongType *hSscalarShapeInfo, const void *dScalar,
                                          const sd::LongType *dSscalarShapeInfo, void *extraParams,
                                          bool allowParallelism) {
+  sd::LegacyOpScope opScope(sd::LegacyOpKind::SCALAR_BOOL, opNum, hXShapeInfo, nullptr, hZShapeInfo);
   auto xType = sd::ArrayOptions::dataType(hXShapeInfo);
   auto yType = sd::ArrayOptions::dataType(hSscalarShapeInfo);
   auto zType = sd::ArrayOptions::dataType(hZShapeInfo);
@@ -835,8 +907,8 @@ void NativeOpExecutioner::execScalarBool(sd::LaunchContext *lc, int opNum, const
       func, 0, zLen, 1,
       !allowParallelism
       ? 1
-      : sd::math::sd_max<int>(
-          1, sd::math::sd_min<int>(zLen / 1024, sd::Environment::getInstance().maxMasterThreads())));
+      : samediff::ThreadsHelper::numberOfThreads(sd::Environment::getInstance().maxMasterThreads(), zLen,
+                                                 samediff::OpCostClass::ELEMENTWISE));
 }
 
 ////////////////////////////////////////////////////////////////////////
@@ -847,6 +919,7 @@ void NativeOpExecutioner::execScalarBool(
     const sd::LongType *dScalarShapeInfo,
     sd::LongType *dimension, sd::LongType dimensionLength, const sd::LongType *tadShapeInfo,
     const sd::LongType *tadOffsets, const sd::LongType *tadShapeInfoZ, const sd::LongType *tadOffsetsZ) {
+  sd::LegacyOpScope opScope(sd::LegacyOpKind::SCALAR_BOOL, opNum, hXShapeInfo, nullptr, hZShapeInfo);
   auto xType = sd::ArrayOptions::dataType(hXShapeInfo);
   auto yType = sd::ArrayOptions::dataType(hScalarShapeInfo);
   auto zType = sd::ArrayOptions::dataType(hZShapeInfo);
@@ -871,8 +944,10 @@ void NativeOpExecutioner::execScalarBool(
   };
 
   auto yLen = shape::length(hScalarShapeInfo);
-  samediff::Threads::parallel_tad(func, 0, yLen, 1,
-                                  sd::math::sd_min<int>(yLen, sd::Environment::getInstance().maxMasterThreads()));
+  samediff::Threads::parallel_tad(
+      func, 0, yLen, 1,
+      samediff::ThreadsHelper::numberOfThreadsTad(sd::Environment::getInstance().maxMasterThreads(), yLen,
+                                                  shape::length(hZShapeInfo), samediff::OpCostClass::ELEMENTWISE));
 }
 
 ////////////////////////////////////////////////////////////////////////
@@ -883,6 +958,7 @@ void NativeOpExecutioner::execScalarInt(sd::LaunchContext *lc, int opNum, const
                                         const sd::LongType *hSscalarShapeInfo, const void *dScalar,
                                         const sd::LongType *dSscalarShapeInfo, void *extraParams,
                                         bool allowParallelism) {
+  sd::LegacyOpScope opScope(sd::LegacyOpKind::SCALAR_INT, opNum, hXShapeInfo, nullptr, hZShapeInfo);
 
   auto xType = sd::ArrayOptions::dataType(hXShapeInfo);
   auto yType = sd::ArrayOptions::dataType(hSscalarShapeInfo);
@@ -912,8 +988,8 @@ void NativeOpExecutioner::execScalarInt(sd::LaunchContext *lc, int opNum, const
       func, 0, zLen, 1,
       !allowParallelism
       ? 1
-      : sd::math::sd_max<int>(
-          1, sd::math::sd_min<int>(zLen / 1024, sd::Environment::getInstance().maxMasterThreads())));
+      : samediff::ThreadsHelper::numberOfThreads(sd::Environment::getInstance().maxMasterThreads(), zLen,
+                                                 samediff::OpCostClass::ELEMENTWISE));
 }
 
 ////////////////////////////////////////////////////////////////////////
@@ -924,6 +1000,7 @@ void NativeOpExecutioner::execScalarInt(
     const sd::LongType *dScalarShapeInfo,
     sd::LongType *dimension, sd::LongType dimensionLength, const sd::LongType *tadShapeInfo,
     const sd::LongType *tadOffsets, const sd::LongType *tadShapeInfoZ, const sd::LongType *tadOffsetsZ) {
+  sd::LegacyOpScope opScope(sd::LegacyOpKind::SCALAR_INT, opNum, hXShapeInfo, nullptr, hZShapeInfo);
   auto xType = sd::ArrayOptions::dataType(hXShapeInfo);
   auto yType = sd::ArrayOptions::dataType(hScalarShapeInfo);
   auto zType = sd::ArrayOptions::dataType(hZShapeInfo);
@@ -949,8 +1026,10 @@ void NativeOpExecutioner::execScalarInt(
   };
 
   auto yLen = shape::length(hScalarShapeInfo);
-  samediff::Threads::parallel_tad(func, 0, yLen, 1,
-                                  sd::math::sd_min<int>(yLen, sd::Environment::getInstance().maxMasterThreads()));
+  samediff::Threads::parallel_tad(
+      func, 0, yLen, 1,
+      samediff::ThreadsHelper::numberOfThreadsTad(sd::Environment::getInstance().maxMasterThreads(), yLen,
+                                                  shape::length(hZShapeInfo), samediff::OpCostClass::ELEMENTWISE));
 }
 
 ////////////////////////////////////////////////////////////////////////
@@ -968,6 +1047,7 @@ void NativeOpExecutioner::execSummaryStats(sd::LaunchContext *lc, int opNum, con
                                            const sd::LongType *dXShapeInfo, void *extraParams, void *hZ,
                                            const sd::LongType *hZShapeInfo, void *dZ, const sd::LongType *dZShapeInfo,
                                            bool biasCorrected) {
+  sd::LegacyOpScope opScope(sd::LegacyOpKind::SUMMARY_STATS, opNum, hXShapeInfo, nullptr, hZShapeInfo);
   auto xType = sd::ArrayOptions::dataType(hXShapeInfo);
   auto zType = sd::ArrayOptions::dataType(hZShapeInfo);
 
@@ -991,6 +1071,7 @@ void NativeOpExecutioner::execSummaryStatsScalar(sd::LaunchContext *lc, int opNu
                                                  const sd::LongType *dXShapeInfo, void *extraParams, void *hZ,
                                                  const sd::LongType *hZShapeInfo, void *dZ,
                                                  const sd::LongType *dZShapeInfo, bool biasCorrected) {
+  sd::LegacyOpScope opScope(sd::LegacyOpKind::SUMMARY_STATS, opNum, hXShapeInfo, nullptr, hZShapeInfo);
   auto xType = sd::ArrayOptions::dataType(hXShapeInfo);
   auto zType = sd::ArrayOptions::dataType(hZShapeInfo);
 
@@ -1017,6 +1098,7 @@ void NativeOpExecutioner::execSummaryStats(sd::LaunchContext *lc, int opNum, con
                                            const sd::LongType *hZShapeInfo, void *dZ, const sd::LongType *dZShapeInfo,
                                            sd::LongType *dimension, sd::LongType dimensionLength, const sd::LongType *tadShapeInfo,
                                            const sd::LongType *tadOffsets, bool biasCorrected) {
+  sd::LegacyOpScope opScope(sd::LegacyOpKind::SUMMARY_STATS, opNum, hXShapeInfo, nullptr, hZShapeInfo);
   auto xType = sd::ArrayOptions::dataType(hXShapeInfo);
   auto zType = sd::ArrayOptions::dataType(hZShapeInfo);
 
@@ -1041,6 +1123,7 @@ void NativeOpExecutioner::execTransformFloat(sd::LaunchContext *lc, int opNum, c
                                              const sd::LongType *hXShapeInfo, const void *dX,
                                              const sd::LongType *dXShapeInfo, void *hZ, const sd::LongType *hZShapeInfo,
                                              void *dZ, const sd::LongType *dZShapeInfo, void *extraParams) {
+  sd::LegacyOpScope opScope(sd::LegacyOpKind::TRANSFORM_FLOAT, opNum, hXShapeInfo, nullptr, hZShapeInfo);
   auto xType = sd::ArrayOptions::dataType(hXShapeInfo);
   auto zType = sd::ArrayOptions::dataType(hZShapeInfo);
 
@@ -1051,8 +1134,9 @@ void NativeOpExecutioner::execTransformFloat(sd::LaunchContext *lc, int opNum, c
   };
 
   samediff::Threads::parallel_do(
-      func, sd::math::sd_max<int>(1, sd::math::sd_min<int>(shape::length(hZShapeInfo) / 1024,
-                                                           sd::Environment::getInstance().maxMasterThreads())));
+      func, samediff::ThreadsHelper::numberOfThreads(sd::Environment::getInstance().maxMasterThreads(),
+                                                     shape::length(hZShapeInfo),
+                                                     samediff::OpCostClass::TRANSCENDENTAL));
 }
 
 ////////////////////////////////////////////////////////////////////////
@@ -1060,6 +1144,7 @@ void NativeOpExecutioner::execTransformBool(sd::LaunchContext *lc, int opNum, co
                                             const sd::LongType *hXShapeInfo, const void *dX,
                                             const sd::LongType *dXShapeInfo, void *hZ, const sd::LongType *hZShapeInfo,
                                             void *dZ, const sd::LongType *dZShapeInfo, void *extraParams) {
+  sd::LegacyOpScope opScope(sd::LegacyOpKind::TRANSFORM_BOOL, opNum, hXShapeInfo, nullptr, hZShapeInfo);
   auto xType = sd::ArrayOptions::dataType(hXShapeInfo);
   auto zType = sd::ArrayOptions::dataType(hZShapeInfo);
 
@@ -1070,8 +1155,8 @@ void NativeOpExecutioner::execTransformBool(sd::LaunchContext *lc, int opNum, co
   };
 
   samediff::Threads::parallel_do(
-      func, sd::math::sd_max<int>(1, sd::math::sd_min<int>(shape::length(hZShapeInfo) / 1024,
-                                                           sd::Environment::getInstance().maxMasterThreads())));
+      func, samediff::ThreadsHelper::numberOfThreads(sd::Environment::getInstance().maxMasterThreads(),
+                                                     shape::length(hZShapeInfo), samediff::OpCostClass::ELEMENTWISE));
 }
 
 ////////////////////////////////////////////////////////////////////////
@@ -1080,10 +1165,21 @@ void NativeOpExecutioner::execTransformAny(sd::LaunchContext *lc, int opNum, con
                                            const sd::LongType *dXShapeInfo, void *hZ, const sd::LongType *hZShapeInfo,
                                            void *dZ, const sd::LongType *dZShapeInfo, void *extraParams,
                                            bool allowParallelism) {
+  sd::LegacyOpScope opScope(sd::LegacyOpKind::TRANSFORM_ANY, opNum, hXShapeInfo, nullptr, hZShapeInfo);
   auto xType = sd::ArrayOptions::dataType(hXShapeInfo);
 
   auto zType = sd::ArrayOptions::dataType(hZShapeInfo);
 
+  // dense casts from/to half, bfloat16 and float8 go through vectorized bulk conversion kernels
+  if (opNum == sd::transform::Assign && xType != zType && !shape::isViewConst(hXShapeInfo) &&
+      !shape::isViewConst(hZShapeInfo) && shape::haveSameShapeAndStrides(hXShapeInfo, hZShapeInfo) &&
+      sd::BulkTypeCast::convert(hX, xType, hZ, zType, shape::length(hZShapeInfo), allowParallelism))
+    return;
+
+  // same-type assign from permuted or strided view goes through strided copy engine
+  if (opNum == sd::transform::Assign && sd::StridedCopy::copy(hX, hXShapeInfo, hZ, hZShapeInfo, allowParallelism))
+    return;
+
   if(sd::DataTypeUtils::isS(xType)) {
     auto func = PRAGMA_THREADS_DO {
       BUILD_DOUBLE_SELECTOR(xType, zType, functions::transform::TransformAny,
@@ -1092,8 +1188,8 @@ void NativeOpExecutioner::execTransformAny(sd::LaunchContext *lc, int opNum, con
     };
 
     samediff::Threads::parallel_do(
-        func, sd::math::sd_max<int>(1, sd::math::sd_min<int>(shape::length(hZShapeInfo) / 1024,
-                                                             sd::Environment::getInstance().maxMasterThreads())));
+        func, samediff::ThreadsHelper::numberOfThreads(sd::Environment::getInstance().maxMasterThreads(),
+                                                     shape::length(hZShapeInfo), samediff::OpCostClass::ELEMENTWISE));
   } else {
     auto func = PRAGMA_THREADS_DO {
       BUILD_DOUBLE_SELECTOR(xType, zType, functions::transform::TransformAny,
@@ -1108,9 +1204,8 @@ void NativeOpExecutioner::execTransformAny(sd::LaunchContext *lc, int opNum, con
     };
 
     samediff::Threads::parallel_do(
-        func, sd::math::sd_max<sd::LongType,sd::LongType,sd::LongType>(1,
-                                                                       sd::math::sd_min<sd::LongType,sd::LongType,sd::LongType>(shape::length(hZShapeInfo) / 1024,
-                                                                                                                                sd::Environment::getInstance().maxMasterThreads())));
+        func, samediff::ThreadsHelper::numberOfThreads(sd::Environment::getInstance().maxMasterThreads(),
+                                                     shape::length(hZShapeInfo), samediff::OpCostClass::ELEMENTWISE));
   }
 
 
@@ -1121,10 +1216,15 @@ void NativeOpExecutioner::execTransformSame(sd::LaunchContext *lc, int opNum, co
                                             const sd::LongType *hXShapeInfo, const void *dX,
                                             const sd::LongType *dXShapeInfo, void *hZ, const sd::LongType *hZShapeInfo,
                                             void *dZ, const sd::LongType *dZShapeInfo, void *extraParams,
-                                            const sd::LongType *tadShapeInfo, const sd::LongType *tadOffsets) {
+                                            const sd::LongType *tadShapeInfo, const sd::LongType *tadOffsets,
+                                            bool allowParallelism) {
+  sd::LegacyOpScope opScope(sd::LegacyOpKind::TRANSFORM_SAME, opNum, hXShapeInfo, nullptr, hZShapeInfo);
   auto xType = sd::ArrayOptions::dataType(hXShapeInfo);
   auto zType = sd::ArrayOptions::dataType(hZShapeInfo);
 
+  // copy from permuted or strided view goes through strided copy engine
+  if (opNum == sd::transform::Copy && sd::StridedCopy::copy(hX, hXShapeInfo, hZ, hZShapeInfo, allowParallelism))
+    return;
 
   auto func = PRAGMA_THREADS_DO {
     BUILD_SINGLE_SELECTOR(xType, functions::transform::TransformSame,
@@ -1133,8 +1233,8 @@ void NativeOpExecutioner::execTransformSame(sd::LaunchContext *lc, int opNum, co
   };
 
   samediff::Threads::parallel_do(
-      func, sd::math::sd_max<int>(1, sd::math::sd_min<int>(shape::length(hZShapeInfo) / 1024,
-                                                           sd::Environment::getInstance().maxMasterThreads())));
+      func, samediff::ThreadsHelper::numberOfThreads(sd::Environment::getInstance().maxMasterThreads(),
+                                                     shape::length(hZShapeInfo), samediff::OpCostClass::ELEMENTWISE));
 }
 
 ////////////////////////////////////////////////////////////////////////
@@ -1143,6 +1243,7 @@ void NativeOpExecutioner::execTransformStrict(sd::LaunchContext *lc, int opNum,
                                               const sd::LongType *dXShapeInfo, void *hZ,
                                               const sd::LongType *hZShapeInfo, void *dZ,
                                               const sd::LongType *dZShapeInfo, void *extraParams) {
+  sd::LegacyOpScope opScope(sd::LegacyOpKind::TRANSFORM_STRICT, opNum, hXShapeInfo, nullptr, hZShapeInfo);
   auto xType = sd::ArrayOptions::dataType(hXShapeInfo);
   auto zType = sd::ArrayOptions::dataType(hZShapeInfo);
 
@@ -1153,14 +1254,16 @@ void NativeOpExecutioner::execTransformStrict(sd::LaunchContext *lc, int opNum,
   };
 
   samediff::Threads::parallel_do(
-      func, sd::math::sd_max<int>(1, sd::math::sd_min<int>(shape::length(hZShapeInfo) / 1024,
-                                                           sd::Environment::getInstance().maxMasterThreads())));
+      func, samediff::ThreadsHelper::numberOfThreads(sd::Environment::getInstance().maxMasterThreads(),
+                                                     shape::length(hZShapeInfo),
+                                                     samediff::OpCostClass::TRANSCENDENTAL));
 }
 
 ////////////////////////////////////////////////////////////////////////
 void NativeOpExecutioner::execRandom(sd::LaunchContext *lc, int opNum, sd::Pointer state, void *hZ,
                                      const sd::LongType *hZShapeInfo, void *dZ, const sd::LongType *dZShapeInfo,
                                      void *extraArguments) {
+  sd::LegacyOpScope opScope(sd::LegacyOpKind::RANDOM, opNum, nullptr, nullptr, hZShapeInfo);
   auto zType = sd::ArrayOptions::dataType(hZShapeInfo);
   BUILD_SINGLE_SELECTOR(zType, functions::random::RandomFunction,
                         ::execTransform(opNum, state, hZ, hZShapeInfo, extraArguments), SD_FLOAT_TYPES);
@@ -1173,6 +1276,7 @@ void NativeOpExecutioner::execRandom(sd::LaunchContext *lc, int opNum, sd::Point
                                      const sd::LongType *hXShapeInfo, const void *dX, const sd::LongType *dXShapeInfo,
                                      void *hZ, const sd::LongType *hZShapeInfo, void *dZ,
                                      const sd::LongType *dZShapeInfo, void *extraArguments) {
+  sd::LegacyOpScope opScope(sd::LegacyOpKind::RANDOM, opNum, hXShapeInfo, nullptr, hZShapeInfo);
   auto zType = sd::ArrayOptions::dataType(hZShapeInfo);
 
   BUILD_SINGLE_SELECTOR(zType, functions::random::RandomFunction,
@@ -1189,6 +1293,7 @@ void NativeOpExecutioner::execRandom(sd::LaunchContext *lc, int opNum, sd::Point
                                      const void *hY, const sd::LongType *hYShapeInfo, const void *dY,
                                      const sd::LongType *dYShapeInfo, void *hZ, const sd::LongType *hZShapeInfo,
                                      void *dZ, const sd::LongType *dZShapeInfo, void *extraArguments) {
+  sd::LegacyOpScope opScope(sd::LegacyOpKind::RANDOM, opNum, hXShapeInfo, hYShapeInfo, hZShapeInfo);
   auto xType = sd::ArrayOptions::dataType(hZShapeInfo);
 
   BUILD_SINGLE_SELECTOR(
@@ -864,7 +864,8 @@ void NativeOpExecutioner::execTransformSame(sd::LaunchContext* lc, int opNum, vo
                                             sd::LongType const* hXShapeInfo, void const* dX, sd::LongType const* dXShapeInfo,
                                             void* hZ, sd::LongType const* hZShapeInfo, void* dZ,
                                             sd::LongType const* dZShapeInfo, void* extraParams,
-                                            sd::LongType const* tadShapeInfo, sd::LongType const* tadOffsets) {
+                                            sd::LongType const* tadShapeInfo, sd::LongType const* tadOffsets,
+                                            bool allowParallelism) {
   auto stream = lc->getCudaStream();
 
   auto xRank = shape::rank(hXShapeInfo);
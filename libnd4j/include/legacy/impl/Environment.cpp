@@ -117,6 +117,14 @@ Environment::Environment() {
     _allowHelpers = false;
   }
 
+  /**
+   * If this env var is defined - activation ops will use approximate mode for low precision inputs by default
+   */
+  const char *approximate_activations = std::getenv("SD_APPROXIMATE_ACTIVATIONS");
+  if (approximate_activations != nullptr) {
+    _approximateActivations = true;
+  }
+
   /**
    * This var defines max amount of host memory library can allocate
    */
@@ -215,6 +223,9 @@ bool Environment::isLogNativeNDArrayCreation() { return _logNativeNDArrayCreatio
 bool Environment::isLogNDArrayEvents() { return _logNDArrayEvenuts.load(); }
 void Environment::setLogNDArrayEvents(bool logNDArrayEvents) { _logNDArrayEvenuts.store(logNDArrayEvents); }
 
+bool Environment::isApproximateActivations() { return _approximateActivations.load(); }
+void Environment::setApproximateActivations(bool reallyApproximate) { _approximateActivations.store(reallyApproximate); }
+
 bool Environment::isCheckInputChange() { return _checkInputChange.load(); }
 void Environment::setCheckInputChange(bool reallyCheck) { _checkInputChange.store(reallyCheck); }
 
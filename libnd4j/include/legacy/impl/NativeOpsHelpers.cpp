@@ -17,13 +17,20 @@
 ******************************************************************************/
 
 #include <graph/GraphExecutioner.h>
+#include <graph/ContextPool.h>
 #include <graph/GraphHolder.h>
 #include <helpers/ConstantTadHelper.h>
 #include <legacy/NativeOps.h>
+#include <ops/declarable/OpCommandBuffer.h>
+#include <ops/declarable/OpExecTraceFile.h>
 #include <ops/declarable/OpRegistrator.h>
+#include <ops/declarable/ShapeFunctionCache.h>
 
 #include "execution/Threads.h"
 #include "helpers/OpTracker.h"
+#include <helpers/HardwareCounters.h>
+#include <helpers/OpLatencyHistograms.h>
+#include <helpers/TimelineTracer.h>
 
 #include <exceptions/allocation_exception.h>
 #include <fcntl.h>
@@ -58,6 +65,7 @@ bool experimentalSupport = false;
 #include <execution/Threads.h>
 #include <graph/Context.h>
 #include <graph/ResultWrapper.h>
+#include <helpers/BulkTypeCast.h>
 #include <helpers/ConstantTadHelper.h>
 #include <helpers/DebugHelper.h>
 
@@ -91,15 +99,15 @@ void convertTypes(sd::Pointer *extras, int srcTypeInt, sd::Pointer hX, sd::LongT
     } else if (dstType == sd::DataType::UINT8) {
       // sd::TypeCast::convertGeneric<float8, uint8>(nullptr, hx, N, hz);
     } else if (dstType == sd::DataType::HALF) {
-      // sd::TypeCast::convertGeneric<float8, float16>(nullptr, hx, N, hz);
+      sd::BulkTypeCast::convert(hx, srcType, hz, dstType, N);
     } else if (dstType == sd::DataType::INT16) {
       // sd::TypeCast::convertGeneric<float8, int16>(nullptr, hx, N, hz);
     } else if (dstType == sd::DataType::UINT16) {
       // sd::TypeCast::convertGeneric<float8, uint16>(nullptr, hx, N, hz);
     } else if (dstType == sd::DataType::FLOAT32) {
-      // sd::TypeCast::convertGeneric<float8, float>(nullptr, hx, N, hz);
+      sd::BulkTypeCast::convert(hx, srcType, hz, dstType, N);
     } else if (dstType == sd::DataType::DOUBLE) {
-      // sd::TypeCast::convertGeneric<float8, double>(nullptr, hx, N, hz);
+      sd::BulkTypeCast::convert(hx, srcType, hz, dstType, N);
     } else {
       sd_debug("Unsupported types conversion: [%s] -> [%s]\n",
                sd::DataTypeUtils::asString(srcType).c_str(),
@@ -151,7 +159,7 @@ void convertTypes(sd::Pointer *extras, int srcTypeInt, sd::Pointer hX, sd::LongT
     }
   } else if (srcType == sd::DataType::HALF) {
     if (dstType == sd::DataType::FLOAT8) {
-      //    sd::TypeCast::convertGeneric<float16, float8>(nullptr, hx, N, hz);
+      sd::BulkTypeCast::convert(hx, srcType, hz, dstType, N);
     } else if (dstType == sd::DataType::INT8) {
       sd::TypeCast::convertGeneric<float16, int8_t>(nullptr, hx, N, hz);
     } else if (dstType == sd::DataType::UINT8) {
@@ -195,7 +203,7 @@ void convertTypes(sd::Pointer *extras, int srcTypeInt, sd::Pointer hX, sd::LongT
     }
   } else if (srcType == sd::DataType::FLOAT32) {
     if (dstType == sd::DataType::FLOAT8) {
-      //    sd::TypeCast::convertGeneric<float, float8>(nullptr, hx, N, hz);
+      sd::BulkTypeCast::convert(hx, srcType, hz, dstType, N);
     } else if (dstType == sd::DataType::INT8) {
       sd::TypeCast::convertGeneric<float, int8_t>(nullptr, hx, N, hz);
     } else if (dstType == sd::DataType::UINT8) {
@@ -215,7 +223,7 @@ void convertTypes(sd::Pointer *extras, int srcTypeInt, sd::Pointer hX, sd::LongT
     }
   } else if (srcType == sd::DataType::DOUBLE) {
     if (dstType == sd::DataType::FLOAT8) {
-      //    sd::TypeCast::convertGeneric<double, float8>(nullptr, hx, N, hz);
+      sd::BulkTypeCast::convert(hx, srcType, hz, dstType, N);
     } else if (dstType == sd::DataType::INT8) {
       sd::TypeCast::convertGeneric<double, int8_t>(nullptr, hx, N, hz);
     } else if (dstType == sd::DataType::UINT8) {
@@ -770,6 +778,188 @@ void printOpTrace() {
 }
 
 
+void exportOpTrace(const char *path) {
+  try {
+    sd::ops::OpExecTraceFile::save(path, *sd::ops::OpRegistrator::getInstance().execTrace());
+  } catch (std::exception &e) {
+    sd::LaunchContext::defaultContext()->errorReference()->setErrorCode(1);
+    sd::LaunchContext::defaultContext()->errorReference()->setErrorMessage(e.what());
+  }
+}
+
+void toggleOpLatencyHistograms(bool enabled) { sd::OpLatencyHistograms::setEnabled(enabled); }
+
+void purgeOpLatencyHistograms() { sd::OpLatencyHistograms::getInstance().reset(); }
+
+sd::LongType opLatencyCount(sd::LongType opHash) {
+  return static_cast<sd::LongType>(sd::OpLatencyHistograms::getInstance().snapshot(opHash).count);
+}
+
+// quantile within [0, 1], i.e. 0.99 for p99. Result is in nanoseconds
+double opLatencyPercentile(sd::LongType opHash, double quantile) {
+  return sd::OpLatencyHistograms::getInstance().snapshot(opHash).percentile(quantile);
+}
+
+sd::LongType opLatencyBytesIn(sd::LongType opHash) {
+  return static_cast<sd::LongType>(sd::OpLatencyHistograms::getInstance().snapshot(opHash).bytesIn);
+}
+
+sd::LongType opLatencyBytesOut(sd::LongType opHash) {
+  return static_cast<sd::LongType>(sd::OpLatencyHistograms::getInstance().snapshot(opHash).bytesOut);
+}
+
+const char *opLatencyReport() { return sd::OpLatencyHistograms::getInstance().report(); }
+
+void toggleTimelineTrace(bool enabled) { sd::TimelineTracer::setEnabled(enabled); }
+
+void purgeTimelineTrace() { sd::TimelineTracer::getInstance().purge(); }
+
+void exportTimelineTrace(const char *path) {
+  try {
+    sd::TimelineTracer::getInstance().save(path);
+  } catch (std::exception &e) {
+    sd::LaunchContext::defaultContext()->errorReference()->setErrorCode(1);
+    sd::LaunchContext::defaultContext()->errorReference()->setErrorMessage(e.what());
+  }
+}
+
+// path may be null or empty, then calibration isn't persisted
+void calibrateThreading(const char *path) {
+  try {
+    if (path == nullptr || std::string(path).empty())
+      samediff::CostModel::getInstance().calibrate();
+    else
+      samediff::CostModel::getInstance().calibrateOrLoad(path);
+  } catch (std::exception &e) {
+    sd::LaunchContext::defaultContext()->errorReference()->setErrorCode(1);
+    sd::LaunchContext::defaultContext()->errorReference()->setErrorMessage(e.what());
+  }
+}
+
+void resetThreadingCalibration() { samediff::CostModel::getInstance().reset(); }
+
+// returns false if counters can't be read on this machine, sampling stays a no-op then
+bool toggleHardwareCounters(bool enabled) {
+  sd::HardwareCounters::setEnabled(enabled);
+  return sd::HardwareCounters::isSupported();
+}
+
+void purgeHardwareCounters() { sd::HardwareCounters::getInstance().reset(); }
+
+const char *hardwareCountersReport() { return sd::HardwareCounters::getInstance().report(); }
+
+void toggleShapeFunctionCache(bool enabled) { sd::ops::ShapeFunctionCache::setEnabled(enabled); }
+
+void purgeShapeFunctionCache() { sd::ops::ShapeFunctionCache::getInstance().purge(); }
+
+void setShapeFunctionCacheCapacity(int entries) {
+  try {
+    sd::ops::ShapeFunctionCache::getInstance().setCapacity(entries);
+  } catch (std::exception &e) {
+    sd::LaunchContext::defaultContext()->errorReference()->setErrorCode(1);
+    sd::LaunchContext::defaultContext()->errorReference()->setErrorMessage(e.what());
+  }
+}
+
+sd::LongType shapeFunctionCacheHits() { return sd::ops::ShapeFunctionCache::getInstance().hits(); }
+
+sd::LongType shapeFunctionCacheMisses() { return sd::ops::ShapeFunctionCache::getInstance().misses(); }
+
+// statuses must have room for one status per command, see OpCommandBuffer for buffer layout
+sd::Status execCommandBuffer(sd::Pointer *extraPointers, sd::LongType *buffer, sd::LongType length,
+                             OpaqueNDArrayArr arrays, int numArrays, int *statuses, bool parallel) {
+  try {
+    sd::ops::OpCommandBuffer commands(buffer, length, arrays, numArrays);
+    auto status = commands.execute(reinterpret_cast<sd::Status *>(statuses), parallel);
+    if (!commands.lastError().empty()) {
+      sd::LaunchContext::defaultContext()->errorReference()->setErrorCode(1);
+      sd::LaunchContext::defaultContext()->errorReference()->setErrorMessage(commands.lastError());
+    }
+
+    return status;
+  } catch (std::exception &e) {
+    sd::LaunchContext::defaultContext()->errorReference()->setErrorCode(1);
+    sd::LaunchContext::defaultContext()->errorReference()->setErrorMessage(e.what());
+    return sd::Status::BAD_INPUT;
+  }
+}
+
+OpaquePreparedCall *prepareCall(sd::LongType opHash, sd::LongType *iArgs, int numIArgs, double *tArgs, int numTArgs,
+                                bool *bArgs, int numBArgs, int *dArgs, int numDArgs, bool inplace) {
+  try {
+    std::vector<sd::DataType> dtypes(numDArgs);
+    for (int e = 0; e < numDArgs; e++) dtypes[e] = sd::DataTypeUtils::fromInt(dArgs[e]);
+
+    return sd::graph::ContextPool::getInstance().prepare(opHash, iArgs, numIArgs, tArgs, numTArgs, bArgs, numBArgs,
+                                                         dtypes.data(), numDArgs, inplace);
+  } catch (std::exception &e) {
+    sd::LaunchContext::defaultContext()->errorReference()->setErrorCode(1);
+    sd::LaunchContext::defaultContext()->errorReference()->setErrorMessage(e.what());
+    return nullptr;
+  }
+}
+
+void setPreparedCallInput(OpaquePreparedCall *call, int index, OpaqueNDArray array) {
+  try {
+    call->setInput(index, array);
+  } catch (std::exception &e) {
+    sd::LaunchContext::defaultContext()->errorReference()->setErrorCode(1);
+    sd::LaunchContext::defaultContext()->errorReference()->setErrorMessage(e.what());
+  }
+}
+
+void setPreparedCallOutput(OpaquePreparedCall *call, int index, OpaqueNDArray array) {
+  try {
+    call->setOutput(index, array);
+  } catch (std::exception &e) {
+    sd::LaunchContext::defaultContext()->errorReference()->setErrorCode(1);
+    sd::LaunchContext::defaultContext()->errorReference()->setErrorMessage(e.what());
+  }
+}
+
+int bindPreparedCallOutputShapes(OpaquePreparedCall *call) {
+  try {
+    return call->bindOutputShapes();
+  } catch (std::exception &e) {
+    sd::LaunchContext::defaultContext()->errorReference()->setErrorCode(1);
+    sd::LaunchContext::defaultContext()->errorReference()->setErrorMessage(e.what());
+    return -1;
+  }
+}
+
+sd::LongType *preparedCallOutputShape(OpaquePreparedCall *call, int index) {
+  try {
+    return const_cast<sd::LongType *>(call->outputShape(index));
+  } catch (std::exception &e) {
+    sd::LaunchContext::defaultContext()->errorReference()->setErrorCode(1);
+    sd::LaunchContext::defaultContext()->errorReference()->setErrorMessage(e.what());
+    return nullptr;
+  }
+}
+
+sd::Status execPreparedCall(sd::Pointer *extraPointers, OpaquePreparedCall *call) {
+  try {
+    return call->execute();
+  } catch (std::exception &e) {
+    sd::LaunchContext::defaultContext()->errorReference()->setErrorCode(1);
+    sd::LaunchContext::defaultContext()->errorReference()->setErrorMessage(e.what());
+    return sd::Status::KERNEL_FAILURE;
+  }
+}
+
+void releasePreparedCall(OpaquePreparedCall *call) { sd::graph::ContextPool::getInstance().release(call); }
+
+void setContextPoolMaxIdle(int maxIdle) {
+  try {
+    sd::graph::ContextPool::getInstance().setMaxIdle(maxIdle);
+  } catch (std::exception &e) {
+    sd::LaunchContext::defaultContext()->errorReference()->setErrorCode(1);
+    sd::LaunchContext::defaultContext()->errorReference()->setErrorMessage(e.what());
+  }
+}
+
+void purgeContextPool() { sd::graph::ContextPool::getInstance().purge(); }
+
 std::vector<ExecTrace*> * listOpTraces() {
   return sd::ops::OpRegistrator::getInstance().execTrace();
 }
@@ -347,6 +347,19 @@ void Broadcast<X, Y, Z>::exec(const int opNum, const void *x, const sd::LongType
 template <typename X, typename Y, typename Z, typename OpType>
 static void execDefault(const X *x, const sd::LongType *xShapeInfo, const Y *y, const sd::LongType *yShapeInfo, Z *z,
                         const sd::LongType *zShapeInfo) {
+  // x and y have unit dimensions in place of broadcast ones, those get zero strides in collapsed loop
+  sd::CollapsedLoop loop;
+  if (sd::LoopKind::collapseXYZ(xShapeInfo, yShapeInfo, zShapeInfo, loop)) {
+    auto func = PRAGMA_THREADS_FOR {
+      sd::LoopKind::iterate(loop, start, stop, [&](sd::LongType xOffset, sd::LongType yOffset, sd::LongType zOffset) {
+        z[zOffset] = OpType::op(x[xOffset], y[yOffset]);
+      });
+    };
+
+    samediff::Threads::parallel_for(func, static_cast<sd::LongType>(0), shape::length(zShapeInfo));
+    return;
+  }
+
   // Cache shape-related values
   sd::LongType xRank = shape::rank(xShapeInfo);
   sd::LongType yRank = shape::rank(yShapeInfo);
@@ -110,6 +110,16 @@ SD_INLINE void PairWiseTransform<X, Y, Z>::exec(const void *vx,
   sd::LongType *xStride = shape::stride(xShapeInfo);
   sd::LongType *yStride = shape::stride(yShapeInfo);
   sd::LongType *zStride = shape::stride(zShapeInfo);
+  // dimensions are collapsed first, so most real arrays end up with rank 1 or 2 here
+  sd::CollapsedLoop loop;
+  if (shape::shapeEquals(xShapeInfo, yShapeInfo, zShapeInfo) &&
+      sd::LoopKind::collapseXYZ(xShapeInfo, yShapeInfo, zShapeInfo, loop)) {
+    sd::LoopKind::iterate(loop, start, stop, [&](sd::LongType xOffset, sd::LongType yOffset, sd::LongType zOffset) {
+      z[zOffset] = OpType::op(x[xOffset], y[yOffset], extraParams);
+    });
+    return;
+  }
+
   bool allSameOrder = shape::order(xShapeInfo) == shape::order(yShapeInfo) && shape::order(xShapeInfo) == shape::order(zShapeInfo);
   if (shape::haveSameShapeAndStrides(xShapeInfo, yShapeInfo)
       && shape::haveSameShapeAndStrides(xShapeInfo, zShapeInfo)
@@ -86,6 +86,16 @@ void PairWiseBoolTransform<X, Z>::exec(const void *vx, const sd::LongType *xShap
     return;
   }
 
+  // dimensions are collapsed first, so most real arrays end up with rank 1 or 2 here
+  sd::CollapsedLoop loop;
+  if (shape::shapeEquals(xShapeInfo, yShapeInfo, zShapeInfo) &&
+      sd::LoopKind::collapseXYZ(xShapeInfo, yShapeInfo, zShapeInfo, loop)) {
+    sd::LoopKind::iterate(loop, start, stop, [&](sd::LongType xOffset, sd::LongType yOffset, sd::LongType zOffset) {
+      z[zOffset] = OpType::op(x[xOffset], y[yOffset], extraParams);
+    });
+    return;
+  }
+
   const sd::LoopKind::Kind kindOfLoop = sd::LoopKind::deduceKindOfLoopXYZ(xShapeInfo, yShapeInfo, zShapeInfo);
   const bool sameShapesXY = shape::shapeEquals(xShapeInfo, yShapeInfo);
   const bool isSameLength = shape::length(xShapeInfo) == shape::length(yShapeInfo);
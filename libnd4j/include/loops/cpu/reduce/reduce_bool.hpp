@@ -79,7 +79,7 @@ void SD_HOST ReduceBoolFunction<X, Z>::execScalar(const void *vx, const sd::Long
         intermediate[thread_id] = OpType::update(intermediate[thread_id], OpType::op(x[indexOffset], extraParams), extraParams);
       }
     };
-    maxThreads = samediff::Threads::parallel_for(func, 0, length, 1, maxThreads);
+    maxThreads = samediff::Threads::parallel_for(func, 0, length, 1, maxThreads, samediff::OpCostClass::REDUCTION);
     PRAGMA_OMP_SIMD
     for (int e = 1; e < maxThreads; e++) {
       intermediate[0] = OpType::update(intermediate[0], intermediate[e], extraParams);
@@ -92,7 +92,7 @@ void SD_HOST ReduceBoolFunction<X, Z>::execScalar(const void *vx, const sd::Long
         intermediate[thread_id] = OpType::update(intermediate[thread_id], OpType::op(x[i], extraParams), extraParams);
       }
     };
-    maxThreads = samediff::Threads::parallel_for(func, 0, length, 1, maxThreads);
+    maxThreads = samediff::Threads::parallel_for(func, 0, length, 1, maxThreads, samediff::OpCostClass::REDUCTION);
     PRAGMA_OMP_SIMD
     for (int e = 1; e < maxThreads; e++) {
       intermediate[0] = OpType::update(intermediate[0], intermediate[e], extraParams);
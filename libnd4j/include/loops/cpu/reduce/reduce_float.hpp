@@ -81,20 +81,23 @@ void SD_HOST ReduceFloatFunction<X, Z>::execScalar(const void *vx, const sd::Lon
         intermediate[thread_id] = OpType::update(intermediate[thread_id], OpType::op(x[indexOffset], extraParams), extraParams);
       }
     };
-    maxThreads = samediff::Threads::parallel_for(func, 0, length, 1, maxThreads);
+    maxThreads = samediff::Threads::parallel_for(func, 0, length, 1, maxThreads, samediff::OpCostClass::REDUCTION);
     PRAGMA_OMP_SIMD
     for (int e = 1; e < maxThreads; e++) {
       intermediate[0] = OpType::update(intermediate[0], intermediate[e], extraParams);
     }
 
     z[0] = OpType::postProcess(intermediate[0], length, extraParams);
+  } else if (sd::reductions::HasLaneKernel<OpType, X, Z>::value) {
+    z[0] = OpType::postProcess(sd::reductions::reduceContiguousParallel<OpType, X, Z>(x, length, extraParams), length,
+                               extraParams);
   } else {
     auto func = PRAGMA_THREADS_FOR {
       for (auto i = start; i < stop; i++) {
         intermediate[thread_id] = OpType::update(intermediate[thread_id], OpType::op(x[i], extraParams), extraParams);
       }
     };
-    maxThreads = samediff::Threads::parallel_for(func, 0, length, 1, maxThreads);
+    maxThreads = samediff::Threads::parallel_for(func, 0, length, 1, maxThreads, samediff::OpCostClass::REDUCTION);
     PRAGMA_OMP_SIMD
     for (int e = 1; e < maxThreads; e++) {
       intermediate[0] = OpType::update(intermediate[0], intermediate[e], extraParams);
@@ -111,6 +114,10 @@ Z SD_HOST ReduceFloatFunction<X, Z>::execScalar(const void *vx, const sd::LongTy
   auto extraParams = reinterpret_cast<Z *>(vextraParams);
 
   const sd::LongType length = shape::length(xShapeInfo);
+  if (!shape::isViewConst(xShapeInfo) && sd::reductions::HasLaneKernel<OpType, X, Z>::value)
+    return OpType::postProcess(sd::reductions::reduceContiguousParallel<OpType, X, Z>(x, length, extraParams), length,
+                               extraParams);
+
   auto startingValue = OpType::startingValue(x);
 
   sd::LongType xShapeInfoCast[SD_MAX_RANK];
@@ -157,6 +164,10 @@ Z SD_HOST ReduceFloatFunction<X, Z>::execScalar(const void *vx, sd::LongType xEw
                                                 void *vextraParams) {
   auto x = reinterpret_cast<const X *>(vx);
   auto extraParams = reinterpret_cast<Z *>(vextraParams);
+  if (xEws == 1 && sd::reductions::HasLaneKernel<OpType, X, Z>::value)
+    return OpType::postProcess(sd::reductions::reduceContiguousParallel<OpType, X, Z>(x, length, extraParams), length,
+                               extraParams);
+
   int maxThreads = sd::math::sd_min<int>(64, sd::Environment::getInstance().maxThreads());
   using Y = typename OpType::InterType;
   Y intermediate[64];
@@ -175,7 +186,7 @@ Z SD_HOST ReduceFloatFunction<X, Z>::execScalar(const void *vx, sd::LongType xEw
     }
   };
 
-  maxThreads = samediff::Threads::parallel_for(func, 0, length, 1, maxThreads);
+  maxThreads = samediff::Threads::parallel_for(func, 0, length, 1, maxThreads, samediff::OpCostClass::REDUCTION);
 
   for (int e = 1; e < maxThreads; e++)
     intermediate[0] = OpType::update(intermediate[0], intermediate[e], extraParams);
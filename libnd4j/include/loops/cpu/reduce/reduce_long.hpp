@@ -81,7 +81,7 @@ void SD_HOST ReduceLongFunction<X, Z>::execScalar(const void *vx, const sd::Long
           extraParams);
     }
   };
-  maxThreads = samediff::Threads::parallel_for(func, 0, length, 1, maxThreads);
+  maxThreads = samediff::Threads::parallel_for(func, 0, length, 1, maxThreads, samediff::OpCostClass::REDUCTION);
 
   for (int e = 1; e < maxThreads; e++)
     intermediate[0] = OpType::update(intermediate[0], intermediate[e], extraParams);
@@ -163,7 +163,7 @@ Z SD_HOST ReduceLongFunction<X, Z>::execScalar(const void *vx, sd::LongType xEws
     }
   };
 
-  maxThreads = samediff::Threads::parallel_for(func, 0, length, 1, maxThreads);
+  maxThreads = samediff::Threads::parallel_for(func, 0, length, 1, maxThreads, samediff::OpCostClass::REDUCTION);
 
   for (int e = 1; e < maxThreads; e++)
     intermediate[0] = OpType::update(intermediate[0], intermediate[e], extraParams);
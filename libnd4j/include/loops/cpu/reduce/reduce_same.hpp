@@ -81,20 +81,23 @@ void SD_HOST ReduceSameFunction<X>::execScalar(const void *vx, const sd::LongTyp
         intermediate[thread_id] = OpType::update(intermediate[thread_id], OpType::op(x[indexOffset], extraParams), extraParams);
       }
     };
-    maxThreads = samediff::Threads::parallel_for(func, 0, length, 1, maxThreads);
+    maxThreads = samediff::Threads::parallel_for(func, 0, length, 1, maxThreads, samediff::OpCostClass::REDUCTION);
     PRAGMA_OMP_SIMD
     for (int e = 1; e < maxThreads; e++) {
       intermediate[0] = OpType::update(intermediate[0], intermediate[e], extraParams);
     }
 
     z[0] = OpType::postProcess(intermediate[0], length, extraParams);
+  } else if (sd::reductions::HasLaneKernel<OpType, X, X>::value) {
+    z[0] = OpType::postProcess(sd::reductions::reduceContiguousParallel<OpType, X, X>(x, length, extraParams), length,
+                               extraParams);
   } else {
     auto func = PRAGMA_THREADS_FOR {
       for (auto i = start; i < stop; i++) {
         intermediate[thread_id] = OpType::update(intermediate[thread_id], OpType::op(x[i], extraParams), extraParams);
       }
     };
-    maxThreads = samediff::Threads::parallel_for(func, 0, length, 1, maxThreads);
+    maxThreads = samediff::Threads::parallel_for(func, 0, length, 1, maxThreads, samediff::OpCostClass::REDUCTION);
     PRAGMA_OMP_SIMD
     for (int e = 1; e < maxThreads; e++) {
       intermediate[0] = OpType::update(intermediate[0], intermediate[e], extraParams);
@@ -117,6 +120,10 @@ X SD_HOST ReduceSameFunction<X>::execScalar(const void *vx, const sd::LongType *
     return OpType::startingValue(x);
   }
 
+  if (!shape::isViewConst(xShapeInfo) && sd::reductions::HasLaneKernel<OpType, X, X>::value)
+    return OpType::postProcess(sd::reductions::reduceContiguousParallel<OpType, X, X>(x, length, extraParams), length,
+                               extraParams);
+
   auto startingValue = OpType::startingValue(x);
   sd::LongType xRank = shape::rank(xShapeInfo);
   sd::LongType* xShape = shape::shapeOf(xShapeInfo);
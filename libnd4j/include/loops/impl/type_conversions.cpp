@@ -19,7 +19,9 @@
 //
 // Created by raver on 6/12/2018.
 //
+#include <array/DataTypeUtils.h>
 #include <execution/Threads.h>
+#include <helpers/BulkTypeCast.h>
 #include <helpers/OmpLaunchHelper.h>
 #include <loops/type_conversions.h>
 #include <system/op_boilerplate.h>
@@ -198,6 +200,9 @@ void TypeCast::convertFromThreshold(Pointer *extras, const void *dx, LongType N,
  */
 template <typename S, typename T>
 void TypeCast::convertGeneric(Pointer *extras, void *dx, LongType N, void *dz) {
+  // conversions from/to half, bfloat16 and float8 have dedicated vectorized kernels
+  if (BulkTypeCast::convert(dx, DataTypeUtils::fromT<S>(), dz, DataTypeUtils::fromT<T>(), N)) return;
+
   auto x = reinterpret_cast<S *>(dx);
   auto z = reinterpret_cast<T *>(dz);
 
@@ -24,6 +24,7 @@
 
 #include "../Workspace.h"
 
+#include <helpers/TimelineTracer.h>
 #include <helpers/logger.h>
 #include <math/templatemath.h>
 #include <stdio.h>
@@ -125,6 +126,8 @@ void *Workspace::allocateBytes(sd::LongType numBytes) {
   if (_offset.load() + numBytes > _currentSize) {
     sd_debug("Allocating %lld bytes in spills\n", numBytes);
     this->_mutexAllocation.unlock();
+    if (TimelineTracer::isEnabled())
+      TimelineTracer::getInstance().instant(TimelineCategory::MEMORY, "workspace_spill", numBytes);
 #if defined(SD_ALIGNED_ALLOC)
     void *p = aligned_alloc(SD_DESIRED_ALIGNMENT, (numBytes + SD_DESIRED_ALIGNMENT - 1) & (-SD_DESIRED_ALIGNMENT));
 #else
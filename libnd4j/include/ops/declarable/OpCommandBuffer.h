@@ -0,0 +1,110 @@
+/* ******************************************************************************
+ *
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ *  See the NOTICE file distributed with this work for additional
+ *  information regarding copyright ownership.
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ******************************************************************************/
+
+//
+// Batch of custom op invocations executed with single native call
+//
+
+#ifndef LIBND4J_OPCOMMANDBUFFER_H
+#define LIBND4J_OPCOMMANDBUFFER_H
+#include <array/NDArray.h>
+#include <system/common.h>
+
+#include <string>
+#include <vector>
+
+namespace sd {
+namespace ops {
+
+class DeclarableOp;
+
+/**
+ * This class decodes and executes sequence of custom op calls encoded into one flat buffer, so eager callers pay
+ * for crossing native boundary once per batch instead of once per op and argument setter.
+ *
+ * Buffer layout, all values are LongType:
+ *   header: version, flags, number of commands
+ *   command: op hash, command flags, number of inputs, outputs, iArgs, tArgs, bArgs, dArgs and dependencies, then
+ *            input handles, output handles, iArgs, tArgs (raw double bits), bArgs (0 or 1), dArgs (DataType values),
+ *            dependencies (indices of earlier commands)
+ * Handles are indices within array of NDArray pointers passed along with the buffer. Outputs must be preallocated.
+ *
+ * Without FLAG_DEPENDENCIES commands run in order, and execution stops at first failure. With FLAG_DEPENDENCIES
+ * dependencies are treated as complete: commands are grouped into levels, commands within one level may run in
+ * parallel, and commands depending on failed ones are skipped.
+ */
+class SD_LIB_EXPORT OpCommandBuffer {
+ public:
+  static const LongType VERSION = 1;
+
+  // buffer flags
+  static const LongType FLAG_DEPENDENCIES = 1;
+
+  // command flags
+  static const LongType FLAG_INPLACE = 1;
+
+  struct Command {
+    DeclarableOp *op = nullptr;
+    bool inplace = false;
+    std::vector<NDArray *> inputs;
+    std::vector<NDArray *> outputs;
+    std::vector<LongType> iArgs;
+    std::vector<double> tArgs;
+    std::vector<bool> bArgs;
+    std::vector<DataType> dArgs;
+    std::vector<int> dependencies;
+    // 0 for commands without dependencies
+    int level = 0;
+  };
+
+ private:
+  std::vector<Command> _commands;
+  bool _hasDependencies = false;
+  int _numLevels = 0;
+  std::string _lastError;
+
+  Status executeCommand(Command &command, std::string &error);
+
+ public:
+  /**
+   * Throws if buffer is malformed, references unknown op or array handle, or has forward dependencies
+   */
+  OpCommandBuffer(const LongType *buffer, LongType length, NDArray **arrays, LongType numArrays);
+
+  int size() const { return static_cast<int>(_commands.size()); }
+  int numLevels() const { return _numLevels; }
+  bool hasDependencies() const { return _hasDependencies; }
+  const Command &at(int index) const { return _commands.at(index); }
+
+  /**
+   * This method executes all commands and writes status of each one into statuses, commands that weren't executed
+   * get Status::MAYBE. Commands within one level run in parallel only if parallel is true.
+   *
+   * Returns Status::OK, or status of first failed command
+   */
+  Status execute(Status *statuses, bool parallel);
+
+  /**
+   * Message of first exception thrown during last execute() call, empty if there was none
+   */
+  const std::string &lastError() const { return _lastError; }
+};
+}  // namespace ops
+}  // namespace sd
+
+#endif  // LIBND4J_OPCOMMANDBUFFER_H
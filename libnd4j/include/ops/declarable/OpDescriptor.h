@@ -168,6 +168,9 @@ class SD_LIB_EXPORT OpDescriptor {
   // field for ops that allow data type override at runtime
   bool _dtypeOverride = false;
 
+  // output shapes depend on input values, not only on input shapes and arguments, so they can't be memoized
+  bool _dataDependentShape = false;
+
   bool checkDataTypesMatch(DataType needle, std::vector<DataType>& haystack) const;
 
  public:
@@ -250,6 +253,7 @@ class SD_LIB_EXPORT OpDescriptor {
   OpDescriptor* setAllowedOutputTypes(DataType dtype);
   OpDescriptor* allowOverride(bool reallyAllow);
   OpDescriptor* setSameMode(bool reallySame);
+  OpDescriptor* setDataDependentShape(bool reallyDependent);
   OpDescriptor* setInputType(int idx, DataType dtype);
   OpDescriptor* setOutputType(int idx, DataType dtype);
 
@@ -261,6 +265,7 @@ class SD_LIB_EXPORT OpDescriptor {
   bool checkInputMatch(int index, DataType dataType);
   bool checkOutputMatch(int index, DataType dataType);
   bool isSameMode();
+  bool isDataDependentShape();
 
   bool isInherit(int index);
 };
@@ -0,0 +1,63 @@
+/* ******************************************************************************
+ *
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ *  See the NOTICE file distributed with this work for additional
+ *  information regarding copyright ownership.
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ******************************************************************************/
+
+//
+// Text serialization of OpExecTrace entries, used for offline workload replay
+//
+
+#ifndef LIBND4J_OPEXECTRACEFILE_H
+#define LIBND4J_OPEXECTRACEFILE_H
+#include <ops/declarable/OpDescriptor.h>
+
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace sd {
+namespace ops {
+
+/**
+ * This class saves and loads op execution traces recorded by OpRegistrator when op tracing is enabled.
+ *
+ * Format is line based text, one record per op call:
+ *   op <name> <opType>
+ *   in <shapeInfo length> <shapeInfo values...>     (one line per input)
+ *   out <shapeInfo length> <shapeInfo values...>    (one line per output)
+ *   i|t|b|d <count> <values...>
+ *   s <count> <length>:<chars>...
+ *   end
+ *
+ * Only shapes, data types and arguments are stored, array contents are never written.
+ */
+class SD_LIB_EXPORT OpExecTraceFile {
+ public:
+  static void write(std::ostream &stream, const std::vector<OpExecTrace *> &traces);
+  static void save(const std::string &path, const std::vector<OpExecTrace *> &traces);
+
+  /**
+   * Loaded traces own their op names and shape buffers, use release() to free them
+   */
+  static std::vector<OpExecTrace *> read(std::istream &stream);
+  static std::vector<OpExecTrace *> load(const std::string &path);
+
+  static void release(std::vector<OpExecTrace *> &traces);
+};
+}  // namespace ops
+}  // namespace sd
+
+#endif  // LIBND4J_OPEXECTRACEFILE_H
@@ -24,10 +24,13 @@
 #define LIBND4J_OPREGISTRATOR_H
 
 #include <execution/Engine.h>
+#include <helpers/PerfectHashTable.h>
 #include <ops/declarable/DeclarableOp.h>
 #include <ops/declarable/PlatformHelper.h>
 #include <ops/declarable/PlatformHelperLegacy.h>
 
+#include <atomic>
+#include <memory>
 #include <mutex>
 #include <unordered_map>
 #include <vector>
@@ -83,6 +86,23 @@ class SD_LIB_EXPORT OpRegistrator {
   SD_MAP_IMPL<std::pair<std::string, samediff::Engine>, platforms::PlatformHelper*> _helpersH;
   std::vector<platforms::PlatformHelper*> _uniqueH;
 
+#ifndef __JAVACPP_HACK__
+  typedef PerfectHashTable<LongType, DeclarableOp*> OpsTable;
+  typedef PerfectHashTable<std::pair<LongType, samediff::Engine>, platforms::PlatformHelper*> HelpersTable;
+
+  // frozen lookup tables, built on first lookup and rebuilt on late registration. Replaced tables are kept alive,
+  // since lookups don't take locks and may still read them
+  std::atomic<OpsTable*> _opsTable{nullptr};
+  std::atomic<HelpersTable*> _helpersTable{nullptr};
+  std::vector<std::unique_ptr<OpsTable>> _opsTables;
+  std::vector<std::unique_ptr<HelpersTable>> _helpersTables;
+
+  // these methods must be called under _locker
+  OpsTable* rebuildOperations();
+  HelpersTable* rebuildHelpers();
+  void insertOperation(const std::string& name, DeclarableOp* op);
+  DeclarableOp* lookupOperationSlow(LongType hash);
+#endif
 
   std::mutex _locker;
   std::string _opsList;
@@ -125,6 +145,11 @@ class SD_LIB_EXPORT OpRegistrator {
 
   platforms::PlatformHelper* getPlatformHelper(LongType hash, samediff::Engine engine);
 
+  /**
+   * This method returns helper for given op and engine, or nullptr if there's none. Single lookup for hot path
+   */
+  platforms::PlatformHelper* findPlatformHelper(LongType hash, samediff::Engine engine);
+
   std::vector<LongType> getAllHashes();
 
   int numberOfOperations();
@@ -0,0 +1,126 @@
+/* ******************************************************************************
+ *
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ *  See the NOTICE file distributed with this work for additional
+ *  information regarding copyright ownership.
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ******************************************************************************/
+
+//
+// Memoization of DeclarableOp::calculateOutputShape results
+//
+
+#ifndef LIBND4J_SHAPEFUNCTIONCACHE_H
+#define LIBND4J_SHAPEFUNCTIONCACHE_H
+#include <array/ShapeList.h>
+#include <graph/Context.h>
+#include <system/common.h>
+
+#include <atomic>
+#include <list>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace sd {
+namespace ops {
+
+class DeclarableOp;
+
+/**
+ * This class keeps output shapes computed by op shape functions, so repeated calls with the same input shapes and
+ * arguments skip calculateOutputShape and ConstantShapeHelper lookups.
+ *
+ * Key is built from op hash, contents of input and provided output shapeInfos, and i/t/b/d/s arguments and axis.
+ * Values of inputs never get into the key: ops whose shape functions read them (shapes, axes, sizes or ranges passed
+ * as arrays) are marked with OpDescriptor::setDataDependentShape() and aren't cached. Cached shapeInfos are taken from
+ * ConstantShapeHelper, so they stay valid for process lifetime.
+ *
+ * Only fast path calls are cached. Calls are never cached for data dependent ops and for ops with string inputs. Cache is split into shards, each one is bounded and evicts least recently used
+ * entries.
+ */
+class SD_LIB_EXPORT ShapeFunctionCache {
+ public:
+  static const int NUM_SHARDS = 16;
+
+ private:
+  struct KeyHash {
+    size_t operator()(const std::vector<LongType> &key) const;
+  };
+
+  struct Entry {
+    std::vector<LongType *> shapes;
+    std::list<const std::vector<LongType> *>::iterator position;
+  };
+
+  struct Shard {
+    std::mutex lock;
+    std::unordered_map<std::vector<LongType>, Entry, KeyHash> entries;
+    // most recently used keys go first
+    std::list<const std::vector<LongType> *> order;
+  };
+
+  static std::atomic<bool> _enabled;
+
+  Shard _shards[NUM_SHARDS];
+  std::atomic<int> _capacity{16384};
+
+  std::atomic<LongType> _hits{0};
+  std::atomic<LongType> _misses{0};
+  std::atomic<LongType> _evictions{0};
+
+  ShapeFunctionCache() = default;
+
+  Shard &shardFor(const std::vector<LongType> &key);
+
+ public:
+  static ShapeFunctionCache &getInstance();
+
+  static bool isEnabled() { return _enabled.load(std::memory_order_relaxed); }
+  static void setEnabled(bool enabled);
+
+  /**
+   * This method builds cache key for given call. Returns false if call can't be cached
+   */
+  static bool buildKey(DeclarableOp *op, graph::Context &ctx, std::vector<LongType> &key);
+
+  /**
+   * This method returns cached shapes for given key, or nullptr. Returned list doesn't own its shapes
+   */
+  ShapeList *lookup(const std::vector<LongType> &key);
+
+  /**
+   * This method stores constant copies of given shapes under given key
+   */
+  void store(const std::vector<LongType> &key, ShapeList *shapes);
+
+  /**
+   * Maximal number of entries, split evenly between shards. Extra entries are evicted on next store
+   */
+  void setCapacity(int entries);
+  int capacity() const;
+
+  LongType hits() const;
+  LongType misses() const;
+  LongType evictions() const;
+  LongType size();
+
+  /**
+   * This method drops all entries and zeroes stats
+   */
+  void purge();
+};
+}  // namespace ops
+}  // namespace sd
+
+#endif  // LIBND4J_SHAPEFUNCTIONCACHE_H
@@ -55,7 +55,8 @@ DECLARE_TYPES(choose) {
       ->setAllowedInputTypes(0, {ALL_FLOATS})
       ->setAllowedInputTypes(1, {ALL_FLOATS})
       ->setAllowedOutputTypes(0, {ALL_FLOATS})
-      ->setAllowedOutputTypes(1, {ALL_INTS});
+      ->setAllowedOutputTypes(1, {ALL_INTS})
+      ->setDataDependentShape(true);
 }
 
 DECLARE_SHAPE_FN(choose) {
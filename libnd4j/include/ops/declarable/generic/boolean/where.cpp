@@ -136,7 +136,8 @@ DECLARE_TYPES(Where) {
       ->setAllowedInputTypes(0, ANY)  // bool
       ->setAllowedInputTypes(1, ANY)
       ->setAllowedInputTypes(2, ANY)
-      ->setAllowedOutputTypes(0, {ALL_INTS, ALL_FLOATS});
+      ->setAllowedOutputTypes(0, {ALL_INTS, ALL_FLOATS})
+      ->setDataDependentShape(true);
 }
 }  // namespace ops
 }  // namespace sd
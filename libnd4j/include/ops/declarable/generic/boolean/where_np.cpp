@@ -156,7 +156,8 @@ DECLARE_TYPES(where_np) {
       ->setAllowedInputTypes(0, BOOL)
       ->setAllowedInputTypes(1, ANY)
       ->setAllowedInputTypes(2, ANY)
-      ->setAllowedOutputTypes({ALL_FLOATS, ALL_INTS});
+      ->setAllowedOutputTypes({ALL_FLOATS, ALL_INTS})
+      ->setDataDependentShape(true);
 }
 }  // namespace ops
 }  // namespace sd
@@ -68,7 +68,8 @@ DECLARE_TYPES(compat_sparse_to_dense) {
       ->setAllowedInputTypes(1, {ALL_INTS})         // shape
       ->setAllowedInputTypes(2, sd::DataType::ANY)  // sparse values
       ->setAllowedInputTypes(3, sd::DataType::ANY)  // default value
-      ->setAllowedOutputTypes(sd::DataType::ANY);
+      ->setAllowedOutputTypes(sd::DataType::ANY)
+      ->setDataDependentShape(true);
 }
 }  // namespace ops
 }  // namespace sd
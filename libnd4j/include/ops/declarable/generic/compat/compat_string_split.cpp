@@ -138,7 +138,8 @@ DECLARE_TYPES(compat_string_split) {
   getOpDescriptor()
       ->setAllowedInputTypes({ALL_STRINGS})
       ->setAllowedOutputTypes(0, {ALL_INDICES})
-      ->setAllowedOutputTypes(1, {ALL_STRINGS});
+      ->setAllowedOutputTypes(1, {ALL_STRINGS})
+      ->setDataDependentShape(true);
 }
 }  // namespace ops
 }  // namespace sd
@@ -92,6 +92,7 @@ DECLARE_TYPES(crop_and_resize) {
       ->setAllowedInputTypes(3, {ALL_INTS})
       ->setAllowedOutputTypes({ALL_INTS, ALL_FLOATS});  // as TF
   //                    ->setAllowedOutputTypes({ALL_FLOATS});
+  getOpDescriptor()->setDataDependentShape(true);
 }
 }  // namespace ops
 }  // namespace sd
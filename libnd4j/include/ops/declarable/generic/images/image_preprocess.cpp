@@ -0,0 +1,127 @@
+/*
+ *  ******************************************************************************
+ *  *
+ *  *
+ *  * This program and the accompanying materials are made available under the
+ *  * terms of the Apache License, Version 2.0 which is available at
+ *  * https://www.apache.org/licenses/LICENSE-2.0.
+ *  *
+ *  * See the NOTICE file distributed with this work for additional
+ *  * information regarding copyright ownership.
+ *  * Unless required by applicable law or agreed to in writing, software
+ *  * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ *  * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ *  * License for the specific language governing permissions and limitations
+ *  * under the License.
+ *  *
+ *  * SPDX-License-Identifier: Apache-2.0
+ *  *****************************************************************************
+ */
+
+//
+// Fused crop, resize, normalization and layout change of images
+//
+
+#include <system/op_boilerplate.h>
+#if NOT_EXCLUDED(OP_image_preprocess)
+#include <ops/declarable/CustomOperations.h>
+#include <ops/declarable/helpers/imagePreprocess.h>
+
+namespace sd {
+namespace ops {
+CUSTOM_OP_IMPL(image_preprocess, 1, 1, false, -2, 2) {
+  auto image = INPUT_VARIABLE(0);
+  auto mean = block.width() > 1 ? INPUT_VARIABLE(1) : nullptr;
+  auto std = block.width() > 2 ? INPUT_VARIABLE(2) : nullptr;
+  auto output = OUTPUT_VARIABLE(0);
+
+  const int inRank = image->rankOf();
+  REQUIRE_TRUE(inRank == 3 || inRank == 4, 0, "image_preprocess: input rank should be 3 or 4, but %i given.", inRank);
+
+  const LongType height = image->sizeAt(-3);
+  const LongType width = image->sizeAt(-2);
+  const LongType channels = image->sizeAt(-1);
+
+  helpers::ImagePreprocessParams params;
+  params.channelsFirst = block.numI() > 2 && INT_ARG(2) == 1;
+  params.cropHeight = height;
+  params.cropWidth = width;
+  if (block.numI() > 3) {
+    REQUIRE_TRUE(block.numI() >= 7, 0, "image_preprocess: crop window needs 4 values (y, x, height, width), but %i given",
+                 (int)block.numI() - 3);
+    params.cropY = INT_ARG(3);
+    params.cropX = INT_ARG(4);
+    params.cropHeight = INT_ARG(5);
+    params.cropWidth = INT_ARG(6);
+  }
+  REQUIRE_TRUE(params.cropY >= 0 && params.cropX >= 0 && params.cropHeight > 0 && params.cropWidth > 0 &&
+                   params.cropY + params.cropHeight <= height && params.cropX + params.cropWidth <= width,
+               0, "image_preprocess: crop window [%lld, %lld, %lld, %lld] doesn't fit image of size %lld x %lld",
+               params.cropY, params.cropX, params.cropHeight, params.cropWidth, height, width);
+
+  if (block.numT() > 0) params.scale = T_ARG(0);
+  if (block.numB() > 0) params.reverseChannels = B_ARG(0);
+  if (block.numB() > 1) params.halfPixelCenters = B_ARG(1);
+
+  if (mean != nullptr)
+    REQUIRE_TRUE(mean->lengthOf() == channels, 0, "image_preprocess: mean should have %lld values, but %lld given",
+                 channels, mean->lengthOf());
+  if (std != nullptr)
+    REQUIRE_TRUE(std->lengthOf() == channels, 0, "image_preprocess: std should have %lld values, but %lld given",
+                 channels, std->lengthOf());
+
+  // kernel reads and writes plain c-order buffers
+  NDArray source = image->ordering() == 'c' && image->ews() == 1 ? *image : image->dup('c');
+  const bool directOutput = output->ordering() == 'c' && output->ews() == 1;
+  std::vector<LongType> targetShape = output->getShapeAsVector();
+  NDArray target = directOutput ? *output : NDArray('c', targetShape, output->dataType(), block.launchContext());
+
+  std::vector<LongType> sourceShape = {inRank == 4 ? image->sizeAt(0) : 1, height, width, channels};
+  if (inRank == 3) targetShape.insert(targetShape.begin(), 1);
+
+  auto source4d = source.reshape('c', sourceShape);
+  auto target4d = target.reshape('c', targetShape, false);
+
+  helpers::imagePreprocess(block.launchContext(), &source4d, mean, std, params, &target4d);
+
+  if (!directOutput) output->assign(target);
+
+  return Status::OK;
+}
+
+DECLARE_SHAPE_FN(image_preprocess) {
+  auto in = inputShape->at(0);
+  const int rank = shape::rank(in);
+  REQUIRE_TRUE(rank == 3 || rank == 4, 0, "image_preprocess: input rank should be 3 or 4, but %i given.", rank);
+
+  const LongType height = INT_ARG(0);
+  const LongType width = INT_ARG(1);
+  REQUIRE_TRUE(height > 0 && width > 0, 0, "image_preprocess: output size should be positive, but %lld x %lld given",
+               height, width);
+
+  const LongType channels = shape::sizeAt(in, static_cast<LongType>(-1));
+  const bool channelsFirst = block.numI() > 2 && INT_ARG(2) == 1;
+  auto dtype = block.numD() > 0 ? D_ARG(0) : FLOAT32;
+
+  std::vector<LongType> shape;
+  if (rank == 4) shape.push_back(shape::sizeAt(in, static_cast<LongType>(0)));
+  if (channelsFirst)
+    shape.insert(shape.end(), {channels, height, width});
+  else
+    shape.insert(shape.end(), {height, width, channels});
+
+  return SHAPELIST(ConstantShapeHelper::getInstance().createShapeInfo(dtype, 'c', shape));
+}
+
+DECLARE_TYPES(image_preprocess) {
+  getOpDescriptor()
+      ->setAllowedInputTypes(0, {ALL_INTS, ALL_FLOATS})
+      ->setAllowedInputTypes(1, {ALL_FLOATS})
+      ->setAllowedInputTypes(2, {ALL_FLOATS})
+      ->setAllowedOutputTypes({ALL_FLOATS});
+}
+
+}  // namespace ops
+}  // namespace sd
+
+#endif
@@ -147,7 +147,8 @@ DECLARE_TYPES(image_resize) {
   getOpDescriptor()
       ->setAllowedInputTypes(0, {ALL_INTS, ALL_FLOATS})
       ->setAllowedInputTypes(1, {ALL_INTS})
-      ->setAllowedOutputTypes({ALL_FLOATS, ALL_INTS});
+      ->setAllowedOutputTypes({ALL_FLOATS, ALL_INTS})
+      ->setDataDependentShape(true);
 }
 
 }  // namespace ops
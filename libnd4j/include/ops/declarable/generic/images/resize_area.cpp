@@ -131,7 +131,8 @@ DECLARE_TYPES(resize_area) {
   getOpDescriptor()
       ->setAllowedInputTypes(0, {ALL_FLOATS, ALL_INTS})
       ->setAllowedInputTypes(1, INT32)
-      ->setAllowedOutputTypes({FLOAT32});
+      ->setAllowedOutputTypes({FLOAT32})
+      ->setDataDependentShape(true);
 }
 
 }  // namespace ops
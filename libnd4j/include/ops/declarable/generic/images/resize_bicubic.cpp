@@ -138,7 +138,8 @@ DECLARE_TYPES(resize_bicubic) {
   getOpDescriptor()
       ->setAllowedInputTypes(0, {ALL_FLOATS, ALL_INTS})
       ->setAllowedInputTypes(1, INT32)
-      ->setAllowedOutputTypes({FLOAT32, DOUBLE});
+      ->setAllowedOutputTypes({FLOAT32, DOUBLE})
+      ->setDataDependentShape(true);
 }
 
 }  // namespace ops
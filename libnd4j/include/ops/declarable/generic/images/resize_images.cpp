@@ -142,7 +142,8 @@ DECLARE_TYPES(resize_images) {
   getOpDescriptor()
       ->setAllowedInputTypes(0, {ALL_FLOATS, ALL_INTS})
       ->setAllowedInputTypes(1, {ALL_INTS})
-      ->setAllowedOutputTypes({FLOAT32});
+      ->setAllowedOutputTypes({FLOAT32})
+      ->setDataDependentShape(true);
 }
 
 }  // namespace ops
@@ -138,7 +138,10 @@ DECLARE_SHAPE_FN(resize_bilinear) {
   return shapeList;
 }
 DECLARE_TYPES(resize_bilinear) {
-  getOpDescriptor()->setAllowedInputTypes(ANY)->setAllowedOutputTypes({ALL_FLOATS});
+  getOpDescriptor()
+      ->setAllowedInputTypes(ANY)
+      ->setAllowedOutputTypes({ALL_FLOATS})
+      ->setDataDependentShape(true);
 }
 
 }  // namespace ops
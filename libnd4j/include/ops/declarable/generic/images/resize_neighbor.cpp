@@ -141,7 +141,10 @@ DECLARE_SHAPE_FN(resize_nearest_neighbor) {
   return shapeList;
 }
 DECLARE_TYPES(resize_nearest_neighbor) {
-  getOpDescriptor()->setAllowedInputTypes({ALL_INTS, ALL_FLOATS})->setAllowedOutputTypes({ALL_INTS, ALL_FLOATS});
+  getOpDescriptor()
+      ->setAllowedInputTypes({ALL_INTS, ALL_FLOATS})
+      ->setAllowedOutputTypes({ALL_INTS, ALL_FLOATS})
+      ->setDataDependentShape(true);
 }
 
 }  // namespace ops
@@ -37,7 +37,9 @@ CUSTOM_OP_IMPL(eye, -2, 1, false, -2, -2) {
 DECLARE_TYPES(eye) {
   getOpDescriptor()->setAllowedInputTypes(0, {ALL_INTS});
   getOpDescriptor()->setAllowedInputTypes(1, {INT32, INT64});
-  getOpDescriptor()->setAllowedOutputTypes(0, {ALL_FLOATS});
+  getOpDescriptor()
+      ->setAllowedOutputTypes(0, {ALL_FLOATS})
+      ->setDataDependentShape(true);
 }
 
 DECLARE_SHAPE_FN(eye) {
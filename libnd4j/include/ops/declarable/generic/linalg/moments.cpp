@@ -25,6 +25,7 @@
 
 #include <ops/declarable/CustomOperations.h>
 #include <ops/declarable/helpers/axis.h>
+#include <ops/declarable/helpers/summaryStats.h>
 
 namespace sd {
 namespace ops {
@@ -34,25 +35,18 @@ CUSTOM_OP_IMPL(moments, 1, 2, false, 0, -2) {
   auto variances = OUTPUT_VARIABLE(1);
 
   std::vector<LongType> axis = *block.getIArguments();
-  const bool keepDims = block.getBArguments()->size() > 0 ? (bool)B_ARG(0) : false;
-  reduce_variance varianceOp;
 
   // axis might be dynamic (i.e. tf mode)
   if (block.width() > 1) {
     auto axisVector = INPUT_VARIABLE(1);
     helpers::adjustAxis(input->rankOf(), axisVector, axis);
-    varianceOp.execute({input, axisVector}, {variances}, {}, {}, {keepDims}, {}, false);
-  } else {
-    std::vector<LongType>& dims = axis;
-    std::vector<LongType> axes;
-    for (size_t i = 0; i < dims.size(); i++) {
-      axes.push_back(dims[i]);
-    }
-
-    varianceOp.execute({input}, {variances}, {}, axes, {keepDims}, {}, false);
   }
 
-  input->reduceAlongDimension(reduce::Mean, *means, &axis, keepDims);
+  // mean and variance come from the same pass over input, keepDims is reflected by output shapes
+  helpers::SummaryStatsOutputs stats;
+  stats.mean = means;
+  stats.variance = variances;
+  helpers::summaryStats(block.launchContext(), input, axis, stats);
 
   return Status::OK;
 }
@@ -80,7 +74,10 @@ DECLARE_SHAPE_FN(moments) {
 }
 
 DECLARE_TYPES(moments) {
-  getOpDescriptor()->setAllowedInputTypes(ANY)->setAllowedOutputTypes({ALL_FLOATS});
+  getOpDescriptor()
+      ->setAllowedInputTypes(ANY)
+      ->setAllowedOutputTypes({ALL_FLOATS})
+      ->setDataDependentShape(true);
 }
 }  // namespace ops
 
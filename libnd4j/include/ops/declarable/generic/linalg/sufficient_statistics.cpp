@@ -25,6 +25,7 @@
 
 #include <ops/declarable/CustomOperations.h>
 #include <ops/declarable/helpers/axis.h>
+#include <ops/declarable/helpers/summaryStats.h>
 namespace sd {
 namespace ops {
 CUSTOM_OP_IMPL(sufficient_statistics, 2, 3, false, 0, 0) {
@@ -40,10 +41,11 @@ CUSTOM_OP_IMPL(sufficient_statistics, 2, 3, false, 0, 0) {
   // axis might be dynamic (i.e. tf mode)
   helpers::adjustAxis(input->rankOf(), axisVector, axis);
 
-  input->reduceAlongDimension(reduce::SquaredNorm, *squares, &axis);
-  input->reduceAlongDimension(reduce::Sum, *sum, &axis);
-  auto count = NDArrayFactory::create(input->dataType(), input->lengthOf() / sum->lengthOf());
-  dataCount->assign(count);
+  helpers::SummaryStatsOutputs stats;
+  stats.count = dataCount;
+  stats.sum = sum;
+  stats.squaredSum = squares;
+  helpers::summaryStats(block.launchContext(), input, axis, stats);
   if (block.numT() > 0) {
     auto shift = OUTPUT_VARIABLE(3);
     shift->assign(T_ARG(0));
@@ -57,7 +59,9 @@ DECLARE_TYPES(sufficient_statistics) {
   getOpDescriptor()->setAllowedInputTypes(1, {INT32, INT64});
   getOpDescriptor()->setAllowedOutputTypes(0, INHERIT);
   getOpDescriptor()->setAllowedOutputTypes(1, INHERIT);
-  getOpDescriptor()->setAllowedOutputTypes(2, INHERIT);
+  getOpDescriptor()
+      ->setAllowedOutputTypes(2, INHERIT)
+      ->setDataDependentShape(true);
 }
 
 DECLARE_SHAPE_FN(sufficient_statistics) {
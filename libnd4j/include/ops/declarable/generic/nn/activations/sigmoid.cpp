@@ -24,6 +24,7 @@
 #if NOT_EXCLUDED(OP_sigmoid)
 
 #include <ops/declarable/CustomOperations.h>
+#include <ops/declarable/helpers/activations.h>
 #include <ops/declarable/helpers/legacy_helpers.h>
 namespace sd {
 namespace ops {
@@ -31,7 +32,12 @@ CONFIGURABLE_OP_IMPL(sigmoid, 1, 1, true, 0, 0) {
   auto first = INPUT_VARIABLE(0);
   auto z = OUTPUT_VARIABLE(0);
 
-  first->applyTransform(transform::Sigmoid, *z);
+  // optional boolean argument overrides Environment switch of approximate mode
+  const bool approximate = block.numB() > 0 ? B_ARG(0) : Environment::getInstance().isApproximateActivations();
+  if (approximate && helpers::isApproximateActivationSupported(*first, *z))
+    helpers::approximateActivation(block.launchContext(), helpers::ApproximateActivation::SIGMOID, *first, *z);
+  else
+    first->applyTransform(transform::Sigmoid, *z);
 
   STORE_RESULT(*z);
 
@@ -24,6 +24,7 @@
 #if NOT_EXCLUDED(OP_tanh)
 
 #include <ops/declarable/CustomOperations.h>
+#include <ops/declarable/helpers/activations.h>
 #include <ops/declarable/helpers/legacy_helpers.h>
 
 namespace sd {
@@ -32,7 +33,12 @@ CONFIGURABLE_OP_IMPL(tanh, 1, 1, true, 0, 0) {
   auto first = INPUT_VARIABLE(0);
   auto z = OUTPUT_VARIABLE(0);
 
-  first->applyTransform(transform::Tanh, *z);
+  // optional boolean argument overrides Environment switch of approximate mode
+  const bool approximate = block.numB() > 0 ? B_ARG(0) : Environment::getInstance().isApproximateActivations();
+  if (approximate && helpers::isApproximateActivationSupported(*first, *z))
+    helpers::approximateActivation(block.launchContext(), helpers::ApproximateActivation::TANH, *first, *z);
+  else
+    first->applyTransform(transform::Tanh, *z);
 
   STORE_RESULT(*z);
 
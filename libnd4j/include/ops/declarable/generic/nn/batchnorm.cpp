@@ -28,6 +28,7 @@
 
 #include <ops/declarable/CustomOperations.h>
 #include <ops/declarable/helpers/batchnorm.h>
+#include <ops/declarable/helpers/normalization.h>
 
 namespace sd {
 namespace ops {
@@ -197,6 +198,17 @@ CUSTOM_OP_IMPL(batchnorm_bp, 4, 3, false, 1, 2) {
     REQUIRE_TRUE(INPUT_VARIABLE(0)->dataType() == INPUT_VARIABLE(i)->dataType(), 0,
                  "BATCHNORM_BP op: types of arrays (input, mean, variance, gamma, beta) should be the same !");
 
+  // one pass accumulates all per-channel sums, second one writes dLdI
+  if (numOfAxes == 1 &&
+      helpers::fusedNormalizationSupported({input, dLdO, dLdI}, {mean, variance, gamma, dLdM, dLdV, dLdG, dLdB})) {
+    const int channelAxis = axes[0] < 0 ? axes[0] + inRank : axes[0];
+    helpers::batchnormBp(block.launchContext(), input, mean, variance, gamma, dLdO, dLdI, dLdG, dLdB, channelAxis,
+                         epsilon);
+    *dLdM = 0;  // put zeros so far
+    *dLdV = 0;  // put zeros so far
+    return sd::Status::OK;
+  }
+
   // ***** calculations ***** //
 
   // notations:
@@ -86,6 +86,22 @@ CUSTOM_OP_IMPL(biasadd_bp, 3, 2, false, 0, 0) {
 
   gradI->assign(*gradO);
 
+  if (isNCHW && gradO->rankOf() > 2 && !gradO->isEmpty() && gradO->ordering() == 'c' && gradO->ews() == 1) {
+    // channels sit between batch and spatial dimensions: [bS, C, spatial] is reduced along contiguous spatial spans
+    // first, and then [bS, C] along batch, so both reductions read memory row by row
+    const sd::LongType bS = gradO->sizeAt(0);
+    const sd::LongType channels = gradO->sizeAt(1);
+    std::vector<sd::LongType> shape3 = {bS, channels, gradO->lengthOf() / (bS * channels)};
+    auto gradO3 = gradO->reshape('c', shape3, false);
+
+    std::vector<sd::LongType> spatialDim = {2};
+    auto perSample = gradO3.reduceAlongDimension(sd::reduce::Sum, &spatialDim);
+
+    std::vector<sd::LongType> batchDim = {0};
+    perSample.reduceAlongDimension(sd::reduce::Sum, *gradB, &batchDim);
+    return sd::Status::OK;
+  }
+
   std::vector<sd::LongType> channel;
   channel.push_back(channelDim);
   auto dims = ShapeUtils::evalDimsToExclude(gradO->rankOf(), 1,channel.data());
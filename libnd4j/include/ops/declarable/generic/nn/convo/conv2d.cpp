@@ -419,7 +419,10 @@ CUSTOM_OP_IMPL(conv2d_input_bp, 3, 1, false, 0, 9) {
 }
 
 DECLARE_TYPES(conv2d_input_bp) {
-  getOpDescriptor()->setAllowedInputTypes(ANY)->setAllowedOutputTypes({ALL_FLOATS});
+  getOpDescriptor()
+      ->setAllowedInputTypes(ANY)
+      ->setAllowedOutputTypes({ALL_FLOATS})
+      ->setDataDependentShape(true);
 }
 
 DECLARE_SHAPE_FN(conv2d_input_bp) {
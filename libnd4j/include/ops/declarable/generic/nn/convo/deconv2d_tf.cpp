@@ -97,7 +97,10 @@ CUSTOM_OP_IMPL(deconv2d_tf, 3, 1, false, 0, 9) {
 }
 
 DECLARE_TYPES(deconv2d_tf) {
-  getOpDescriptor()->setAllowedInputTypes(sd::DataType::ANY)->setAllowedOutputTypes({ALL_FLOATS});
+  getOpDescriptor()
+      ->setAllowedInputTypes(sd::DataType::ANY)
+      ->setAllowedOutputTypes({ALL_FLOATS})
+      ->setDataDependentShape(true);
 }
 
 DECLARE_SHAPE_FN(deconv2d_tf) {
@@ -82,7 +82,10 @@ CUSTOM_OP_IMPL(dilation2d, 2, 1, false, 0, 1) {
 }
 
 DECLARE_TYPES(dilation2d) {
-  getOpDescriptor()->setAllowedInputTypes(sd::DataType::ANY)->setAllowedOutputTypes({ALL_FLOATS});
+  getOpDescriptor()
+      ->setAllowedInputTypes(sd::DataType::ANY)
+      ->setAllowedOutputTypes({ALL_FLOATS})
+      ->setDataDependentShape(true);
 }
 
 DECLARE_SHAPE_FN(dilation2d) {
@@ -24,6 +24,7 @@
 #if NOT_EXCLUDED(OP_fused_batch_norm)
 
 #include <ops/declarable/CustomOperations.h>
+#include <ops/declarable/helpers/normalization.h>
 
 namespace sd {
 namespace ops {
@@ -56,11 +57,6 @@ CUSTOM_OP_IMPL(fused_batch_norm, 3, 3, false, 0, 2) {
     iD = x->sizeAt(3);
   }
 
-  auto xCast = x->cast(sd::DataType::FLOAT32);
-  if (dataFormat) {
-    std::vector<LongType> permute = {0,2,3,1};
-    xCast = xCast.permute(permute, false, false);
-  }
   REQUIRE_TRUE(scale->rankOf() == 1 && scale->sizeAt(0) == iD, 0,
                "CUSTOM_OP fused_batch_norm: wrong shape of input scale array, expected is [%i], but got %s instead", iD,
                ShapeUtils::shapeAsString(scale).c_str());
@@ -68,6 +64,31 @@ CUSTOM_OP_IMPL(fused_batch_norm, 3, 3, false, 0, 2) {
                "CUSTOM_OP fused_batch_norm: wrong shape of input offset array, expected is [%i], but got %s instead",
                iD, ShapeUtils::shapeAsString(offset).c_str());
 
+  float epsilon;
+  if (block.getTArguments()->size() > 0) {
+    epsilon = (float)(T_ARG(0) > 1.001e-5 ? T_ARG(0) : 1.001e-5);
+  } else {
+    epsilon = 0.001f;
+  }
+
+  const int restSize = x->lengthOf() / iD;
+  const int restSizeMinusOne = (restSize > 1) ? (restSize - 1) : 1;
+  const float restSizeAdjust = (float)restSize / restSizeMinusOne;
+
+  // statistics and normalization in two passes over x, without casting and permuting it
+  if (isTraining && helpers::fusedNormalizationSupported({x, y}, {scale, offset, batchMean, batchVar})) {
+    helpers::batchnormTraining(block.launchContext(), x, scale, offset, y, batchMean, batchVar, dataFormat ? 1 : 3,
+                               epsilon);
+    *batchVar *= restSizeAdjust;
+    return sd::Status::OK;
+  }
+
+  auto xCast = x->cast(sd::DataType::FLOAT32);
+  if (dataFormat) {
+    std::vector<LongType> permute = {0,2,3,1};
+    xCast = xCast.permute(permute, false, false);
+  }
+
   NDArray *mean(nullptr), *variance(nullptr);
   if (!isTraining) {
     mean = INPUT_VARIABLE(3);
@@ -87,21 +108,10 @@ CUSTOM_OP_IMPL(fused_batch_norm, 3, 3, false, 0, 2) {
     variance = NDArrayFactory::create_(scale->ordering(), shape, scale->dataType(), block.launchContext());
   }
 
-  float epsilon;
-  if (block.getTArguments()->size() > 0) {
-    epsilon = (float)(T_ARG(0) > 1.001e-5 ? T_ARG(0) : 1.001e-5);
-  } else {
-    epsilon = 0.001f;
-  }
-
-  const int restSize = x->lengthOf() / iD;
-
   auto xAffected = NDArrayFactory::create(x->ordering(), {restSize, iD}, mean->dataType(), block.launchContext());
   xAffected.assign(xCast);
 
-  const int restSizeMinusOne = (restSize > 1) ? (restSize - 1) : 1;
   const float restSizeInv = 1.0f / restSize;
-  const float restSizeAdjust = (float)restSize / restSizeMinusOne;
 
   if (isTraining) {
     std::vector<sd::LongType > dim = {0};
@@ -27,11 +27,26 @@
 
 #include <ops/declarable/CustomOperations.h>
 #include <ops/declarable/helpers/addBias.h>
+#include <ops/declarable/helpers/normalization.h>
 #include <ops/declarable/helpers/reverse.h>
 
 namespace sd {
 namespace ops {
 
+// fused kernels normalize contiguous rows, so axes have to cover trailing dimensions. Returns first axis or -1
+static int trailingAxesStart(const std::vector<sd::LongType> &axis, int rank) {
+  if (axis.empty()) return -1;
+
+  std::vector<sd::LongType> sorted(axis);
+  for (auto &a : sorted) a = a < 0 ? a + rank : a;
+  std::sort(sorted.begin(), sorted.end());
+
+  for (size_t e = 0; e < sorted.size(); e++)
+    if (sorted[e] != rank - static_cast<sd::LongType>(sorted.size() - e)) return -1;
+
+  return static_cast<int>(sorted[0]);
+}
+
 CONFIGURABLE_OP_IMPL(layer_norm, 2, 1, false, 0, -1) {
   auto input = INPUT_VARIABLE(0);
   auto gain = INPUT_VARIABLE(1);
@@ -54,6 +69,13 @@ CONFIGURABLE_OP_IMPL(layer_norm, 2, 1, false, 0, -1) {
                  input->sizeAt(dimC), ShapeUtils::shapeAsString(bias).c_str());
   }
 
+  // statistics, normalization, gain and bias in two passes over cache-resident rows
+  const int firstAxis = trailingAxesStart(axis, input->rankOf());
+  if (firstAxis >= 0 && helpers::fusedNormalizationSupported({input, output}, {gain, bias})) {
+    helpers::layerNorm(block.launchContext(), input, gain, bias, output, firstAxis, dimC);
+    return sd::Status::OK;
+  }
+
   std::vector<sd::LongType> longAxis = ArrayUtils::toLongVector(axis);
 
   sd::ops::standardize standardizeOp;
@@ -98,10 +120,18 @@ CUSTOM_OP_IMPL(layer_norm_bp, 3, -1, false, 0, -1) {
 
   std::vector<sd::LongType> longAxis = ArrayUtils::toLongVector(axis);
 
-  if (bias != nullptr) {
+  if (bias != nullptr)
     REQUIRE_TRUE(bias->rankOf() == 1 && bias->sizeAt(0) == input->sizeAt(dimC), 0,
                  "LAYER_NORM_BP OP: wrong shape of bias array, expected is {%i}, but got %s instead !",
                  input->sizeAt(dimC), ShapeUtils::shapeAsString(bias).c_str());
+
+  const int firstAxis = trailingAxesStart(axis, input->rankOf());
+  if (firstAxis >= 0 && helpers::fusedNormalizationSupported({input, eps, dLdx}, {gain, dLdg, dLdb})) {
+    helpers::layerNormBp(block.launchContext(), input, gain, eps, dLdx, dLdg, dLdb, firstAxis, dimC);
+    return sd::Status::OK;
+  }
+
+  if (bias != nullptr) {
     std::vector<sd::LongType> dimCVector = {dimC};
     auto vec = ShapeUtils::evalDimsToExclude(input->rankOf(),1,dimCVector.data());
     eps->reduceAlongDimension(sd::reduce::Sum, *dLdb, vec);
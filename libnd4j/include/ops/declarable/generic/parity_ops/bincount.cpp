@@ -32,7 +32,8 @@ DECLARE_TYPES(bincount) {
   getOpDescriptor()
       ->setAllowedInputTypes({ALL_INTS})
       ->setAllowedInputTypes(1, ANY)
-      ->setAllowedOutputTypes({ALL_INTS, ALL_FLOATS});
+      ->setAllowedOutputTypes({ALL_INTS, ALL_FLOATS})
+      ->setDataDependentShape(true);
 }
 
 CUSTOM_OP_IMPL(bincount, 1, 1, false, 0, 0) {
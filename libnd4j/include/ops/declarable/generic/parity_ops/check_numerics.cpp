@@ -24,6 +24,7 @@
 #if NOT_EXCLUDED(OP_check_numerics)
 
 #include <ops/declarable/CustomOperations.h>
+#include <ops/declarable/helpers/summaryStats.h>
 
 namespace sd {
 namespace ops {
@@ -33,8 +34,17 @@ CUSTOM_OP_IMPL(check_numerics, 2, 1, true, 0, 0) {
   auto message = INPUT_VARIABLE(1);
   auto output = OUTPUT_VARIABLE(0);
 
-  auto allFinite = input->reduceNumber(reduce::BoolOps::IsFinite);
-  REQUIRE_TRUE(allFinite.e<bool>(0), 0, "CheckNumerics: %s", message->e<std::string>(0).c_str());
+  auto nans = NDArrayFactory::create<sd::LongType>(0, block.launchContext());
+  auto infs = NDArrayFactory::create<sd::LongType>(0, block.launchContext());
+
+  helpers::SummaryStatsOutputs stats;
+  stats.nanCount = &nans;
+  stats.infCount = &infs;
+  helpers::summaryStats(block.launchContext(), input, {}, stats);
+
+  REQUIRE_TRUE(nans.e<sd::LongType>(0) == 0 && infs.e<sd::LongType>(0) == 0, 0,
+               "CheckNumerics: %s (%lld NaN and %lld Inf values found)", message->e<std::string>(0).c_str(),
+               nans.e<sd::LongType>(0), infs.e<sd::LongType>(0));
 
   if (!block.isInplace()) output->assign(*input);
 
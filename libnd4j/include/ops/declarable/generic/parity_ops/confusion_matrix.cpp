@@ -83,7 +83,8 @@ DECLARE_SHAPE_FN(confusion_matrix) {
 DECLARE_TYPES(confusion_matrix) {
   getOpDescriptor()
       ->setAllowedInputTypes({ALL_INDICES})
-      ->setAllowedOutputTypes({ALL_INDICES});
+      ->setAllowedOutputTypes({ALL_INDICES})
+      ->setDataDependentShape(true);
 }
 
 }  // namespace ops
@@ -67,7 +67,8 @@ DECLARE_TYPES(listdiff) {
   getOpDescriptor()
       ->setAllowedInputTypes({ALL_INTS, ALL_FLOATS})
       ->setAllowedOutputTypes(0, DataType::INHERIT)
-      ->setAllowedOutputTypes(1, {ALL_INTS});
+      ->setAllowedOutputTypes(1, {ALL_INTS})
+      ->setDataDependentShape(true);
 }
 }  // namespace ops
 }  // namespace sd
@@ -117,12 +117,18 @@ DECLARE_SHAPE_FN(non_max_suppression) {
   return SHAPELIST(outputShape);
 }
 DECLARE_TYPES(non_max_suppression) {
-  getOpDescriptor()->setAllowedInputTypes(ANY)->setAllowedOutputTypes({ALL_INDICES});
+  getOpDescriptor()
+      ->setAllowedInputTypes(ANY)
+      ->setAllowedOutputTypes({ALL_INDICES})
+      ->setDataDependentShape(true);
 }
 #endif
 #if NOT_EXCLUDED(OP_non_max_suppression_v3)
 DECLARE_TYPES(non_max_suppression_v3) {
-  getOpDescriptor()->setAllowedInputTypes(ANY)->setAllowedOutputTypes({ALL_INDICES});
+  getOpDescriptor()
+      ->setAllowedInputTypes(ANY)
+      ->setAllowedOutputTypes({ALL_INDICES})
+      ->setDataDependentShape(true);
 }
 
 CUSTOM_OP_IMPL(non_max_suppression_v3, 2, 1, false, 0, 0) {
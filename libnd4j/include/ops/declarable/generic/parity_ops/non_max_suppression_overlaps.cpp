@@ -95,7 +95,8 @@ DECLARE_TYPES(non_max_suppression_overlaps) {
       ->setAllowedInputTypes(0, {ALL_FLOATS})
       ->setAllowedInputTypes(1, {ALL_FLOATS})
       ->setAllowedInputTypes(2, {ALL_INTS})
-      ->setAllowedOutputTypes({ALL_INDICES});
+      ->setAllowedOutputTypes({ALL_INDICES})
+      ->setDataDependentShape(true);
 }
 
 }  // namespace ops
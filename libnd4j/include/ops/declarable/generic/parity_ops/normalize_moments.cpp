@@ -24,6 +24,7 @@
 #if NOT_EXCLUDED(OP_normalize_moments)
 
 #include <ops/declarable/CustomOperations.h>
+#include <ops/declarable/helpers/summaryStats.h>
 
 namespace sd {
 namespace ops {
@@ -35,25 +36,9 @@ CUSTOM_OP_IMPL(normalize_moments, 3, 2, false, 1, 0) {
   auto resMeans = OUTPUT_VARIABLE(0);
   auto resVariances = OUTPUT_VARIABLE(1);
 
-  // FIXME: double?
-  NDArray shift = NDArrayFactory::create<double>(0., block.launchContext());
+  const double shift = block.getTArguments()->size() > 0 ? T_ARG(0) : 0.;
 
-  if (block.getTArguments()->size() > 0) {
-    shift.assign(T_ARG(0));
-  }
-
-  means->applyScalarArr(scalar::Divide, *counts, *resMeans);
-
-  NDArray squareMeans = resMeans->dup('c', false);
-  NDArray tempVariances = resVariances->dup('c', false);
-
-  squareMeans.applyTransform(transform::Square, squareMeans, nullptr);
-  variances->applyScalarArr(scalar::Divide, *counts, tempVariances);
-  tempVariances.applyPairwiseTransform(pairwise::Subtract, squareMeans, *resVariances);
-
-  if (shift.e<double>(0) != 0) {
-    resMeans->applyScalarArr(scalar::Add, shift, *resMeans);
-  }
+  helpers::normalizeMoments(block.launchContext(), counts, means, variances, shift, resMeans, resVariances);
 
   return Status::OK;
 }
@@ -100,7 +100,10 @@ DECLARE_SHAPE_FN(onehot) {
 }
 
 DECLARE_TYPES(onehot) {
-  getOpDescriptor()->setAllowedInputTypes(ANY)->setAllowedOutputTypes({ALL_FLOATS, ALL_INTS});
+  getOpDescriptor()
+      ->setAllowedInputTypes(ANY)
+      ->setAllowedOutputTypes({ALL_FLOATS, ALL_INTS})
+      ->setDataDependentShape(true);
 }
 }  // namespace ops
 }  // namespace sd
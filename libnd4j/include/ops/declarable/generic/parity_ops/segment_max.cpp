@@ -75,7 +75,8 @@ DECLARE_TYPES(segment_max) {
       ->setAllowedInputTypes(0, {ALL_INTS, ALL_FLOATS})
       ->setAllowedInputTypes(1, {ALL_INTS})
       ->setAllowedOutputTypes({ALL_FLOATS, ALL_INTS})
-      ->setSameMode(false);
+      ->setSameMode(false)
+      ->setDataDependentShape(true);
 }
 CUSTOM_OP_IMPL(segment_max_bp, 3, 2, false, 0, 0) {
   auto input = INPUT_VARIABLE(0);
@@ -74,7 +74,8 @@ DECLARE_TYPES(segment_mean) {
       ->setAllowedInputTypes({ALL_INTS, ALL_FLOATS})
       ->setAllowedInputTypes(1, {ALL_INTS})
       ->setAllowedOutputTypes({ALL_FLOATS})
-      ->setSameMode(false);
+      ->setSameMode(false)
+      ->setDataDependentShape(true);
 }
 
 CUSTOM_OP_IMPL(segment_mean_bp, 3, 2, false, 0, 0) {
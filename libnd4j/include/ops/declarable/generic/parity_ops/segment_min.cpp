@@ -94,7 +94,8 @@ DECLARE_TYPES(segment_min) {
       ->setAllowedInputTypes(0, {ALL_FLOATS, ALL_INTS})
       ->setAllowedInputTypes(1, {ALL_INTS})
       ->setAllowedOutputTypes({ALL_FLOATS, ALL_INTS})
-      ->setSameMode(false);
+      ->setSameMode(false)
+      ->setDataDependentShape(true);
 }
 DECLARE_TYPES(segment_min_bp) {
   getOpDescriptor()
@@ -86,7 +86,8 @@ DECLARE_TYPES(segment_prod) {
       ->setAllowedInputTypes(0, {ALL_FLOATS, ALL_INTS})
       ->setAllowedInputTypes(1, {ALL_INTS})
       ->setAllowedOutputTypes({ALL_FLOATS, ALL_INTS})
-      ->setSameMode(false);
+      ->setSameMode(false)
+      ->setDataDependentShape(true);
 }
 
 DECLARE_SHAPE_FN(segment_prod_bp) {
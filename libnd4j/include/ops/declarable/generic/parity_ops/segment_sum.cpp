@@ -85,7 +85,12 @@ DECLARE_SHAPE_FN(segment_sum_bp) {
   //             return SHAPELIST(in, inIdx);
 }
 
-DECLARE_TYPES(segment_sum) { getOpDescriptor()->setAllowedInputTypes(ANY)->setSameMode(true); }
+DECLARE_TYPES(segment_sum) {
+  getOpDescriptor()
+      ->setAllowedInputTypes(ANY)
+      ->setSameMode(true)
+      ->setDataDependentShape(true);
+}
 DECLARE_TYPES(segment_sum_bp) {
   getOpDescriptor()
       ->setAllowedInputTypes(ANY)
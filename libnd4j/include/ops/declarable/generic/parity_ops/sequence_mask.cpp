@@ -88,7 +88,10 @@ DECLARE_SHAPE_FN(sequence_mask) {
 }
 
 DECLARE_TYPES(sequence_mask) {
-  getOpDescriptor()->setAllowedInputTypes({ALL_INTS})->setAllowedOutputTypes(ANY);
+  getOpDescriptor()
+      ->setAllowedInputTypes({ALL_INTS})
+      ->setAllowedOutputTypes(ANY)
+      ->setDataDependentShape(true);
 }
 }  // namespace ops
 }  // namespace sd
@@ -90,7 +90,8 @@ DECLARE_TYPES(top_k) {
   getOpDescriptor()
       ->setAllowedInputTypes(ANY)
       ->setAllowedOutputTypes(0, ANY)
-      ->setAllowedOutputTypes(1, {ALL_INDICES});
+      ->setAllowedOutputTypes(1, {ALL_INDICES})
+      ->setDataDependentShape(true);
 }
 }  // namespace ops
 }  // namespace sd
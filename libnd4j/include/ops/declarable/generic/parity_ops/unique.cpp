@@ -90,7 +90,8 @@ DECLARE_TYPES(unique) {
   getOpDescriptor()
       ->setAllowedInputTypes(ANY)
       ->setAllowedOutputTypes(0, {ALL_INTS, ALL_FLOATS})
-      ->setAllowedOutputTypes(1, {ALL_INTS});
+      ->setAllowedOutputTypes(1, {ALL_INTS})
+      ->setDataDependentShape(true);
 }
 
 DECLARE_TYPES(unique_with_counts) {
@@ -98,7 +99,8 @@ DECLARE_TYPES(unique_with_counts) {
       ->setAllowedInputTypes({ALL_INTS, ALL_FLOATS})
       ->setAllowedOutputTypes(0, {ALL_INTS, ALL_FLOATS})
       ->setAllowedOutputTypes(1, {ALL_INTS})
-      ->setAllowedOutputTypes(2, {ALL_INTS});
+      ->setAllowedOutputTypes(2, {ALL_INTS})
+      ->setDataDependentShape(true);
 }
 
 }  // namespace ops
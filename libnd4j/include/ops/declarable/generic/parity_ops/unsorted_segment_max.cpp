@@ -58,7 +58,8 @@ DECLARE_TYPES(unsorted_segment_max) {
       ->setAllowedOutputTypes({ALL_FLOATS, ALL_INTS})
       ->setAllowedInputTypes(0, {ALL_FLOATS, ALL_INTS})
       ->setAllowedInputTypes(1, {ALL_INTS})
-      ->setSameMode(true);
+      ->setSameMode(true)
+      ->setDataDependentShape(true);
 }
 DECLARE_SHAPE_FN(unsorted_segment_max) {
   auto in = inputShape->at(0);
@@ -64,7 +64,8 @@ DECLARE_TYPES(unsorted_segment_mean) {
       ->setAllowedOutputTypes({ALL_FLOATS})
       ->setAllowedInputTypes(0, {ALL_FLOATS, ALL_INTS})
       ->setAllowedInputTypes(1, {ALL_INTS})
-      ->setSameMode(false);
+      ->setSameMode(false)
+      ->setDataDependentShape(true);
 }
 
 DECLARE_SHAPE_FN(unsorted_segment_mean) {
@@ -85,7 +85,8 @@ DECLARE_TYPES(unsorted_segment_min) {
       ->setAllowedOutputTypes({ALL_FLOATS, ALL_INTS})
       ->setAllowedInputTypes(0, {ALL_FLOATS, ALL_INTS})
       ->setAllowedInputTypes(1, {ALL_INTS})
-      ->setSameMode(true);
+      ->setSameMode(true)
+      ->setDataDependentShape(true);
 }
 
 CUSTOM_OP_IMPL(unsorted_segment_min_bp, 3, 2, false, 0, 1) {
@@ -88,7 +88,8 @@ DECLARE_TYPES(unsorted_segment_prod) {
       ->setAllowedOutputTypes({ALL_FLOATS, ALL_INTS})
       ->setAllowedInputTypes(0, {ALL_FLOATS, ALL_INTS})
       ->setAllowedInputTypes(1, {ALL_INDICES})
-      ->setSameMode(false);
+      ->setSameMode(false)
+      ->setDataDependentShape(true);
 }
 
 CUSTOM_OP_IMPL(unsorted_segment_prod_bp, 3, 2, false, 0, 1) {
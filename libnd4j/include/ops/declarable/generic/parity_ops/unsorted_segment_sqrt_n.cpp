@@ -85,7 +85,8 @@ DECLARE_TYPES(unsorted_segment_sqrt_n) {
       ->setAllowedOutputTypes({ALL_FLOATS})
       ->setAllowedInputTypes(0, {ALL_FLOATS})
       ->setAllowedInputTypes(1, {ALL_INTS})
-      ->setSameMode(false);
+      ->setSameMode(false)
+      ->setDataDependentShape(true);
 }
 
 CUSTOM_OP_IMPL(unsorted_segment_sqrt_n_bp, 3, 2, false, 0, 1) {
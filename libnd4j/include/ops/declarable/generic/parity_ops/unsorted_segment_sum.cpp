@@ -62,7 +62,8 @@ DECLARE_TYPES(unsorted_segment_sum) {
       ->setAllowedOutputTypes({ALL_FLOATS, ALL_INTS})
       ->setAllowedInputTypes(0, {ALL_FLOATS, ALL_INTS})
       ->setAllowedInputTypes(1, {ALL_INTS})
-      ->setSameMode(false);
+      ->setSameMode(false)
+      ->setDataDependentShape(true);
 }
 
 DECLARE_SHAPE_FN(unsorted_segment_sum) {
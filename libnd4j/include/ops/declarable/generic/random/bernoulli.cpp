@@ -47,7 +47,10 @@ DECLARE_SHAPE_FN(random_bernoulli) {
 }
 
 DECLARE_TYPES(random_bernoulli) {
-  getOpDescriptor()->setAllowedInputTypes(ANY)->setAllowedOutputTypes({ALL_FLOATS});
+  getOpDescriptor()
+      ->setAllowedInputTypes(ANY)
+      ->setAllowedOutputTypes({ALL_FLOATS})
+      ->setDataDependentShape(true);
 }
 }  // namespace ops
 }  // namespace sd
@@ -48,7 +48,10 @@ DECLARE_SHAPE_FN(random_exponential) {
 }
 
 DECLARE_TYPES(random_exponential) {
-  getOpDescriptor()->setAllowedInputTypes(ANY)->setAllowedOutputTypes({ALL_FLOATS});
+  getOpDescriptor()
+      ->setAllowedInputTypes(ANY)
+      ->setAllowedOutputTypes({ALL_FLOATS})
+      ->setDataDependentShape(true);
 }
 }  // namespace ops
 }  // namespace sd
@@ -111,7 +111,8 @@ DECLARE_TYPES(random_multinomial) {
   getOpDescriptor()
       ->setAllowedInputTypes(0, {ALL_FLOATS, ALL_INTS})
       ->setAllowedInputTypes(1, {INT32})
-      ->setAllowedOutputTypes(0, {ALL_INDICES});
+      ->setAllowedOutputTypes(0, {ALL_INDICES})
+      ->setDataDependentShape(true);
 }
 }  // namespace ops
 }  // namespace sd
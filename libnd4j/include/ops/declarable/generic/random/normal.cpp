@@ -53,7 +53,10 @@ DECLARE_SHAPE_FN(random_normal) {
 DECLARE_SYN(randomnormal, random_normal);
 
 DECLARE_TYPES(random_normal) {
-  getOpDescriptor()->setAllowedInputTypes(ANY)->setAllowedOutputTypes({ALL_FLOATS});
+  getOpDescriptor()
+      ->setAllowedInputTypes(ANY)
+      ->setAllowedOutputTypes({ALL_FLOATS})
+      ->setDataDependentShape(true);
 }
 }  // namespace ops
 }  // namespace sd
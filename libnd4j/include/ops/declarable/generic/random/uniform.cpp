@@ -88,7 +88,8 @@ DECLARE_TYPES(randomuniform) {
       ->setAllowedInputTypes(0, {ALL_INTS})
       ->setAllowedInputTypes(1, {ALL_INTS, ALL_FLOATS})
       ->setAllowedInputTypes(2, {ALL_INTS, ALL_FLOATS})
-      ->setAllowedOutputTypes({ALL_FLOATS, ALL_INTS});
+      ->setAllowedOutputTypes({ALL_FLOATS, ALL_INTS})
+      ->setDataDependentShape(true);
 }
 }  // namespace ops
 }  // namespace sd
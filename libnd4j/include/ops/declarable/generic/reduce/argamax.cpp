@@ -31,7 +31,10 @@
 namespace sd {
 namespace ops {
 DECLARE_TYPES(argamax) {
-  getOpDescriptor()->setAllowedInputTypes({ALL_FLOATS, ALL_INTS})->setAllowedOutputTypes({ALL_INTS});
+  getOpDescriptor()
+      ->setAllowedInputTypes({ALL_FLOATS, ALL_INTS})
+      ->setAllowedOutputTypes({ALL_INTS})
+      ->setDataDependentShape(true);
 }
 
 CUSTOM_OP_IMPL(argamax, 1, 1, false, 0, -2) {
@@ -33,7 +33,10 @@
 namespace sd {
 namespace ops {
 DECLARE_TYPES(argmax) {
-  getOpDescriptor()->setAllowedInputTypes({ALL_FLOATS, ALL_INTS})->setAllowedOutputTypes({ALL_INTS});
+  getOpDescriptor()
+      ->setAllowedInputTypes({ALL_FLOATS, ALL_INTS})
+      ->setAllowedOutputTypes({ALL_INTS})
+      ->setDataDependentShape(true);
 }
 
 CUSTOM_OP_IMPL(argmax, 1, 1, false, 0, -2) {
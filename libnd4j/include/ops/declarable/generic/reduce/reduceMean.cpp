@@ -89,7 +89,10 @@ DECLARE_SHAPE_FN(reduce_mean) {
 }
 
 DECLARE_TYPES(reduce_mean) {
-  getOpDescriptor()->setAllowedInputTypes(sd::DataType::ANY)->setAllowedOutputTypes({ALL_FLOATS});
+  getOpDescriptor()
+      ->setAllowedInputTypes(sd::DataType::ANY)
+      ->setAllowedOutputTypes({ALL_FLOATS})
+      ->setDataDependentShape(true);
 }
 
 //////////////////////////////////////////////////////////////////////////
@@ -178,7 +181,10 @@ DECLARE_SHAPE_FN(reduce_mean_bp) {
 }
 
 DECLARE_TYPES(reduce_mean_bp) {
-  getOpDescriptor()->setAllowedInputTypes(sd::DataType::ANY)->setAllowedOutputTypes({ALL_FLOATS});
+  getOpDescriptor()
+      ->setAllowedInputTypes(sd::DataType::ANY)
+      ->setAllowedOutputTypes({ALL_FLOATS})
+      ->setDataDependentShape(true);
 }
 
 }  // namespace ops
@@ -102,7 +102,10 @@ DECLARE_SHAPE_FN(reduce_stdev) {
 }
 
 DECLARE_TYPES(reduce_stdev) {
-  getOpDescriptor()->setAllowedInputTypes(sd::DataType::ANY)->setAllowedOutputTypes({ALL_FLOATS});
+  getOpDescriptor()
+      ->setAllowedInputTypes(sd::DataType::ANY)
+      ->setAllowedOutputTypes({ALL_FLOATS})
+      ->setDataDependentShape(true);
 }
 
 //////////////////////////////////////////////////////////////////////////
@@ -200,7 +203,10 @@ DECLARE_SHAPE_FN(reduce_stdev_bp) {
 }
 
 DECLARE_TYPES(reduce_stdev_bp) {
-  getOpDescriptor()->setAllowedInputTypes(sd::DataType::ANY)->setAllowedOutputTypes({ALL_FLOATS});
+  getOpDescriptor()
+      ->setAllowedInputTypes(sd::DataType::ANY)
+      ->setAllowedOutputTypes({ALL_FLOATS})
+      ->setDataDependentShape(true);
 }
 
 }  // namespace ops
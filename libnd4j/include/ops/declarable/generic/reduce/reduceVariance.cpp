@@ -94,7 +94,10 @@ DECLARE_SHAPE_FN(reduce_variance) {
 }
 
 DECLARE_TYPES(reduce_variance) {
-  getOpDescriptor()->setAllowedInputTypes(sd::DataType::ANY)->setAllowedOutputTypes({ALL_FLOATS});
+  getOpDescriptor()
+      ->setAllowedInputTypes(sd::DataType::ANY)
+      ->setAllowedOutputTypes({ALL_FLOATS})
+      ->setDataDependentShape(true);
 }
 
 //////////////////////////////////////////////////////////////////////////
@@ -183,7 +186,10 @@ DECLARE_SHAPE_FN(reduce_variance_bp) {
 }
 
 DECLARE_TYPES(reduce_variance_bp) {
-  getOpDescriptor()->setAllowedInputTypes(sd::DataType::ANY)->setAllowedOutputTypes({ALL_FLOATS});
+  getOpDescriptor()
+      ->setAllowedInputTypes(sd::DataType::ANY)
+      ->setAllowedOutputTypes({ALL_FLOATS})
+      ->setDataDependentShape(true);
 }
 
 }  // namespace ops
@@ -121,7 +121,10 @@ DECLARE_SHAPE_FN(reduce_dot_bp) {
 }
 
 DECLARE_TYPES(reduce_dot_bp) {
-  getOpDescriptor()->setAllowedInputTypes(sd::DataType::ANY)->setAllowedOutputTypes({ALL_FLOATS});
+  getOpDescriptor()
+      ->setAllowedInputTypes(sd::DataType::ANY)
+      ->setAllowedOutputTypes({ALL_FLOATS})
+      ->setDataDependentShape(true);
 }
 
 }  // namespace ops
@@ -99,7 +99,12 @@ DECLARE_SHAPE_FN(reduce_max) {
   return SHAPELIST(outShapeInfo);
 }
 
-DECLARE_TYPES(reduce_max) { getOpDescriptor()->setAllowedInputTypes(sd::DataType::ANY)->setSameMode(true); }
+DECLARE_TYPES(reduce_max) {
+  getOpDescriptor()
+      ->setAllowedInputTypes(sd::DataType::ANY)
+      ->setSameMode(true)
+      ->setDataDependentShape(true);
+}
 
 
 //////////////////////////////////////////////////////////////////////////
@@ -172,7 +177,10 @@ DECLARE_SHAPE_FN(reduce_max_bp) {
 }
 
 DECLARE_TYPES(reduce_max_bp) {
-  getOpDescriptor()->setAllowedInputTypes(sd::DataType::ANY)->setAllowedOutputTypes({ALL_FLOATS});
+  getOpDescriptor()
+      ->setAllowedInputTypes(sd::DataType::ANY)
+      ->setAllowedOutputTypes({ALL_FLOATS})
+      ->setDataDependentShape(true);
 }
 
 
@@ -92,7 +92,12 @@ DECLARE_SHAPE_FN(reduce_min) {
   return SHAPELIST(outShapeInfo);
 }
 
-DECLARE_TYPES(reduce_min) { getOpDescriptor()->setAllowedInputTypes(sd::DataType::ANY)->setSameMode(true); }
+DECLARE_TYPES(reduce_min) {
+  getOpDescriptor()
+      ->setAllowedInputTypes(sd::DataType::ANY)
+      ->setSameMode(true)
+      ->setDataDependentShape(true);
+}
 
 //////////////////////////////////////////////////////////////////////////
 CUSTOM_OP_IMPL(reduce_min_bp, -1, 1, false, 0, 0) {
@@ -164,7 +169,10 @@ DECLARE_SHAPE_FN(reduce_min_bp) {
 }
 
 DECLARE_TYPES(reduce_min_bp) {
-  getOpDescriptor()->setAllowedInputTypes(sd::DataType::ANY)->setAllowedOutputTypes({ALL_FLOATS});
+  getOpDescriptor()
+      ->setAllowedInputTypes(sd::DataType::ANY)
+      ->setAllowedOutputTypes({ALL_FLOATS})
+      ->setDataDependentShape(true);
 }
 
 
@@ -92,7 +92,10 @@ DECLARE_SHAPE_FN(reduce_norm1) {
 }
 
 DECLARE_TYPES(reduce_norm1) {
-  getOpDescriptor()->setAllowedInputTypes(sd::DataType::ANY)->setAllowedOutputTypes({ALL_FLOATS});
+  getOpDescriptor()
+      ->setAllowedInputTypes(sd::DataType::ANY)
+      ->setAllowedOutputTypes({ALL_FLOATS})
+      ->setDataDependentShape(true);
 }
 #endif
 #if NOT_EXCLUDED(OP_reduce_norm1_bp)
@@ -175,7 +178,10 @@ DECLARE_SHAPE_FN(reduce_norm1_bp) {
 }
 
 DECLARE_TYPES(reduce_norm1_bp) {
-  getOpDescriptor()->setAllowedInputTypes(sd::DataType::ANY)->setAllowedOutputTypes({ALL_FLOATS});
+  getOpDescriptor()
+      ->setAllowedInputTypes(sd::DataType::ANY)
+      ->setAllowedOutputTypes({ALL_FLOATS})
+      ->setDataDependentShape(true);
 }
 
 #endif
@@ -92,7 +92,10 @@ DECLARE_SHAPE_FN(reduce_norm2) {
 }
 
 DECLARE_TYPES(reduce_norm2) {
-  getOpDescriptor()->setAllowedInputTypes(sd::DataType::ANY)->setAllowedOutputTypes({ALL_FLOATS});
+  getOpDescriptor()
+      ->setAllowedInputTypes(sd::DataType::ANY)
+      ->setAllowedOutputTypes({ALL_FLOATS})
+      ->setDataDependentShape(true);
 }
 #endif
 
@@ -172,7 +175,10 @@ DECLARE_SHAPE_FN(reduce_norm2_bp) {
 }
 
 DECLARE_TYPES(reduce_norm2_bp) {
-  getOpDescriptor()->setAllowedInputTypes(sd::DataType::ANY)->setAllowedOutputTypes({ALL_FLOATS});
+  getOpDescriptor()
+      ->setAllowedInputTypes(sd::DataType::ANY)
+      ->setAllowedOutputTypes({ALL_FLOATS})
+      ->setDataDependentShape(true);
 }
 
 #endif
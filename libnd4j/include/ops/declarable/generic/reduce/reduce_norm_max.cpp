@@ -95,7 +95,10 @@ DECLARE_SHAPE_FN(reduce_norm_max) {
 }
 
 DECLARE_TYPES(reduce_norm_max) {
-  getOpDescriptor()->setAllowedInputTypes(sd::DataType::ANY)->setAllowedOutputTypes({ALL_FLOATS});
+  getOpDescriptor()
+      ->setAllowedInputTypes(sd::DataType::ANY)
+      ->setAllowedOutputTypes({ALL_FLOATS})
+      ->setDataDependentShape(true);
 }
 
 //////////////////////////////////////////////////////////////////////////
@@ -171,7 +174,10 @@ DECLARE_SHAPE_FN(reduce_norm_max_bp) {
 }
 
 DECLARE_TYPES(reduce_norm_max_bp) {
-  getOpDescriptor()->setAllowedInputTypes(sd::DataType::ANY)->setAllowedOutputTypes({ALL_FLOATS});
+  getOpDescriptor()
+      ->setAllowedInputTypes(sd::DataType::ANY)
+      ->setAllowedOutputTypes({ALL_FLOATS})
+      ->setDataDependentShape(true);
 }
 
 }  // namespace ops
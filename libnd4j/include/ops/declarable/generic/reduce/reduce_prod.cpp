@@ -96,7 +96,10 @@ DECLARE_SHAPE_FN(reduce_prod) {
 }
 
 DECLARE_TYPES(reduce_prod) {
-  getOpDescriptor()->setAllowedInputTypes(sd::DataType::ANY)->setAllowedOutputTypes({ALL_FLOATS});
+  getOpDescriptor()
+      ->setAllowedInputTypes(sd::DataType::ANY)
+      ->setAllowedOutputTypes({ALL_FLOATS})
+      ->setDataDependentShape(true);
 }
 
 
@@ -180,7 +183,10 @@ DECLARE_SHAPE_FN(reduce_prod_bp) {
 }
 
 DECLARE_TYPES(reduce_prod_bp) {
-  getOpDescriptor()->setAllowedInputTypes(sd::DataType::ANY)->setAllowedOutputTypes({ALL_FLOATS});
+  getOpDescriptor()
+      ->setAllowedInputTypes(sd::DataType::ANY)
+      ->setAllowedOutputTypes({ALL_FLOATS})
+      ->setDataDependentShape(true);
 }
 
 
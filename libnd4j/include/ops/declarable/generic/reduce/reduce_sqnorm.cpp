@@ -95,7 +95,10 @@ DECLARE_SHAPE_FN(reduce_sqnorm) {
 }
 
 DECLARE_TYPES(reduce_sqnorm) {
-  getOpDescriptor()->setAllowedInputTypes(sd::DataType::ANY)->setAllowedOutputTypes({ALL_FLOATS});
+  getOpDescriptor()
+      ->setAllowedInputTypes(sd::DataType::ANY)
+      ->setAllowedOutputTypes({ALL_FLOATS})
+      ->setDataDependentShape(true);
 }
 
 //////////////////////////////////////////////////////////////////////////
@@ -174,7 +177,10 @@ DECLARE_SHAPE_FN(reduce_sqnorm_bp) {
 }
 
 DECLARE_TYPES(reduce_sqnorm_bp) {
-  getOpDescriptor()->setAllowedInputTypes(sd::DataType::ANY)->setAllowedOutputTypes({ALL_FLOATS});
+  getOpDescriptor()
+      ->setAllowedInputTypes(sd::DataType::ANY)
+      ->setAllowedOutputTypes({ALL_FLOATS})
+      ->setDataDependentShape(true);
 }
 
 
@@ -89,7 +89,12 @@ DECLARE_SHAPE_FN(reduce_sum) {
                                                    keepDims, false, block.getWorkspace()));
 }
 
-DECLARE_TYPES(reduce_sum) { getOpDescriptor()->setAllowedInputTypes(sd::DataType::ANY)->setSameMode(true); }
+DECLARE_TYPES(reduce_sum) {
+  getOpDescriptor()
+      ->setAllowedInputTypes(sd::DataType::ANY)
+      ->setSameMode(true)
+      ->setDataDependentShape(true);
+}
 
 //////////////////////////////////////////////////////////////////////////
 CUSTOM_OP_IMPL(reduce_sum_bp, -1, 1, false, 0, 0) {
@@ -162,7 +167,10 @@ DECLARE_SHAPE_FN(reduce_sum_bp) {
 }
 
 DECLARE_TYPES(reduce_sum_bp) {
-  getOpDescriptor()->setAllowedInputTypes(sd::DataType::ANY)->setAllowedOutputTypes({ALL_FLOATS});
+  getOpDescriptor()
+      ->setAllowedInputTypes(sd::DataType::ANY)
+      ->setAllowedOutputTypes({ALL_FLOATS})
+      ->setDataDependentShape(true);
 }
 
 
@@ -58,7 +58,12 @@ CUSTOM_OP_IMPL(broadcast_to, 2, 1, false, 0, 0) {
   return Status::OK;
 }
 
-DECLARE_TYPES(broadcast_to) { getOpDescriptor()->setAllowedInputTypes(ANY)->setSameMode(true); }
+DECLARE_TYPES(broadcast_to) {
+  getOpDescriptor()
+      ->setAllowedInputTypes(ANY)
+      ->setSameMode(true)
+      ->setDataDependentShape(true);
+}
 
 //////////////////////////////////////////////////////////////////////////
 DECLARE_SHAPE_FN(broadcast_to) {
@@ -53,7 +53,8 @@ DECLARE_TYPES(evaluate_reduction_shape) {
   getOpDescriptor()
       ->setAllowedInputTypes(0, {ALL_INTS})
       ->setAllowedInputTypes(1, {ALL_INTS})
-      ->setAllowedOutputTypes(0, INT64);
+      ->setAllowedOutputTypes(0, INT64)
+      ->setDataDependentShape(true);
 }
 
 DECLARE_SHAPE_FN(evaluate_reduction_shape) {
@@ -35,7 +35,11 @@ CUSTOM_OP_IMPL(linear_copy, 2, 1, false, 0, 0) {
   return Status::OK;
 }
 
-DECLARE_TYPES(linear_copy) { getOpDescriptor()->setAllowedInputTypes(ANY); }
+DECLARE_TYPES(linear_copy) {
+  getOpDescriptor()
+      ->setAllowedInputTypes(ANY)
+      ->setDataDependentShape(true);
+}
 
 //////////////////////////////////////////////////////////////////////////
 DECLARE_SHAPE_FN(linear_copy) {
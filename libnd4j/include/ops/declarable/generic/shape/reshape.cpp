@@ -67,7 +67,11 @@ CUSTOM_OP_IMPL(reshape, 1, 1, false, 0, -2) {
 }
 
 DECLARE_TYPES(reshape) {
-  getOpDescriptor()->setAllowedInputTypes(0, ANY)->setAllowedInputTypes(1, {ALL_INTS})->setSameMode(true);
+  getOpDescriptor()
+      ->setAllowedInputTypes(0, ANY)
+      ->setAllowedInputTypes(1, {ALL_INTS})
+      ->setSameMode(true)
+      ->setDataDependentShape(true);
 }
 
 bool handleOptionalOrder(std::vector<LongType> &reshapeArgs, char &ordering) {
@@ -119,7 +119,8 @@ DECLARE_TYPES(reshape_no_copy) {
   getOpDescriptor()
       ->setAllowedInputTypes(sd::DataType::ANY)
       ->setAllowedOutputTypes(sd::DataType::ANY)
-      ->setSameMode(true);
+      ->setSameMode(true)
+      ->setDataDependentShape(true);
 }
 }
 }
@@ -85,7 +85,12 @@ CUSTOM_OP_IMPL(squeeze, 1, 1, false, 0, -2) {
   return Status::OK;
 }
 
-DECLARE_TYPES(squeeze) { getOpDescriptor()->setAllowedInputTypes(ANY)->setSameMode(true); }
+DECLARE_TYPES(squeeze) {
+  getOpDescriptor()
+      ->setAllowedInputTypes(ANY)
+      ->setSameMode(true)
+      ->setDataDependentShape(true);
+}
 
 DECLARE_SHAPE_FN(squeeze) {
   auto shapeList = SHAPELIST();
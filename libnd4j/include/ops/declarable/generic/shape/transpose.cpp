@@ -69,7 +69,12 @@ CUSTOM_OP_IMPL(transpose, 1, 1, false, 0, 0) {
   return Status::OK;
 }
 
-DECLARE_TYPES(transpose) { getOpDescriptor()->setAllowedInputTypes(ANY)->setSameMode(true); }
+DECLARE_TYPES(transpose) {
+  getOpDescriptor()
+      ->setAllowedInputTypes(ANY)
+      ->setSameMode(true)
+      ->setDataDependentShape(true);
+}
 
 DECLARE_SHAPE_FN(transpose) {
   auto x = INPUT_VARIABLE(0);
@@ -48,7 +48,12 @@ DECLARE_SHAPE_FN(create) {
   return SHAPELIST(sd::ConstantShapeHelper::getInstance().createShapeInfo(dtype, order, shape));
 }
 
-DECLARE_TYPES(create) { getOpDescriptor()->setAllowedInputTypes({ALL_INTS})->setAllowedOutputTypes(ANY); }
+DECLARE_TYPES(create) {
+  getOpDescriptor()
+      ->setAllowedInputTypes({ALL_INTS})
+      ->setAllowedOutputTypes(ANY)
+      ->setDataDependentShape(true);
+}
 }  // namespace ops
 }  // namespace sd
 
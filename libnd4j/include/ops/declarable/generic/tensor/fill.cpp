@@ -63,7 +63,8 @@ DECLARE_TYPES(fill) {
   getOpDescriptor()
       ->setAllowedInputTypes(0, {ALL_INTS})
       ->setAllowedInputTypes(1, {ALL_INTS, ALL_FLOATS})
-      ->setAllowedOutputTypes({ALL_INTS, ALL_FLOATS});
+      ->setAllowedOutputTypes({ALL_INTS, ALL_FLOATS})
+      ->setDataDependentShape(true);
 }
 
 DECLARE_SHAPE_FN(fill) {
@@ -77,7 +77,8 @@ DECLARE_TYPES(lin_space) {
       ->setAllowedInputTypes(0, {ALL_FLOATS, ALL_INTS})
       ->setAllowedInputTypes(1, {ALL_FLOATS, ALL_INTS})
       ->setAllowedInputTypes(2, {ALL_INTS})
-      ->setAllowedOutputTypes({ALL_FLOATS, ALL_INTS});
+      ->setAllowedOutputTypes({ALL_FLOATS, ALL_INTS})
+      ->setDataDependentShape(true);
 }
 }  // namespace ops
 }  // namespace sd
@@ -642,7 +642,11 @@ DECLARE_SHAPE_FN(strided_slice_bp) {
   return SHAPELIST(CONSTANT(newShape));
 }
 
-DECLARE_TYPES(strided_slice) { getOpDescriptor()->setAllowedInputTypes(ANY); }
+DECLARE_TYPES(strided_slice) {
+  getOpDescriptor()
+      ->setAllowedInputTypes(ANY)
+      ->setDataDependentShape(true);
+}
 
 DECLARE_TYPES(strided_slice_bp) {
   getOpDescriptor()->setAllowedInputTypes(ANY);
@@ -93,7 +93,11 @@ CUSTOM_OP_IMPL(batch_to_space, 2, 1, false, 0, 1) {
 
 ////////////////////////////////////////////////////////////////////////////////
 DECLARE_TYPES(batch_to_space) {
-  getOpDescriptor()->setAllowedInputTypes(0, ANY)->setAllowedInputTypes(1, {ALL_INTS})->setSameMode(true);
+  getOpDescriptor()
+      ->setAllowedInputTypes(0, ANY)
+      ->setAllowedInputTypes(1, {ALL_INTS})
+      ->setSameMode(true)
+      ->setDataDependentShape(true);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -98,7 +98,8 @@ DECLARE_TYPES(batch_to_space_nd) {
       ->setAllowedInputTypes(0, sd::DataType::ANY)
       ->setAllowedInputTypes(1, {ALL_INTS})
       ->setAllowedInputTypes(2, {ALL_INTS})
-      ->setSameMode(true);
+      ->setSameMode(true)
+      ->setDataDependentShape(true);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
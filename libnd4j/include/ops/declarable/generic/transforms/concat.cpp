@@ -129,7 +129,9 @@ DECLARE_SYN(concat_v2, concat);
 DECLARE_SYN(concatv2, concat);
 
 DECLARE_TYPES(concat) {
-  getOpDescriptor()->setAllowedInputTypes(ANY);
+  getOpDescriptor()
+      ->setAllowedInputTypes(ANY)
+      ->setDataDependentShape(true);
 }
 
 //////////////////////////////////////////////////////////////////////////
@@ -55,7 +55,10 @@ CUSTOM_OP_IMPL(dynamic_stitch, 2, 1, false, 0, 0) {
 }
 
 DECLARE_TYPES(dynamic_stitch) {
-  getOpDescriptor()->setAllowedInputTypes(sd::DataType::ANY)->setAllowedOutputTypes({ALL_INTS, ALL_FLOATS});
+  getOpDescriptor()
+      ->setAllowedInputTypes(sd::DataType::ANY)
+      ->setAllowedOutputTypes({ALL_INTS, ALL_FLOATS})
+      ->setDataDependentShape(true);
 }
 
 DECLARE_SHAPE_FN(dynamic_stitch) {
@@ -91,7 +91,9 @@ CUSTOM_OP_IMPL(gather, 1, 1, false, 0, -2) {
 DECLARE_TYPES(gather) {
   getOpDescriptor()->setAllowedInputTypes(0, {ALL_INTS, ALL_FLOATS});
   getOpDescriptor()->setAllowedInputTypes(1, {ALL_INTS,ALL_FLOATS});
-  getOpDescriptor()->setAllowedOutputTypes(0, {ALL_INTS, ALL_FLOATS});
+  getOpDescriptor()
+      ->setAllowedOutputTypes(0, {ALL_INTS, ALL_FLOATS})
+      ->setDataDependentShape(true);
 }
 
 DECLARE_SHAPE_FN(gather) {
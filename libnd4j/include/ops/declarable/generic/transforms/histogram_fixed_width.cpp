@@ -54,7 +54,10 @@ CUSTOM_OP_IMPL(histogram_fixed_width, 2, 1, false, 0, 0) {
 }
 
 DECLARE_TYPES(histogram_fixed_width) {
-  getOpDescriptor()->setAllowedInputTypes(sd::DataType::ANY)->setAllowedOutputTypes({ALL_INDICES});
+  getOpDescriptor()
+      ->setAllowedInputTypes(sd::DataType::ANY)
+      ->setAllowedOutputTypes({ALL_INDICES})
+      ->setDataDependentShape(true);
 }
 
 //////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,82 @@
+/* ******************************************************************************
+ *
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ *  See the NOTICE file distributed with this work for additional
+ *  information regarding copyright ownership.
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ******************************************************************************/
+
+//
+// Indexed slices: sparse gradients represented as row ids plus value rows
+//
+
+#include <system/op_boilerplate.h>
+#if NOT_EXCLUDED(OP_indexed_slices_aggregate)
+
+#include <ops/declarable/CustomOperations.h>
+#include <ops/declarable/helpers/indexedSlices.h>
+
+namespace sd {
+namespace ops {
+CUSTOM_OP_IMPL(indexed_slices_aggregate, 2, 2, false, 0, 0) {
+  auto indices = INPUT_VARIABLE(0);
+  auto values = INPUT_VARIABLE(1);
+
+  auto uniqueIndices = OUTPUT_VARIABLE(0);
+  auto aggregated = OUTPUT_VARIABLE(1);
+
+  REQUIRE_TRUE(!indices->isEmpty(), 0, "INDEXED_SLICES_AGGREGATE op: indices array can't be empty");
+  REQUIRE_TRUE(values->rankOf() > indices->rankOf(), 0,
+               "INDEXED_SLICES_AGGREGATE op: values rank must be greater than indices rank, but got %i and %i",
+               values->rankOf(), indices->rankOf());
+  for (int e = 0; e < indices->rankOf(); e++)
+    REQUIRE_TRUE(values->sizeAt(e) == indices->sizeAt(e), 0,
+                 "INDEXED_SLICES_AGGREGATE op: leading dimensions of values must match indices shape, expected %s but "
+                 "got %s",
+                 ShapeUtils::shapeAsString(indices).c_str(), ShapeUtils::shapeAsString(values).c_str());
+
+  helpers::indexedSlicesAggregate(block.launchContext(), indices, values, uniqueIndices, aggregated);
+
+  return Status::OK;
+}
+
+DECLARE_SHAPE_FN(indexed_slices_aggregate) {
+  auto indices = INPUT_VARIABLE(0);
+  auto valuesShape = inputShape->at(1);
+
+  auto numUnique = helpers::indexedSlicesCount(block.launchContext(), indices);
+
+  // rows keep trailing dimensions of values
+  std::vector<LongType> shape = {numUnique};
+  for (int e = indices->rankOf(); e < shape::rank(valuesShape); e++) shape.emplace_back(shape::sizeAt(valuesShape, e));
+
+  auto uniqueShape = ConstantShapeHelper::getInstance().vectorShapeInfo(numUnique, INT64);
+  auto aggregatedShape =
+      ConstantShapeHelper::getInstance().createShapeInfo(ArrayOptions::dataType(valuesShape), 'c', shape);
+
+  return SHAPELIST(uniqueShape, aggregatedShape);
+}
+
+DECLARE_TYPES(indexed_slices_aggregate) {
+  getOpDescriptor()
+      ->setAllowedInputTypes(0, {ALL_INTS})
+      ->setAllowedInputTypes(1, {ALL_FLOATS})
+      ->setAllowedOutputTypes(0, INT64)
+      ->setAllowedOutputTypes(1, {ALL_FLOATS})
+      ->setDataDependentShape(true);
+}
+
+}  // namespace ops
+}  // namespace sd
+
+#endif
@@ -87,7 +87,8 @@ DECLARE_TYPES(pad) {
   getOpDescriptor()
       ->setAllowedInputTypes(0, sd::DataType::ANY)
       ->setAllowedInputTypes(1, {DataType::INT32, DataType::INT64})  // INT32 with TF
-      ->setSameMode(true);
+      ->setSameMode(true)
+      ->setDataDependentShape(true);
 }
 
 DECLARE_SHAPE_FN(pad) {
@@ -87,7 +87,8 @@ DECLARE_TYPES(scatter_nd) {
       ->setAllowedInputTypes(0, {ALL_INTS})
       ->setAllowedInputTypes(1, {ALL_INTS, ALL_FLOATS})
       ->setAllowedInputTypes(2, {ALL_INTS})
-      ->setAllowedOutputTypes({ALL_INTS, ALL_FLOATS});
+      ->setAllowedOutputTypes({ALL_INTS, ALL_FLOATS})
+      ->setDataDependentShape(true);
 }
 
 ////////////////////////////////////////////////////////////////////////
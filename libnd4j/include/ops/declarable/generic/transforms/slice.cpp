@@ -114,7 +114,12 @@ CUSTOM_OP_IMPL(slice, 1, 1, false, 0, -2) {
   return Status::OK;
 }
 
-DECLARE_TYPES(slice) { getOpDescriptor()->setAllowedInputTypes(ANY)->setSameMode(true); }
+DECLARE_TYPES(slice) {
+  getOpDescriptor()
+      ->setAllowedInputTypes(ANY)
+      ->setSameMode(true)
+      ->setDataDependentShape(true);
+}
 
 DECLARE_SHAPE_FN(slice) {
   auto inShape = inputShape->at(0);
@@ -76,7 +76,11 @@ CUSTOM_OP_IMPL(space_to_batch, 2, 1, false, 0, 1) {
 
 ////////////////////////////////////////////////////////////////////////////////
 DECLARE_TYPES(space_to_batch) {
-  getOpDescriptor()->setAllowedInputTypes(0, ANY)->setAllowedInputTypes(1, {ALL_INTS})->setSameMode(true);
+  getOpDescriptor()
+      ->setAllowedInputTypes(0, ANY)
+      ->setAllowedInputTypes(1, {ALL_INTS})
+      ->setSameMode(true)
+      ->setDataDependentShape(true);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -82,7 +82,8 @@ DECLARE_TYPES(space_to_batch_nd) {
       ->setAllowedInputTypes(0, ANY)
       ->setAllowedInputTypes(1, {ALL_INTS})
       ->setAllowedInputTypes(2, {ALL_INTS})
-      ->setSameMode(true);
+      ->setSameMode(true)
+      ->setDataDependentShape(true);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
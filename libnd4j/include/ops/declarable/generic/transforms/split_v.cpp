@@ -75,7 +75,8 @@ DECLARE_TYPES(split_v) {
       ->setAllowedInputTypes(0, {ALL_INTS, ALL_FLOATS})
       ->setAllowedInputTypes(1, {ALL_INTS})
       ->setAllowedInputTypes(2, {ALL_INTS})
-      ->setAllowedOutputTypes({ALL_INTS, ALL_FLOATS});
+      ->setAllowedOutputTypes({ALL_INTS, ALL_FLOATS})
+      ->setDataDependentShape(true);
 }
 
 DECLARE_SHAPE_FN(split_v) {
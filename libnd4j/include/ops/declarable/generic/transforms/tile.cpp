@@ -64,7 +64,8 @@ DECLARE_TYPES(tile) {
   getOpDescriptor()
       ->setAllowedInputTypes(0, sd::DataType::ANY)
       ->setAllowedInputTypes(1, {ALL_INTS})
-      ->setAllowedOutputTypes(sd::DataType::ANY);
+      ->setAllowedOutputTypes(sd::DataType::ANY)
+      ->setDataDependentShape(true);
 }
 
 DECLARE_SHAPE_FN(tile) {
@@ -141,8 +142,9 @@ DECLARE_TYPES(tile_bp) {
   getOpDescriptor()->setAllowedInputTypes(0, {ALL_FLOATS});
   getOpDescriptor()->setAllowedInputTypes(1, {ALL_INTS, ALL_FLOATS});
   getOpDescriptor()->setAllowedInputTypes(2, {ALL_FLOATS});
-
-  getOpDescriptor()->setAllowedOutputTypes({ALL_FLOATS});
+  getOpDescriptor()
+      ->setAllowedOutputTypes({ALL_FLOATS})
+      ->setDataDependentShape(true);
 }
 
 DECLARE_SHAPE_FN(tile_bp) {
@@ -57,7 +57,8 @@ DECLARE_TYPES(barnes_symmetrized) {
       ->setAllowedOutputTypes(1, {INT32})
       ->setAllowedOutputTypes(1, {INT32})
       ->setAllowedOutputTypes(2, {ALL_INTS, ALL_FLOATS})
-      ->setSameMode(false);
+      ->setSameMode(false)
+      ->setDataDependentShape(true);
 }
 
 DECLARE_SHAPE_FN(barnes_symmetrized) {
@@ -0,0 +1,109 @@
+/* ******************************************************************************
+ *
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ *  See the NOTICE file distributed with this work for additional
+ *  information regarding copyright ownership.
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ******************************************************************************/
+
+//
+// Adam applied to rows of sparse gradient only
+//
+
+#include <array/NDArray.h>
+#include <ops/declarable/CustomOperations.h>
+#include <ops/declarable/headers/updaters.h>
+#include <ops/declarable/helpers/updatersHelpers.h>
+#if NOT_EXCLUDED(OP_sparse_adam_updater)
+namespace sd {
+namespace ops {
+
+CUSTOM_OP_IMPL(sparse_adam_updater, 4, 3, true, 4, 0) {
+  auto indices = INPUT_VARIABLE(0);
+  auto gradient = INPUT_VARIABLE(1);
+  auto initStateU = INPUT_VARIABLE(2);
+  auto initStateM = INPUT_VARIABLE(3);
+  auto lastIteration = block.width() > 4 ? INPUT_VARIABLE(4) : nullptr;
+
+  auto update = OUTPUT_VARIABLE(0);
+  auto stateU = OUTPUT_VARIABLE(1);
+  auto stateM = OUTPUT_VARIABLE(2);
+  auto updatedIteration = lastIteration != nullptr ? OUTPUT_VARIABLE(3) : nullptr;
+
+  REQUIRE_TRUE(indices->isEmpty() || indices->isVector() || indices->isScalar(), 0,
+               "SPARSE ADAM UPDATER OP: row ids must be a vector, but got rank %i", indices->rankOf());
+  REQUIRE_TRUE(gradient->rankOf() == initStateU->rankOf() && gradient->sizeAt(0) == indices->lengthOf(), 0,
+               "SPARSE ADAM UPDATER OP: gradient must have one row per row id, and rank of state arrays");
+  for (int e = 1; e < gradient->rankOf(); e++)
+    REQUIRE_TRUE(gradient->sizeAt(e) == initStateU->sizeAt(e), 0,
+                 "SPARSE ADAM UPDATER OP: gradient rows must have the same shape as rows of state V, expected %s but "
+                 "got %s",
+                 ShapeUtils::shapeAsString(initStateU).c_str(), ShapeUtils::shapeAsString(gradient).c_str());
+  REQUIRE_TRUE(initStateU->isSameShape(initStateM), 0,
+               "SPARSE ADAM UPDATER OP: states V and M must have the same shape, but got %s and %s",
+               ShapeUtils::shapeAsString(initStateU).c_str(), ShapeUtils::shapeAsString(initStateM).c_str());
+  if (lastIteration != nullptr) {
+    REQUIRE_TRUE(lastIteration->dataType() == INT64 && lastIteration->lengthOf() == initStateU->sizeAt(0) &&
+                     lastIteration->ews() == 1,
+                 0, "SPARSE ADAM UPDATER OP: last iterations must be contiguous INT64 vector with one value per row");
+    REQUIRE_TRUE(updatedIteration->dataType() == INT64 && updatedIteration->isSameShape(lastIteration) &&
+                     updatedIteration->ews() == 1,
+                 0, "SPARSE ADAM UPDATER OP: updated last iterations must be contiguous INT64 vector of input shape");
+  }
+
+  // rows are addressed directly, without TADs
+  REQUIRE_TRUE(stateU->ews() == 1 && stateU->ordering() == 'c' && stateM->ews() == 1 && stateM->ordering() == 'c', 0,
+               "SPARSE ADAM UPDATER OP: state arrays must be contiguous c-order arrays");
+
+  // touched rows are updated in place, so untouched ones have to be copied if op doesn't run in place
+  if (stateU != initStateU) stateU->assign(*initStateU);
+  if (stateM != initStateM) stateM->assign(*initStateM);
+  if (updatedIteration != lastIteration) updatedIteration->assign(*lastIteration);
+
+  auto iteration = block.getIArguments()->size() > 0 ? INT_ARG(0) : 0;
+
+  helpers::updaterSparseAdam(block.launchContext(), *indices, *gradient, *stateU, *stateM, *update, updatedIteration,
+                             T_ARG(0), T_ARG(1), T_ARG(2), T_ARG(3), iteration);
+  return Status::OK;
+}
+
+DECLARE_SHAPE_FN(sparse_adam_updater) {
+  auto gradientShape = inputShape->at(1);
+  auto stateUShape = inputShape->at(2);
+  auto stateMShape = inputShape->at(3);
+
+  auto shapes = SHAPELIST(ConstantShapeHelper::getInstance().createFromExisting(gradientShape),
+                          ConstantShapeHelper::getInstance().createFromExisting(stateUShape),
+                          ConstantShapeHelper::getInstance().createFromExisting(stateMShape));
+  if (inputShape->size() > 4)
+    shapes->push_back(ConstantShapeHelper::getInstance().createFromExisting(inputShape->at(4)));
+
+  return shapes;
+}
+
+DECLARE_TYPES(sparse_adam_updater) {
+  getOpDescriptor()
+      ->setAllowedInputTypes(0, {ALL_INTS})
+      ->setAllowedInputTypes(1, {ALL_FLOATS})
+      ->setAllowedInputTypes(2, {ALL_FLOATS})
+      ->setAllowedInputTypes(3, {ALL_FLOATS})
+      ->setAllowedInputTypes(4, INT64)
+      ->setAllowedOutputTypes(0, {ALL_FLOATS})
+      ->setAllowedOutputTypes(1, {ALL_FLOATS})
+      ->setAllowedOutputTypes(2, {ALL_FLOATS})
+      ->setAllowedOutputTypes(3, INT64);
+}
+
+}  // namespace ops
+}  // namespace sd
+#endif
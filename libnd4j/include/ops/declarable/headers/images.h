@@ -271,6 +271,39 @@ DECLARE_CUSTOM_OP(resize_area, 1, 1, false, 0, -2);
 DECLARE_CUSTOM_OP(image_resize, 2, 1, false, -2, -2);
 #endif
 
+/**
+ * This op does typical inference preprocessing of images in one pass: optional crop, bilinear resize,
+ * normalization (scale * x - mean) / std, optional channel reversal (RGB <-> BGR), optional NCHW layout and cast
+ *
+ * input array:
+ *    0 - 4D-Tensor with shape (batch, height, width, channels) or 3D-Tensor (height, width, channels), usually uint8
+ *    1 - 1D-Tensor with per-channel mean (optional), given in output channel order
+ *    2 - 1D-Tensor with per-channel std (optional), given in output channel order
+ *
+ * int arguments:
+ *    0 - new height
+ *    1 - new width
+ *    2 - data format of output: 0 - NHWC (default), 1 - NCHW
+ *    3, 4, 5, 6 - crop window: y, x, height, width (optional, whole image by default)
+ *
+ * float arguments:
+ *    0 - scale applied to input before mean subtraction (optional, default 1.0), e.g. 1/255
+ *
+ * bool arguments:
+ *    0 - reverse channels (optional, default false)
+ *    1 - half pixel centers (optional, default true), false uses legacy asymmetric coordinates
+ *
+ * data type arguments:
+ *    0 - output type, FLOAT32 by default
+ *
+ * output array:
+ *    resized and normalized images with shape (batch, newHeight, newWidth, channels) or
+ *    (batch, channels, newHeight, newWidth), batch dimension is absent for 3D input
+ */
+#if NOT_EXCLUDED(OP_image_preprocess)
+DECLARE_CUSTOM_OP(image_preprocess, 1, 1, false, -2, 2);
+#endif
+
 }  // namespace ops
 }  // namespace sd
 #endif
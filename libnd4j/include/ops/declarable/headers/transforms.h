@@ -95,6 +95,23 @@ DECLARE_CUSTOM_OP(mergeavg_bp, 2, 1, false, 0, 0);
 DECLARE_CONFIGURABLE_OP(scatter_update, -2, 1, true, 0, -2);
 #endif
 
+/**
+ * This operation aggregates indexed slices, i.e. sparse gradient given as row ids and value rows: rows with the same
+ * id are summed, in order of their appearance. Backprop of gather/embedding_lookup along axis 0 is exactly
+ * (indices, gradO), so passing these gives sparse gradient of the table, without dense scatter.
+ *
+ * Input arrays:
+ *   0: row ids, any shape, integer type
+ *   1: values, shape of row ids followed by row shape
+ *
+ * Output arrays:
+ *   0: unique row ids, sorted ascending, INT64 vector
+ *   1: aggregated rows, [number of unique ids, row shape...]
+ */
+#if NOT_EXCLUDED(OP_indexed_slices_aggregate)
+DECLARE_CUSTOM_OP(indexed_slices_aggregate, 2, 2, false, 0, 0);
+#endif
+
 #if NOT_EXCLUDED(OP_Floor)
 DECLARE_OP(Floor, 1, 1, true);
 #endif
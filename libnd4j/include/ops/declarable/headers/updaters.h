@@ -141,6 +141,34 @@ DECLARE_CONFIGURABLE_OP(nesterovs_updater, 2, 2, true, 0, 0);
 #if NOT_EXCLUDED(OP_adam_updater)
 DECLARE_CONFIGURABLE_OP(adam_updater, 3, 3, true, 0, 0);
 #endif
+// Sparse Adam
+/* Applies Adam to rows touched by sparse gradient only, states of other rows stay intact.
+ * Input arrays :
+ *  0 - unique row ids, integer vector, e.g. output 0 of indexed_slices_aggregate
+ *  1 - gradient rows, [number of ids, row shape...]
+ *  2 - gradient state V, [number of rows, row shape...]
+ *  3 - gradient state M, [number of rows, row shape...]
+ * Optional :
+ *  4 - INT64 vector with iteration of last update of every row, -1 for rows never updated. If provided, moments of
+ *      touched rows are first decayed for iterations they were skipped, as dense Adam would do with zero gradient.
+ *      Without it moments decay only when rows are touched (lazy Adam)
+ * Output arrays :
+ *  0 - update rows, same shape as gradient rows
+ *  1 - state V, 2 - state M. Ops should run in place for large tables, otherwise states are copied first
+ * Optional :
+ *  3 - last iterations with touched rows set to current iteration, produced if input 4 is provided
+ * T args
+ *  0 - scalar learning rate value
+ *  1 - beta 1 value
+ *  2 - beta 2 value
+ *  3 - epsilon
+ * Optional:
+ * I args
+ *  0 - iteration
+ */
+#if NOT_EXCLUDED(OP_sparse_adam_updater)
+DECLARE_CUSTOM_OP(sparse_adam_updater, 4, 3, true, 4, 0);
+#endif
 // AdaBelief
 /* Input arrays :
  *  0 - input array with gradients.
@@ -48,6 +48,27 @@ SD_LIB_HIDDEN void thresholdRelu(LaunchContext *context, NDArray&input, double t
 
 SD_LIB_HIDDEN void thresholdReluDerivative(LaunchContext *context, NDArray *input, double threshold, NDArray *dLdO,
                                            NDArray *output);
+
+// activations having approximate mode, see Environment::setApproximateActivations
+enum class ApproximateActivation { SIGMOID, TANH };
+
+/**
+ * This method checks if approximate mode covers given arrays: contiguous INT8/UINT8 or HALF/BFLOAT16 input and
+ * contiguous float output of the same length. Other arrays are computed exactly
+ */
+SD_LIB_HIDDEN bool isApproximateActivationSupported(NDArray &input, NDArray &output);
+
+/**
+ * This method applies activation in approximate mode:
+ * - 8-bit inputs are mapped through table of all 256 results, computed exactly in double, so the only error is
+ *   rounding to output type
+ * - half inputs are computed in float with piecewise cubic polynomials over 128 intervals of [0, 16) of |x|.
+ *   Sigmoid fits q = sigmoid(-|x|), used as is for negative inputs and as 1 - q for positive ones, so small results
+ *   keep relative precision; past 16 q is exp(-|x|). Tanh fits tanh(|x|) and saturates to 1 past 16, negative inputs
+ *   use symmetry. Max absolute error is 7.5e-8 for sigmoid (relative 2.4e-7 on negative side) and 6.6e-7 for tanh
+ */
+SD_LIB_HIDDEN void approximateActivation(LaunchContext *context, ApproximateActivation activation, NDArray &input,
+                                         NDArray &output);
 }  // namespace helpers
 }  // namespace ops
 }  // namespace sd
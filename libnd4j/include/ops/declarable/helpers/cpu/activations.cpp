@@ -23,8 +23,10 @@
 #include <execution/Threads.h>
 #include <helpers/ConstantTadHelper.h>
 #include <helpers/ShapeUtils.h>
+#include <math/vectormath.h>
 #include <ops/declarable/helpers/activations.h>
 
+#include <cmath>
 #include <numeric>
 
 namespace sd {
@@ -244,6 +246,165 @@ void logSoftmax(sd::LaunchContext* context, NDArray& input, NDArray& output, con
   }
 }
 
+///////////////////////////////////////////////////////////////////
+// exact activation, source of lookup tables
+static double exactActivation(ApproximateActivation activation, double x) {
+  switch (activation) {
+    case ApproximateActivation::SIGMOID:
+      return 1. / (1. + std::exp(-x));
+    default:
+      return std::tanh(x);
+  }
+}
+
+// function approximated by polynomials for a = |x|: sigmoid(-a), which keeps relative precision of small results on
+// negative side, and tanh(a)
+static double polynomialFunction(ApproximateActivation activation, double a) {
+  return activation == ApproximateActivation::SIGMOID ? 1. / (1. + std::exp(a)) : std::tanh(a);
+}
+
+// polynomials cover [0, kApproximateRange) split into kApproximateIntervals equal intervals
+constexpr int kApproximateIntervals = 128;
+constexpr float kApproximateRange = 16.f;
+constexpr float kApproximateWidth = kApproximateRange / kApproximateIntervals;
+
+/**
+ * Cubic polynomial of polynomialFunction for every interval, in local coordinate t = x - interval start:
+ * c0 + c1 * t + c2 * t^2 + c3 * t^3. Polynomials interpolate activation at Chebyshev-Lobatto nodes, which is close
+ * to minimax for such short intervals, and keeps pieces continuous and exact at interval ends
+ */
+struct ActivationPolynomials {
+  float coefficients[kApproximateIntervals][4];
+
+  explicit ActivationPolynomials(ApproximateActivation activation) {
+    for (int i = 0; i < kApproximateIntervals; i++) {
+      // interpolation conditions, augmented with activation values
+      double system[4][5];
+      for (int k = 0; k < 4; k++) {
+        const double t = kApproximateWidth * 0.5 * (1. - std::cos(M_PI * k / 3.));
+        double power = 1.;
+        for (int j = 0; j < 4; j++) {
+          system[k][j] = power;
+          power *= t;
+        }
+        system[k][4] = polynomialFunction(activation, i * kApproximateWidth + t);
+      }
+
+      // nodes are distinct, so Gauss-Jordan elimination doesn't need pivoting
+      for (int c = 0; c < 4; c++)
+        for (int r = 0; r < 4; r++) {
+          if (r == c) continue;
+          const double factor = system[r][c] / system[c][c];
+          for (int j = c; j < 5; j++) system[r][j] -= factor * system[c][j];
+        }
+
+      for (int j = 0; j < 4; j++) coefficients[i][j] = static_cast<float>(system[j][4] / system[j][j]);
+    }
+  }
+};
+
+static const ActivationPolynomials& activationPolynomials(ApproximateActivation activation) {
+  static const ActivationPolynomials sigmoid(ApproximateActivation::SIGMOID);
+  static const ActivationPolynomials tanh(ApproximateActivation::TANH);
+  return activation == ApproximateActivation::SIGMOID ? sigmoid : tanh;
+}
+
+// a < kApproximateRange for a >= 0, compared on bits, so NaNs are out of range in fast-math builds too
+static SD_INLINE bool inApproximateRange(float a) {
+  return math::floatToRawIntBits(a) < math::floatToRawIntBits(kApproximateRange);
+}
+
+// polynomial value at a >= 0, inputs past the range (and NaNs) are clamped to its end
+static SD_INLINE float evaluatePolynomial(const ActivationPolynomials& polynomials, float a) {
+  const float clamped = math::vec::blend(inApproximateRange(a), a, kApproximateRange);
+  const int i = math::sd_min<int>(static_cast<int>(clamped * (1.f / kApproximateWidth)), kApproximateIntervals - 1);
+  const float t = clamped - static_cast<float>(i) * kApproximateWidth;
+  const float* c = polynomials.coefficients[i];
+  return ((c[3] * t + c[2]) * t + c[1]) * t + c[0];
+}
+
+template <typename X, typename Z>
+static void polynomialActivation_(ApproximateActivation activation, const X* x, Z* z, LongType length) {
+  const auto& polynomials = activationPolynomials(activation);
+  const bool sigmoid = activation == ApproximateActivation::SIGMOID;
+
+  auto func = PRAGMA_THREADS_FOR {
+    if (sigmoid) {
+      PRAGMA_OMP_SIMD
+      for (auto e = start; e < stop; e++) {
+        const float v = static_cast<float>(x[e]);
+        const float a = math::vec::absf(v);
+        // past the range sigmoid(-a) = exp(-a) / (1 + exp(-a)) rounds to exp(-a)
+        const float q = math::vec::blend(inApproximateRange(a), evaluatePolynomial(polynomials, a),
+                                         math::vec::expFloat(-a));
+        // sigmoid(a) == 1 - sigmoid(-a)
+        const float r = math::vec::blend(v < 0.f, q, 1.f - q);
+        z[e] = static_cast<Z>(math::vec::blend(math::vec::isNan(v), v, r));
+      }
+    } else {
+      PRAGMA_OMP_SIMD
+      for (auto e = start; e < stop; e++) {
+        const float v = static_cast<float>(x[e]);
+        const float a = math::vec::absf(v);
+        // tanh(16) rounds to 1
+        const float p = math::vec::blend(inApproximateRange(a), evaluatePolynomial(polynomials, a), 1.f);
+        // tanh(-a) == -tanh(a)
+        const float r = math::vec::blend(v < 0.f, -p, p);
+        z[e] = static_cast<Z>(math::vec::blend(math::vec::isNan(v), v, r));
+      }
+    }
+  };
+  samediff::Threads::parallel_for(func, 0, length);
+}
+
+template <typename Z>
+static void lookupActivation_(ApproximateActivation activation, bool isSigned, const uint8_t* x, Z* z,
+                              LongType length) {
+  // results for all byte values, indexed by raw byte of input
+  Z table[256];
+  for (int b = 0; b < 256; b++)
+    table[b] = static_cast<Z>(exactActivation(activation, isSigned ? static_cast<int8_t>(b) : b));
+
+  auto func = PRAGMA_THREADS_FOR {
+    for (auto e = start; e < stop; e++) z[e] = table[x[e]];
+  };
+  samediff::Threads::parallel_for(func, 0, length);
+}
+
+template <typename Z>
+static void approximateActivation_(ApproximateActivation activation, NDArray& input, NDArray& output) {
+  const auto length = input.lengthOf();
+  auto z = output.bufferAsT<Z>();
+
+  switch (input.dataType()) {
+    case INT8:
+    case UINT8:
+      lookupActivation_<Z>(activation, input.dataType() == INT8, reinterpret_cast<const uint8_t*>(input.buffer()), z,
+                           length);
+      break;
+    case HALF:
+      polynomialActivation_<float16, Z>(activation, reinterpret_cast<const float16*>(input.buffer()), z, length);
+      break;
+    default:
+      polynomialActivation_<bfloat16, Z>(activation, reinterpret_cast<const bfloat16*>(input.buffer()), z, length);
+  }
+}
+
+bool isApproximateActivationSupported(NDArray& input, NDArray& output) {
+  const auto type = input.dataType();
+  const bool lowPrecision = type == INT8 || type == UINT8 || type == HALF || type == BFLOAT16;
+  return lowPrecision && output.isR() && input.lengthOf() == output.lengthOf() &&
+         input.ordering() == output.ordering() && input.ews() == 1 && output.ews() == 1;
+}
+
+void approximateActivation(sd::LaunchContext* context, ApproximateActivation activation, NDArray& input,
+                           NDArray& output) {
+  if (!isApproximateActivationSupported(input, output))
+    THROW_EXCEPTION("approximateActivation: approximate mode needs contiguous 8-bit or half input and float output");
+
+  BUILD_SINGLE_SELECTOR(output.dataType(), approximateActivation_, (activation, input, output), SD_FLOAT_TYPES);
+}
+
 BUILD_SINGLE_TEMPLATE(template void thresholdReluDerivative_,
                       (sd::LaunchContext * context, NDArray* input, double threshold, NDArray* dLdO, NDArray* output),
                       SD_FLOAT_TYPES);
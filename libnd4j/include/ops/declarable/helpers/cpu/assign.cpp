@@ -18,6 +18,7 @@
 
 #include <ops/declarable/helpers/assign.h>
 #include <execution/Threads.h>
+#include <helpers/BulkTypeCast.h>
 #include <helpers/ConstantTadHelper.h>
 #include <helpers/PointersManager.h>
 #include <helpers/ShapeUtils.h>
@@ -91,6 +92,10 @@ SD_LIB_HIDDEN void assign(sd::LaunchContext* context, sd::NDArray* target, sd::N
                           && shape::haveSameShapeAndStrides(source->shapeInfo(), target->shapeInfo());
 
   if (canUseLinearCopy) {
+    auto xBuffer = reinterpret_cast<const int8_t*>(source->dataBuffer()->primary()) + source->offset() * source->sizeOfT();
+    auto zBuffer = reinterpret_cast<int8_t*>(target->dataBuffer()->primary()) + target->offset() * target->sizeOfT();
+    if (BulkTypeCast::convert(xBuffer, xType, zBuffer, zType, length)) return;
+
     auto func = PRAGMA_THREADS_FOR {
       BUILD_DOUBLE_SELECTOR(xType, zType, fastLinearCopy_,
                             (source->dataBuffer()->primary(), target->dataBuffer()->primary(), length, start, stop, source->offset(), target->offset()),
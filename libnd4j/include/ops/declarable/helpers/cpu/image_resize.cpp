@@ -38,6 +38,7 @@ limitations under the License.
 #include <execution/Threads.h>
 #include <ops/declarable/headers/parity_ops.h>
 #include <ops/declarable/helpers/image_resize.h>
+#include <ops/declarable/helpers/resizePlans.h>
 
 #include "../cross.h"
 #if NOT_EXCLUDED(OP_image_resize)
@@ -89,37 +90,65 @@ static void resizeImage_(T const* pInputBuf, sd::LongType batchSize, sd::LongTyp
 
   BilinearInterpolationData const* xsPtr = xs.data();
 
-  auto computeBilinear = [](double topLeft, double topRight, double bottomLeft, double bottomRight, double xVal,
-                            double yVal) {
-    double top = topLeft + (topRight - topLeft) * xVal;
-    double bottom = bottomLeft + (bottomRight - bottomLeft) * xVal;
-    return top + (bottom - top) * yVal;
+  // horizontal pass of one input row into row buffer
+  auto interpolateRow = [&](const T* inputRow, double* rowBuffer) {
+    for (sd::LongType x = 0; x < outWidth; ++x) {
+      auto left = inputRow + xsPtr[x].bottomIndex;
+      auto right = inputRow + xsPtr[x].topIndex;
+      double xVal = xsPtr[x].interpolarValue;
+      auto pRow = rowBuffer + x * channels;
+      PRAGMA_OMP_SIMD
+      for (sd::LongType c = 0; c < channels; ++c) {
+        double l(left[c]);
+        double r(right[c]);
+        pRow[c] = l + (r - l) * xVal;
+      }
+    }
   };
 
+  // output rows are split between threads, each thread keeps horizontally interpolated input rows and reuses them
+  // while consecutive output rows read the same input rows, which is the usual case for upsampling
   auto func = PRAGMA_THREADS_FOR {
-    for (auto batch = start; batch < stop; ++batch) {
+    std::vector<double> top(outRowSize);
+    std::vector<double> bottom(outRowSize);
+    sd::LongType topRow = -1;
+    sd::LongType bottomRow = -1;
+
+    for (auto r = start; r < stop; ++r) {
+      auto batch = r / outHeight;
+      auto y = r % outHeight;
       auto pInput = pInputBuf + batch * inBatchNumValues;
-      for (sd::LongType y = 0; y < outHeight; ++y) {
-        auto pOutput = pOutputBuf + (batch * outHeight + y) * outRowSize;
-        const T* ysInputLowerPtr = pInput + ys[y].bottomIndex * inRowSize;
-        const T* ysInputUpperPtr = pInput + ys[y].topIndex * inRowSize;
-        double yVal = ys[y].interpolarValue;
-        for (sd::LongType x = 0; x < outWidth; ++x) {
-          auto xsBottom = xsPtr[x].bottomIndex;
-          auto xsTop = xsPtr[x].topIndex;
-          auto xVal = xsPtr[x].interpolarValue;
-          for (sd::LongType c = 0; c < channels; ++c) {
-            double topLeft(ysInputLowerPtr[xsBottom + c]);
-            double topRight(ysInputLowerPtr[xsTop + c]);
-            double bottomLeft(ysInputUpperPtr[xsBottom + c]);
-            double bottomRight(ysInputUpperPtr[xsTop + c]);
-            pOutput[x * channels + c] = computeBilinear(topLeft, topRight, bottomLeft, bottomRight, xVal, yVal);
-          }
+      auto lowerRow = batch * inHeight + ys[y].bottomIndex;
+      auto upperRow = batch * inHeight + ys[y].topIndex;
+
+      if (lowerRow != topRow) {
+        if (lowerRow == bottomRow) {
+          std::swap(top, bottom);
+          std::swap(topRow, bottomRow);
+        } else {
+          interpolateRow(pInput + ys[y].bottomIndex * inRowSize, top.data());
+          topRow = lowerRow;
         }
       }
+
+      if (upperRow != bottomRow) {
+        if (upperRow == topRow)
+          bottom = top;
+        else
+          interpolateRow(pInput + ys[y].topIndex * inRowSize, bottom.data());
+        bottomRow = upperRow;
+      }
+
+      auto pOutput = pOutputBuf + r * outRowSize;
+      auto pTop = top.data();
+      auto pBottom = bottom.data();
+      double yVal = ys[y].interpolarValue;
+      PRAGMA_OMP_SIMD
+      for (sd::LongType i = 0; i < outRowSize; ++i) pOutput[i] = pTop[i] + (pBottom[i] - pTop[i]) * yVal;
     }
   };
-  samediff::Threads::parallel_tad(func, 0, batchSize);
+  // rows cost the same, so they're split evenly between all threads
+  samediff::Threads::parallel_tad(func, 0, batchSize * outHeight, 1, Environment::getInstance().maxMasterThreads());
 }
 
 template <typename X, typename Z>
@@ -142,34 +171,44 @@ static sd::Status resizeBilinearFunctor_(NDArray * images, int const width, int
     return sd::Status::OK;
   }
 
-  std::vector<BilinearInterpolationData> ys(outHeight + 1);
-  std::vector<BilinearInterpolationData> xs(outWidth + 1);
-  if (halfPixelCenter) {
-    computeInterpolationWeights(HalfPixelScaler(), outHeight, inHeight, st.heightScale, ys.data());
-    computeInterpolationWeights(HalfPixelScaler(), outWidth, inWidth, st.widthScale, xs.data());
+  ResizePlanKey key;
+  key.method = kResizeBilinear;
+  key.alignCorners = alignCorners;
+  key.halfPixelCenters = halfPixelCenter;
+  key.inHeight = inHeight;
+  key.inWidth = inWidth;
+  key.outHeight = outHeight;
+  key.outWidth = outWidth;
+  key.wStride = channels;
+
+  auto plan = ResizePlanCache::getInstance().plan(key, [&](ResizePlan& p) {
+    p.ys.resize(outHeight + 1);
+    p.xs.resize(outWidth + 1);
+    if (halfPixelCenter) {
+      computeInterpolationWeights(HalfPixelScaler(), outHeight, inHeight, st.heightScale, p.ys.data());
+      computeInterpolationWeights(HalfPixelScaler(), outWidth, inWidth, st.widthScale, p.xs.data());
+
+    } else {
+      // Compute the cached interpolation weights on the x and y dimensions.
+      computeInterpolationWeights(LegacyScaler(), outHeight, inHeight, st.heightScale, p.ys.data());
+      computeInterpolationWeights(LegacyScaler(), outWidth, inWidth, st.widthScale, p.xs.data());
+    }
 
-  } else {
-    // Compute the cached interpolation weights on the x and y dimensions.
-    computeInterpolationWeights(LegacyScaler(), outHeight, inHeight, st.heightScale, ys.data());
-    computeInterpolationWeights(LegacyScaler(), outWidth, inWidth, st.widthScale, xs.data());
-  }
-  int xsSize = xs.size();
-  // Scale x interpolation weights to avoid a multiplication during iteration.
-  auto func = PRAGMA_THREADS_FOR {
-    for (auto i = start; i < stop; i++) {
-      xs[i].bottomIndex *= channels;
-      xs[i].topIndex *= channels;
+    // Scale x interpolation weights to avoid a multiplication during iteration.
+    for (auto& x : p.xs) {
+      x.bottomIndex *= channels;
+      x.topIndex *= channels;
     }
-  };
-  samediff::Threads::parallel_for(func, 0, xsSize);
+  });
 
   resizeImage_<X, Z>(images->getDataBuffer()->primaryAsT<X>(), batchSize, inHeight, inWidth, outHeight, outWidth,
-                     channels, xs, ys, output->dataBuffer()->primaryAsT<Z>());
+                     channels, plan->xs, plan->ys, output->dataBuffer()->primaryAsT<Z>());
   return sd::Status::OK;
 }
 
 template <class Scaler, typename T>
-void resizeNeighborImpl(ImageResizerState const& st, NDArray * images, NearestMode nearestMode, NDArray* output) {
+void resizeNeighborImpl(ImageResizerState const& st, NDArray * images, NearestMode nearestMode, bool alignCorners,
+                        NDArray* output) {
   const sd::LongType batchSize = st.batchSize;
   const sd::LongType inHeight = st.inHeight;
   const sd::LongType inWidth = st.inWidth;
@@ -199,6 +238,59 @@ void resizeNeighborImpl(ImageResizerState const& st, NDArray * images, NearestMo
       modeFunc = [](float x){return sd::math::p_floor<float>(x);};
   }
 
+  if (images->ordering() == 'c' && images->ews() == 1 && output->ordering() == 'c' && output->ews() == 1) {
+    ResizePlanKey key;
+    key.method = kResizeNearest;
+    key.coordinateMode = std::is_same<Scaler, LegacyScaler>::value    ? ASYMMETRIC
+                         : std::is_same<Scaler, HalfPixelScalerNN>::value ? HALF_PIXEL_NN
+                                                                           : HALF_PIXEL;
+    key.nearestMode = nearestMode;
+    key.alignCorners = alignCorners;
+    key.inHeight = inHeight;
+    key.inWidth = inWidth;
+    key.outHeight = outHeight;
+    key.outWidth = outWidth;
+    key.wStride = channels;
+
+    auto plan = ResizePlanCache::getInstance().plan(key, [&](ResizePlan& p) {
+      p.yIndices.resize(outHeight);
+      p.xIndices.resize(outWidth);
+      for (sd::LongType y = 0; y < outHeight; ++y) {
+        auto posY = static_cast<sd::LongType>(modeFunc(scaler(y, st.heightScale)));
+        sd::LongType inY = sd::math::sd_min(posY, inHeight - 1);
+        if (halfPixelCenter) inY = sd::math::sd_max(0LL, inY);
+        p.yIndices[y] = inY;
+      }
+      for (sd::LongType x = 0; x < outWidth; ++x) {
+        auto posX = static_cast<sd::LongType>(modeFunc(scaler(x, st.widthScale)));
+        sd::LongType inX = sd::math::sd_min(posX, inWidth - 1);
+        if (halfPixelCenter) inX = sd::math::sd_max(0LL, inX);
+        p.xIndices[x] = inX * channels;
+      }
+    });
+
+    const T* inputBuf = images->bufferAsT<T>();
+    T* outputBuf = output->bufferAsT<T>();
+    const sd::LongType* xIndices = plan->xIndices.data();
+    const sd::LongType* yIndices = plan->yIndices.data();
+
+    auto func = PRAGMA_THREADS_FOR {
+      for (auto r = start; r < stop; r++) {
+        auto b = r / outHeight;
+        auto inputRow = inputBuf + (b * inHeight + yIndices[r % outHeight]) * inWidth * channels;
+        auto outputRow = outputBuf + r * outWidth * channels;
+        for (sd::LongType x = 0; x < outWidth; ++x) {
+          auto pixel = inputRow + xIndices[x];
+          auto outPixel = outputRow + x * channels;
+          PRAGMA_OMP_SIMD
+          for (sd::LongType e = 0; e < channels; e++) outPixel[e] = pixel[e];
+        }
+      }
+    };
+    samediff::Threads::parallel_tad(func, 0, batchSize * outHeight, 1, Environment::getInstance().maxMasterThreads());
+    return;
+  }
+
   auto func = PRAGMA_THREADS_FOR_2D {
     for (auto b = start_x; b < stop_x; b += inc_x) {
       for (auto y = start_y; y < stop_y; y += inc_y) {
@@ -237,16 +329,16 @@ sd::Status resizeNeighborFunctor_(NDArray * images, int const width, int const h
 
   switch (coorMode) {
     case ASYMMETRIC:
-      resizeNeighborImpl<LegacyScaler, T>(st, images, nearestMode, output);
+      resizeNeighborImpl<LegacyScaler, T>(st, images, nearestMode, alignCorner, output);
       break;
     case HALF_PIXEL:
-      resizeNeighborImpl<HalfPixelScaler, T>(st, images, nearestMode, output);
+      resizeNeighborImpl<HalfPixelScaler, T>(st, images, nearestMode, alignCorner, output);
       break;
     case HALF_PIXEL_NN:
-      resizeNeighborImpl<HalfPixelScalerNN, T>(st, images, nearestMode, output);
+      resizeNeighborImpl<HalfPixelScalerNN, T>(st, images, nearestMode, alignCorner, output);
       break;
     default:
-      resizeNeighborImpl<HalfPixelScaler, T>(st, images, nearestMode, output);
+      resizeNeighborImpl<HalfPixelScaler, T>(st, images, nearestMode, alignCorner, output);
       break;
   };
   return sd::Status::OK;
@@ -334,13 +426,35 @@ static void computeXWeightsAndIndices(const ImageResizerState& resizer_state, co
 }
 
 template <typename T, typename F, typename Scaler>
-static void bicubicInterpolateWithCaching(NDArray * image, ImageResizerState const& resizerState,
+static void bicubicInterpolateWithCaching(NDArray * image, ImageResizerState const& resizerState, bool alignCorners,
                                           const double coefficient, bool exclude_outside, NDArray* output) {
-  std::vector<WeightsAndIndices> xWais(resizerState.outWidth);
-  auto coeffs_table_uniq = initCoeffsTable<float>(coefficient);
-  float* coeffs_table = coeffs_table_uniq.get();
-
-  computeXWeightsAndIndices<Scaler>(resizerState, coeffs_table, &xWais, exclude_outside);
+  ResizePlanKey key;
+  key.method = kResizeBicubic;
+  key.coordinateMode = std::is_same<Scaler, LegacyScaler>::value      ? ASYMMETRIC
+                       : std::is_same<Scaler, HalfPixelScalerNN>::value ? HALF_PIXEL_NN
+                                                                         : HALF_PIXEL;
+  key.alignCorners = alignCorners;
+  key.excludeOutside = exclude_outside;
+  key.coefficient = coefficient;
+  key.inHeight = resizerState.inHeight;
+  key.inWidth = resizerState.inWidth;
+  key.outHeight = resizerState.outHeight;
+  key.outWidth = resizerState.outWidth;
+  key.wStride = resizerState.wStride;
+
+  auto plan = ResizePlanCache::getInstance().plan(key, [&](ResizePlan& p) {
+    auto coeffsTable = initCoeffsTable<float>(coefficient);
+    p.coefficients.assign(coeffsTable.get(), coeffsTable.get() + (kTableSize + 1) * 2);
+
+    p.xWais.resize(resizerState.outWidth);
+    computeXWeightsAndIndices<Scaler>(resizerState, p.coefficients.data(), &p.xWais, exclude_outside);
+
+    p.yWais.resize(resizerState.outHeight);
+    for (sd::LongType y = 0; y < resizerState.outHeight; ++y)
+      getWeightsAndIndices<Scaler>(p.coefficients.data(), resizerState.heightScale, y, resizerState.inHeight,
+                                   &p.yWais[y], exclude_outside);
+  });
+  const std::vector<WeightsAndIndices>& xWais = plan->xWais;
 
   const auto numChannels = resizerState.channels;
   const auto batchNum = resizerState.batchSize;
@@ -359,9 +473,7 @@ static void bicubicInterpolateWithCaching(NDArray * image, ImageResizerState con
       for (sd::LongType y = 0; y < outHeight; ++y) {
         auto pOutput = &pOutputY[(b * outHeight + y) * outWidth * numChannels];
 
-        WeightsAndIndices yWai;
-        getWeightsAndIndices<Scaler>(coeffs_table, resizerState.heightScale, y, resizerState.inHeight, &yWai,
-                                     exclude_outside);
+        const WeightsAndIndices& yWai = plan->yWais[y];
         // Make pointers represent offsets of data in inputBPtr.
         const T* y_ptr_0 = pInput + yWai._index0 * hStride;
         const T* y_ptr_1 = pInput + yWai._index1 * hStride;
@@ -511,13 +623,16 @@ sd::Status resizeBicubicFunctorA_(sd::LaunchContext* context, NDArray * image, i
   if (res == sd::Status::OK) {
     switch (coorMode) {
       case ASYMMETRIC:
-        bicubicInterpolateWithCaching<T, float, LegacyScaler>(image, st, coefficient, exclude_outside, output);
+        bicubicInterpolateWithCaching<T, float, LegacyScaler>(image, st, alignCorners, coefficient, exclude_outside,
+                                                               output);
         break;
       case HALF_PIXEL:
-        bicubicInterpolateWithCaching<T, float, HalfPixelScaler>(image, st, coefficient, exclude_outside, output);
+        bicubicInterpolateWithCaching<T, float, HalfPixelScaler>(image, st, alignCorners, coefficient, exclude_outside,
+                                                               output);
         break;
       case HALF_PIXEL_NN:
-        bicubicInterpolateWithCaching<T, float, HalfPixelScalerNN>(image, st, coefficient, exclude_outside, output);
+        bicubicInterpolateWithCaching<T, float, HalfPixelScalerNN>(image, st, alignCorners, coefficient, exclude_outside,
+                                                               output);
         break;
       default:
         break;
@@ -535,60 +650,96 @@ sd::Status resizeBicubicFunctorA(sd::LaunchContext* context, NDArray * image, in
 }
 // ------------------------------------------------------------------------------------------------------------------ //
 
+// same summation order as computePatchSum, with channels in the inner loop, for inputs with unit channel stride
 template <typename T>
-static void resizeArea(ImageResizerState const& st, std::vector<CachedInterpolation> const& caches,
-                       NDArray * input, NDArray* output) {
+static void computePatchSumVectorized(float scale, const ImageResizerState& st, const ScaleCache<T>* yScaleCache,
+                                      sd::LongType ptrsLen, const CachedInterpolation& xCache, float* sumY,
+                                      float* outputPtr) {
+  bool const needsXBounding = xCache.needsBounding;
+  auto boundIfNeeded = [needsXBounding](sd::LongType x, sd::LongType y) -> sd::LongType {
+    return (needsXBounding ? bound(x, y) : (x));
+  };
+
+  const auto numChannels = st.channels;
+  PRAGMA_OMP_SIMD
+  for (sd::LongType c = 0; c < numChannels; ++c) outputPtr[c] = 0.f;
+
+  for (sd::LongType i = 0; i < ptrsLen; ++i) {
+    const T* ptr = yScaleCache[i].yPtr + st.wStride * boundIfNeeded(xCache.start, st.inWidth);
+    float scaleX = xCache.startScale;
+    PRAGMA_OMP_SIMD
+    for (sd::LongType c = 0; c < numChannels; ++c) sumY[c] = static_cast<float>(ptr[c]) * scaleX;
+
+    if (xCache.start + 1 != xCache.end) {
+      for (sd::LongType x = xCache.start + 1; x < xCache.end - 1; ++x) {
+        ptr = yScaleCache[i].yPtr + st.wStride * boundIfNeeded(x, st.inWidth);
+        PRAGMA_OMP_SIMD
+        for (sd::LongType c = 0; c < numChannels; ++c) sumY[c] += static_cast<float>(ptr[c]);
+      }
+      scaleX = xCache.endMinusOneScale;
+      ptr = yScaleCache[i].yPtr + st.wStride * boundIfNeeded(xCache.end - 1, st.inWidth);
+      PRAGMA_OMP_SIMD
+      for (sd::LongType c = 0; c < numChannels; ++c) sumY[c] += static_cast<float>(ptr[c]) * scaleX;
+    }
+
+    float yScale = yScaleCache[i].yScale;
+    PRAGMA_OMP_SIMD
+    for (sd::LongType c = 0; c < numChannels; ++c) outputPtr[c] += sumY[c] * yScale;
+  }
+
+  PRAGMA_OMP_SIMD
+  for (sd::LongType c = 0; c < numChannels; ++c) outputPtr[c] *= scale;
+}
+
+template <typename T>
+static void resizeArea(ImageResizerState const& st, ResizePlan const& plan, NDArray * input, NDArray* output) {
   T const* inputPtr = input->bufferAsT<T>();
   float scale = 1.f / (st.heightScale * st.widthScale);
   auto outputPtr = output->bufferAsT<float>();  // output is always float. TO DO: provide another float types also with
                                                 // template <typename X, typename Z> declaration
+  auto const& caches = plan.xCached;
+  bool const vectorized = st.channels != 3 && st.cStride == 1;
 
   auto batchProcess = PRAGMA_THREADS_FOR {
-    for (auto batch = start; batch < stop; batch++) {
-      for (auto y = 0; y < st.outHeight; ++y) {
-        const float inY = y * st.heightScale;
-        const float inY1 = (y + 1) * st.heightScale;
-        // The start and end height indices of all the cells that could
-        // contribute to the target cell.
-        const sd::LongType yStart = math::sd_floor<float, sd::LongType>(inY);
-        const sd::LongType yEnd = math::sd_ceil<float, sd::LongType>(inY1);
-
-        std::vector<ScaleCache<T>> yCaches;
-        auto cacheLen = yEnd - yStart;
-        if (cacheLen) {
-          yCaches.resize(cacheLen);
-        };
-        ScaleCache<T>* yCachesPtr = yCaches.data();
-        sd::LongType yCachesSize = yCaches.size();
-        for (auto i = yStart, k = 0LL; i < yEnd; ++i, ++k) {
-          ScaleCache<T> scaleCache;
-          if (i < inY) {
-            scaleCache.yScale = (i + 1 > inY1 ? st.heightScale : i + 1 - inY);
-          } else {
-            scaleCache.yScale = (i + 1 > inY1 ? inY1 - i : 1.0);
-          }
-          scaleCache.yPtr = inputPtr + (batch * st.bStride + bound(i, st.inHeight) * st.hStride);
-          yCaches[k] = scaleCache;
-        }
-        float* output = outputPtr + (batch * st.outHeight + y) * st.channels * st.outWidth;
+    std::vector<ScaleCache<T>> yCaches;
+    std::vector<float> sumY(vectorized ? st.channels : 0);
+    for (auto r = start; r < stop; r++) {
+      auto batch = r / st.outHeight;
+      auto y = r % st.outHeight;
+      // The start and end height indices of all the cells that could
+      // contribute to the target cell, with their scales, come from the plan
+      auto const& row = plan.areaRows[y];
+      yCaches.resize(row.end - row.start);
+      ScaleCache<T>* yCachesPtr = yCaches.data();
+      sd::LongType yCachesSize = yCaches.size();
+      for (auto i = row.start, k = 0LL; i < row.end; ++i, ++k) {
+        yCaches[k].yScale = plan.areaScales[row.scalesOffset + k];
+        yCaches[k].yPtr = inputPtr + (batch * st.bStride + bound(i, st.inHeight) * st.hStride);
+      }
+      float* output = outputPtr + r * st.channels * st.outWidth;
 
-        if (st.channels == 3) {
-          for (sd::LongType x = 0; x < st.outWidth; ++x) {
-            const CachedInterpolation& xCache = caches[x];
-            computePatchSumOf3Channels<T>(scale, st, yCachesPtr, yCachesSize, xCache, output);
-            output += st.channels;
-          }
-        } else {
-          for (sd::LongType x = 0; x < st.outWidth; ++x) {
-            const CachedInterpolation& xCache = caches[x];
-            computePatchSum<T>(scale, st, yCachesPtr, yCachesSize, xCache, output);
-            output += st.channels;
-          }
+      if (st.channels == 3) {
+        for (sd::LongType x = 0; x < st.outWidth; ++x) {
+          const CachedInterpolation& xCache = caches[x];
+          computePatchSumOf3Channels<T>(scale, st, yCachesPtr, yCachesSize, xCache, output);
+          output += st.channels;
+        }
+      } else if (vectorized) {
+        for (sd::LongType x = 0; x < st.outWidth; ++x) {
+          computePatchSumVectorized<T>(scale, st, yCachesPtr, yCachesSize, caches[x], sumY.data(), output);
+          output += st.channels;
+        }
+      } else {
+        for (sd::LongType x = 0; x < st.outWidth; ++x) {
+          const CachedInterpolation& xCache = caches[x];
+          computePatchSum<T>(scale, st, yCachesPtr, yCachesSize, xCache, output);
+          output += st.channels;
         }
       }
     }
   };
-  samediff::Threads::parallel_tad(batchProcess, 0, st.batchSize, 1);
+  samediff::Threads::parallel_tad(batchProcess, 0, st.batchSize * st.outHeight, 1,
+                                  Environment::getInstance().maxMasterThreads());
 }
 
 template <typename X>
@@ -597,10 +748,18 @@ sd::Status resizeAreaFunctor_(sd::LaunchContext* context, NDArray * image, int c
   ImageResizerState st(alignCorners, false);  // Create resize info
   auto res = st.validateAndCalculateOutputSize(image, width, height);
   if (Status::OK == res) {
-    std::vector<CachedInterpolation> xCached(st.outWidth);
-    auto cachingProcedure = PRAGMA_THREADS_FOR {
-      for (auto x = start; x < stop; x++) {
-        auto& xCache = xCached[x];
+    ResizePlanKey key;
+    key.method = kResizeArea;
+    key.alignCorners = alignCorners;
+    key.inHeight = st.inHeight;
+    key.inWidth = st.inWidth;
+    key.outHeight = st.outHeight;
+    key.outWidth = st.outWidth;
+
+    auto plan = ResizePlanCache::getInstance().plan(key, [&](ResizePlan& p) {
+      p.xCached.resize(st.outWidth);
+      for (sd::LongType x = 0; x < st.outWidth; x++) {
+        auto& xCache = p.xCached[x];
         const float inX = x * st.widthScale;
         const float inX1 = (x + 1) * st.widthScale;
 
@@ -614,10 +773,25 @@ sd::Status resizeAreaFunctor_(sd::LaunchContext* context, NDArray * image, int c
         xCache.needsBounding =
             bound(xCache.start, st.inWidth) != xCache.start || bound(xCache.end - 1, st.inWidth) != (xCache.end - 1);
       }
-    };
-    samediff::Threads::parallel_for(cachingProcedure, 0, xCached.size(), 1);
 
-    resizeArea<X>(st, xCached, image, output);
+      p.areaRows.resize(st.outHeight);
+      for (sd::LongType y = 0; y < st.outHeight; ++y) {
+        const float inY = y * st.heightScale;
+        const float inY1 = (y + 1) * st.heightScale;
+        auto& row = p.areaRows[y];
+        row.start = math::sd_floor<float, sd::LongType>(inY);
+        row.end = math::sd_ceil<float, sd::LongType>(inY1);
+        row.scalesOffset = p.areaScales.size();
+        for (auto i = row.start; i < row.end; ++i) {
+          if (i < inY)
+            p.areaScales.push_back(i + 1 > inY1 ? st.heightScale : i + 1 - inY);
+          else
+            p.areaScales.push_back(i + 1 > inY1 ? inY1 - i : 1.0);
+        }
+      }
+    });
+
+    resizeArea<X>(st, *plan, image, output);
   }
   return res;
 }
@@ -21,6 +21,7 @@
 //
 #include <execution/Threads.h>
 #include <helpers/ShapeUtils.h>
+#include <math/templatemath.h>
 #include <ops/declarable/helpers/scatter.h>
 
 #include <numeric>
@@ -72,6 +73,53 @@ sd::LongType checkIndices(sd::LaunchContext* context, NDArray& indices, NDArray&
   BUILD_SINGLE_SELECTOR(indices.dataType(), return checkIndices_, (indices, output, axis), SD_INDEXING_TYPES);
 }
 
+///////////////////////////////////////////////////////////////////
+// applies updates [0, numUpdates). If indices may repeat (lock == true), updates are bucketed by destination row with
+// stable counting sort, so every row is owned by single thread and its updates are applied in original order
+template <typename APPLY, typename DESTINATION>
+static void scatterUpdates(APPLY apply, DESTINATION destination, const sd::LongType numUpdates, const bool lock) {
+  const sd::LongType maxThreads = sd::Environment::getInstance().maxThreads();
+
+  if (!lock) {
+    auto func = PRAGMA_THREADS_FOR {
+      for (auto i = start; i < stop; i++) apply(i);
+    };
+
+    samediff::Threads::parallel_tad(func, 0, numUpdates, 1, maxThreads);
+    return;
+  }
+
+  const auto numBuckets = sd::math::sd_min<sd::LongType>(maxThreads, numUpdates);
+  if (numBuckets <= 1) {
+    for (sd::LongType i = 0; i < numUpdates; i++) apply(i);
+    return;
+  }
+
+  std::vector<sd::LongType> owners(numUpdates);
+  auto ownersFunc = PRAGMA_THREADS_FOR {
+    for (auto i = start; i < stop; i++)
+      owners[i] = static_cast<sd::LongType>(static_cast<uint64_t>(destination(i)) % numBuckets);
+  };
+
+  samediff::Threads::parallel_for(ownersFunc, 0, numUpdates);
+
+  std::vector<sd::LongType> offsets(numBuckets + 1, 0);
+  for (sd::LongType i = 0; i < numUpdates; i++) offsets[owners[i] + 1]++;
+
+  for (sd::LongType b = 0; b < numBuckets; b++) offsets[b + 1] += offsets[b];
+
+  std::vector<sd::LongType> order(numUpdates);
+  std::vector<sd::LongType> cursors(offsets.begin(), offsets.end() - 1);
+  for (sd::LongType i = 0; i < numUpdates; i++) order[cursors[owners[i]]++] = i;
+
+  auto func = PRAGMA_THREADS_FOR {
+    for (auto b = start; b < stop; b++)
+      for (auto e = offsets[b]; e < offsets[b + 1]; e++) apply(order[e]);
+  };
+
+  samediff::Threads::parallel_tad(func, 0, numBuckets, 1, numBuckets);
+}
+
 ///////////////////////////////////////////////////////////////////
 void scatter(sd::LaunchContext* context, pairwise::Ops op, NDArray& indices, NDArray& updates,
              NDArray& output, const bool lock) {
@@ -80,17 +128,17 @@ void scatter(sd::LaunchContext* context, pairwise::Ops op, NDArray& indices, NDA
   const int updRank = updates.rankOf();
   const sd::LongType indLen = indices.lengthOf();
 
+  auto destination = [&](sd::LongType i) -> sd::LongType { return indices.e<sd::LongType>(i); };
+
   if (outRank == 1) {
-    auto func = PRAGMA_THREADS_FOR {
-      for (auto i = start; i < stop; i++) {
-        sd::LongType idx = indices.e<sd::LongType>(i);
-        NDArray out = output({idx, idx + 1});
-        NDArray updateE = updates.e(i);
-        out.applyPairwiseTransform(op, updateE);
-      }
+    auto apply = [&](sd::LongType i) {
+      sd::LongType idx = indices.e<sd::LongType>(i);
+      NDArray out = output({idx, idx + 1});
+      NDArray updateE = updates.e(i);
+      out.applyPairwiseTransform(op, updateE);
     };
 
-    samediff::Threads::parallel_tad(func, 0, indLen, 1, lock ? 1 : sd::Environment::getInstance().maxThreads());
+    scatterUpdates(apply, destination, indLen, lock);
   } else {  // outRank > 1
 
     int sizeOfDims = indRank;
@@ -99,15 +147,13 @@ void scatter(sd::LaunchContext* context, pairwise::Ops op, NDArray& indices, NDA
     std::vector<sd::LongType > dimsToExcludeUpd(sizeOfDims);
     std::iota(dimsToExcludeUpd.begin(), dimsToExcludeUpd.end(), 0);
 
-    auto func = PRAGMA_THREADS_FOR {
-      for (auto i = start; i < stop; i++) {
-        NDArray outSubArr = output(indices.e<sd::LongType>(i), std::vector<sd::LongType >({0}));
-        NDArray updSubArr = updates(i, dimsToExcludeUpd);
-        outSubArr.applyPairwiseTransform(op, updSubArr);
-      }
+    auto apply = [&](sd::LongType i) {
+      NDArray outSubArr = output(indices.e<sd::LongType>(i), std::vector<sd::LongType >({0}));
+      NDArray updSubArr = updates(i, dimsToExcludeUpd);
+      outSubArr.applyPairwiseTransform(op, updSubArr);
     };
 
-    samediff::Threads::parallel_tad(func, 0, indLen, 1, lock ? 1 : sd::Environment::getInstance().maxThreads());
+    scatterUpdates(apply, destination, indLen, lock);
   }
 }
 
@@ -120,41 +166,45 @@ void scatterND(sd::LaunchContext* context, pairwise::Ops op, NDArray& indices, N
   const sd::LongType indLastDim = indices.sizeAt(-1);
 
   if (outRank == 1) {
-    auto func = PRAGMA_THREADS_FOR {
-      for (auto i = start; i < stop; i++) {
-        sd::LongType idx = indices.e<sd::LongType>(i);
-        NDArray out = output({idx, idx + 1});
-        NDArray updatesE = updates.e(i);
-        out.applyPairwiseTransform(op, updatesE, nullptr);
-      }
+    auto apply = [&](sd::LongType i) {
+      sd::LongType idx = indices.e<sd::LongType>(i);
+      NDArray out = output({idx, idx + 1});
+      NDArray updatesE = updates.e(i);
+      out.applyPairwiseTransform(op, updatesE, nullptr);
     };
+    auto destination = [&](sd::LongType i) -> sd::LongType { return indices.e<sd::LongType>(i); };
 
-    samediff::Threads::parallel_tad(func, 0, indLen, 1, lock ? 1 : sd::Environment::getInstance().maxThreads());
+    scatterUpdates(apply, destination, indLen, lock);
   } else {
     std::vector<sd::LongType> dims = {indRank - 1};
     std::vector<sd::LongType > *dimsToExcludeInd = ShapeUtils::evalDimsToExclude(indRank, dims.size(),dims.data());
     std::vector<sd::LongType > dimsToExcludeUpd(indRank - 1);
     std::iota(dimsToExcludeUpd.begin(), dimsToExcludeUpd.end(), 0);
 
-    auto func = PRAGMA_THREADS_FOR {
+    auto apply = [&](sd::LongType i) {
       std::vector<sd::LongType> idxRangeOut(2 * outRank, 0);
+      NDArray indSubArr = indices(i, *dimsToExcludeInd);
+      for (sd::LongType j = 0; j < indLastDim; ++j) {
+        idxRangeOut[2 * j] = indSubArr.e<sd::LongType>(j);
+        idxRangeOut[2 * j + 1] = idxRangeOut[2 * j] + 1;
+      }
 
-      for (auto i = start; i < stop; i++) {
-        NDArray indSubArr = indices(i, *dimsToExcludeInd);
-        for (sd::LongType j = 0; j < indLastDim; ++j) {
-          idxRangeOut[2 * j] = indSubArr.e<sd::LongType>(j);
-          idxRangeOut[2 * j + 1] = idxRangeOut[2 * j] + 1;
-        }
+      NDArray outSubArr = output(idxRangeOut);
+      NDArray updSubArr = updates(i, dimsToExcludeUpd);
+
+      outSubArr.applyPairwiseTransform(op, updSubArr);
+    };
 
-        NDArray outSubArr = output(idxRangeOut);
-        NDArray updSubArr = updates(i, dimsToExcludeUpd);
+    // destination row is linear index over first indLastDim dimensions of output
+    auto destination = [&](sd::LongType i) -> sd::LongType {
+      sd::LongType row = 0;
+      for (sd::LongType j = 0; j < indLastDim; ++j)
+        row = row * output.sizeAt(j) + indices.e<sd::LongType>(i * indLastDim + j);
 
-        outSubArr.applyPairwiseTransform(op, updSubArr);
-      }
+      return row;
     };
 
-    samediff::Threads::parallel_tad(func, 0, indLen / indLastDim, 1,
-                                    lock ? 1 : sd::Environment::getInstance().maxThreads());
+    scatterUpdates(apply, destination, indLen / indLastDim, lock);
 
     delete dimsToExcludeInd;
   }
@@ -23,6 +23,7 @@
 #include <execution/Threads.h>
 #include <helpers/ConstantTadHelper.h>
 #include <helpers/ShapeUtils.h>
+#include <math/vectormath.h>
 #include <ops/declarable/helpers/activations.h>
 
 #include <numeric>
@@ -48,7 +49,7 @@ static void softMaxForVector_(void const* input, sd::LongType const* inShapeInfo
       for (int i = 0; i < length; i++) max = sd::math::sd_max<T>(max, inBuff[i]);
 
       for (int i = 0; i < length; i++) {
-        outBuff[i] = sd::math::sd_exp<T, T>(inBuff[i] - max);
+        outBuff[i] = sd::math::vec::exp<T>(inBuff[i] - max);
         sum += outBuff[i];
       }
 
@@ -57,7 +58,7 @@ static void softMaxForVector_(void const* input, sd::LongType const* inShapeInfo
       for (int i = 0; i < length; i++) max = sd::math::sd_max<T>(max, inBuff[i * inEWS]);
 
       for (int i = 0; i < length; i++) {
-        T r = sd::math::sd_exp<T, T>(inBuff[i * inEWS] - max);
+        T r = sd::math::vec::exp<T>(inBuff[i * inEWS] - max);
         outBuff[i * outEWS] = r;
         sum += r;
       }
@@ -97,7 +98,7 @@ SD_INLINE void softmax_loop(const float* input, float* output, const sd::LongTyp
 
 #pragma omp simd reduction(+ : sum)
     for (sd::LongType j = 0; j < tadLen; ++j) {
-      float temp = sd::math::sd_exp<float, float>(inBuff[j] - max);
+      float temp = sd::math::vec::exp<float>(inBuff[j] - max);
       outBuff[j] = temp;
       sum += temp;
     }
@@ -120,7 +121,7 @@ SD_INLINE void softmax_loop(const float* input, float* output, const sd::LongTyp
       for (sd::LongType j = 0; j < tadLen; ++j) max = sd::math::sd_max<float>(max, inBuff[j]);
 
       for (sd::LongType j = 0; j < tadLen; ++j) {
-        float temp = sd::math::sd_exp<float, float>(inBuff[j] - max);
+        float temp = sd::math::vec::exp<float>(inBuff[j] - max);
         outBuff[j] = temp;
         sum += temp;
       }
@@ -147,7 +148,7 @@ SD_INLINE void softmax_loop(const T* input, T* output, const sd::LongType* offse
 
       for (sd::LongType j = 0; j < tadLen; ++j) max = sd::math::sd_max<T>(max, inBuff[j]);
       for (sd::LongType j = 0; j < tadLen; ++j) {
-        T temp = sd::math::sd_exp<T, T>(inBuff[j] - max);
+        T temp = sd::math::vec::exp<T>(inBuff[j] - max);
         outBuff[j] = temp;
         sum += temp;
       }
@@ -200,7 +201,7 @@ static void softmax_(sd::LaunchContext* context, NDArray& input, NDArray& output
           for (sd::LongType j = 0; j < tadLen; ++j) max = sd::math::sd_max<T>(max, inBuff[offsets[j]]);
 
           for (sd::LongType j = 0; j < tadLen; ++j) {
-            T temp = sd::math::sd_exp<T, T>(inBuff[offsets[j]] - max);
+            T temp = sd::math::vec::exp<T>(inBuff[offsets[j]] - max);
             outBuff[offsets[j]] = temp;
             sum += temp;
           }
@@ -733,6 +733,15 @@ void thresholdReluDerivative(LaunchContext *context, NDArray *input, double thre
   BUILD_SINGLE_SELECTOR(input->dataType(), thresholdReluDerivative_, (input, threshold, dLdO, output), SD_FLOAT_TYPES);
 }
 
+///////////////////////////////////////////////////////////////////
+// approximate mode is CPU only, device activations keep exact transforms
+bool isApproximateActivationSupported(NDArray &input, NDArray &output) { return false; }
+
+void approximateActivation(LaunchContext *context, ApproximateActivation activation, NDArray &input,
+                           NDArray &output) {
+  THROW_EXCEPTION("approximateActivation: approximate mode isn't implemented for CUDA");
+}
+
 }  // namespace helpers
 }  // namespace ops
 }  // namespace sd
@@ -0,0 +1,62 @@
+/* ******************************************************************************
+ *
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ *  See the NOTICE file distributed with this work for additional
+ *  information regarding copyright ownership.
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ******************************************************************************/
+
+//
+// Fused image preprocessing: crop, bilinear resize, normalization, channel swap, layout change and cast in one pass
+//
+
+#ifndef LIBND4J_HELPERS_IMAGE_PREPROCESS_H
+#define LIBND4J_HELPERS_IMAGE_PREPROCESS_H
+#include <array/NDArray.h>
+#include <system/op_boilerplate.h>
+
+namespace sd {
+namespace ops {
+namespace helpers {
+
+struct ImagePreprocessParams {
+  // crop window within input image, resize maps it onto the whole output
+  LongType cropY = 0;
+  LongType cropX = 0;
+  LongType cropHeight = 0;
+  LongType cropWidth = 0;
+  // output is [batch, channels, height, width] instead of [batch, height, width, channels]
+  bool channelsFirst = false;
+  // channels are written in reverse order, i.e. RGB <-> BGR
+  bool reverseChannels = false;
+  bool halfPixelCenters = true;
+  // input is multiplied by scale before mean is subtracted
+  double scale = 1.0;
+};
+
+/**
+ * This method resizes crop window of NHWC images with bilinear interpolation and writes
+ * (scale * pixel - mean[c]) / std[c] to output. Output rows are processed independently, horizontally interpolated
+ * input rows are kept in per-thread buffers and reused while consecutive output rows read the same input rows.
+ *
+ * input - [batch, height, width, channels], c-order contiguous
+ * mean, std - vectors of length channels, may be null
+ * output - [batch, outHeight, outWidth, channels] or [batch, channels, outHeight, outWidth], c-order contiguous
+ */
+SD_LIB_HIDDEN void imagePreprocess(LaunchContext* context, NDArray* input, NDArray* mean, NDArray* std,
+                                   const ImagePreprocessParams& params, NDArray* output);
+
+}  // namespace helpers
+}  // namespace ops
+}  // namespace sd
+#endif
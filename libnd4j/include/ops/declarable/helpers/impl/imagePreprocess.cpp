@@ -0,0 +1,181 @@
+/* ******************************************************************************
+ *
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ *  See the NOTICE file distributed with this work for additional
+ *  information regarding copyright ownership.
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ******************************************************************************/
+
+//
+// Fused image preprocessing: crop, bilinear resize, normalization, channel swap, layout change and cast in one pass
+//
+#include <execution/Threads.h>
+#include <math/templatemath.h>
+#include <ops/declarable/helpers/imagePreprocess.h>
+
+#include <type_traits>
+#include <vector>
+
+namespace sd {
+namespace ops {
+namespace helpers {
+
+// neighbour indices and weight of right (or lower) neighbour for one output coordinate
+struct PreprocessWeight {
+  LongType first;
+  LongType second;
+  float lerp;
+};
+
+static std::vector<PreprocessWeight> preprocessWeights(LongType outSize, LongType cropStart, LongType cropSize,
+                                                       LongType multiplier, bool halfPixelCenters) {
+  std::vector<PreprocessWeight> weights(outSize);
+  const double scale = cropSize / static_cast<double>(outSize);
+  for (LongType i = 0; i < outSize; i++) {
+    const double in = halfPixelCenters ? (i + 0.5) * scale - 0.5 : i * scale;
+    const double inFloor = math::sd_floor<double, double>(in);
+    const LongType first = math::sd_max<LongType>(static_cast<LongType>(inFloor), 0);
+    const LongType second = math::sd_min<LongType>(static_cast<LongType>(math::sd_ceil<double, double>(in)), cropSize - 1);
+    weights[i].first = (cropStart + math::sd_min<LongType>(first, cropSize - 1)) * multiplier;
+    weights[i].second = (cropStart + math::sd_max<LongType>(second, 0)) * multiplier;
+    weights[i].lerp = static_cast<float>(in - inFloor);
+  }
+  return weights;
+}
+
+template <typename X, typename Z>
+static void imagePreprocess_(NDArray* input, NDArray* mean, NDArray* std, const ImagePreprocessParams& params,
+                             NDArray* output) {
+  // double output is computed in double, everything else in float
+  using Acc = typename std::conditional<std::is_same<Z, double>::value, double, float>::type;
+
+  const LongType batchSize = input->sizeAt(0);
+  const LongType inHeight = input->sizeAt(1);
+  const LongType inWidth = input->sizeAt(2);
+  const LongType channels = input->sizeAt(3);
+  const LongType outHeight = output->sizeAt(params.channelsFirst ? 2 : 1);
+  const LongType outWidth = output->sizeAt(params.channelsFirst ? 3 : 2);
+  const LongType outRowSize = outWidth * channels;
+  const LongType outPlane = outHeight * outWidth;
+
+  // per output channel: (scale * x - mean) / std == x * alpha + beta
+  std::vector<Acc> alpha(channels);
+  std::vector<Acc> beta(channels);
+  for (LongType c = 0; c < channels; c++) {
+    const Acc m = mean != nullptr ? mean->e<Acc>(c) : Acc(0);
+    const Acc s = std != nullptr ? std->e<Acc>(c) : Acc(1);
+    alpha[c] = static_cast<Acc>(params.scale) / s;
+    beta[c] = -m / s;
+  }
+
+  auto xs = preprocessWeights(outWidth, params.cropX, params.cropWidth, channels, params.halfPixelCenters);
+  auto ys = preprocessWeights(outHeight, params.cropY, params.cropHeight, 1, params.halfPixelCenters);
+
+  const X* inputBuf = input->bufferAsT<X>();
+  Z* outputBuf = output->bufferAsT<Z>();
+  const LongType inRowSize = inWidth * channels;
+  const LongType inImageSize = inHeight * inRowSize;
+
+  auto interpolateRow = [&](const X* inputRow, Acc* row) {
+    for (LongType x = 0; x < outWidth; x++) {
+      auto left = inputRow + xs[x].first;
+      auto right = inputRow + xs[x].second;
+      const Acc lerp = xs[x].lerp;
+      auto pRow = row + x * channels;
+      PRAGMA_OMP_SIMD
+      for (LongType c = 0; c < channels; c++) {
+        const Acc l = static_cast<Acc>(left[c]);
+        const Acc r = static_cast<Acc>(right[c]);
+        pRow[c] = l + (r - l) * lerp;
+      }
+    }
+  };
+
+  auto func = PRAGMA_THREADS_FOR {
+    std::vector<Acc> top(outRowSize);
+    std::vector<Acc> bottom(outRowSize);
+    std::vector<Acc> blended(outRowSize);
+    LongType topRow = -1;
+    LongType bottomRow = -1;
+
+    for (auto r = start; r < stop; r++) {
+      const LongType b = r / outHeight;
+      const LongType y = r % outHeight;
+      const X* image = inputBuf + b * inImageSize;
+      const LongType upper = b * inHeight + ys[y].first;
+      const LongType lower = b * inHeight + ys[y].second;
+
+      if (upper != topRow) {
+        if (upper == bottomRow) {
+          std::swap(top, bottom);
+          std::swap(topRow, bottomRow);
+        } else {
+          interpolateRow(image + ys[y].first * inRowSize, top.data());
+          topRow = upper;
+        }
+      }
+
+      if (lower != bottomRow) {
+        if (lower == topRow)
+          bottom = top;
+        else
+          interpolateRow(image + ys[y].second * inRowSize, bottom.data());
+        bottomRow = lower;
+      }
+
+      const Acc lerp = ys[y].lerp;
+      auto pTop = top.data();
+      auto pBottom = bottom.data();
+      auto pBlended = blended.data();
+      PRAGMA_OMP_SIMD
+      for (LongType i = 0; i < outRowSize; i++) pBlended[i] = pTop[i] + (pBottom[i] - pTop[i]) * lerp;
+
+      if (params.channelsFirst) {
+        for (LongType c = 0; c < channels; c++) {
+          const LongType oc = params.reverseChannels ? channels - 1 - c : c;
+          const Acc a = alpha[oc];
+          const Acc s = beta[oc];
+          auto pOutput = outputBuf + (b * channels + oc) * outPlane + y * outWidth;
+          PRAGMA_OMP_SIMD
+          for (LongType x = 0; x < outWidth; x++) pOutput[x] = static_cast<Z>(pBlended[x * channels + c] * a + s);
+        }
+      } else {
+        auto pOutput = outputBuf + r * outRowSize;
+        for (LongType x = 0; x < outWidth; x++) {
+          auto pPixel = pBlended + x * channels;
+          auto pOutPixel = pOutput + x * channels;
+          for (LongType c = 0; c < channels; c++) {
+            const LongType oc = params.reverseChannels ? channels - 1 - c : c;
+            pOutPixel[oc] = static_cast<Z>(pPixel[c] * alpha[oc] + beta[oc]);
+          }
+        }
+      }
+    }
+  };
+  // every output row resizes, normalizes and transposes whole row of pixels, so rows are split evenly between threads
+  samediff::Threads::parallel_tad(func, 0, batchSize * outHeight, 1, Environment::getInstance().maxMasterThreads());
+}
+
+void imagePreprocess(LaunchContext* context, NDArray* input, NDArray* mean, NDArray* std,
+                     const ImagePreprocessParams& params, NDArray* output) {
+  NDArray::preparePrimaryUse({output}, {input, mean, std});
+
+  BUILD_DOUBLE_SELECTOR(input->dataType(), output->dataType(), imagePreprocess_,
+                        (input, mean, std, params, output), SD_NUMERIC_TYPES, SD_FLOAT_TYPES);
+
+  NDArray::registerPrimaryUse({output}, {input, mean, std});
+}
+
+}  // namespace helpers
+}  // namespace ops
+}  // namespace sd
@@ -0,0 +1,111 @@
+/* ******************************************************************************
+ *
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ *  See the NOTICE file distributed with this work for additional
+ *  information regarding copyright ownership.
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ******************************************************************************/
+
+//
+// Indexed slices: sparse gradients represented as row ids plus value rows
+//
+#include <system/op_boilerplate.h>
+
+#if NOT_EXCLUDED(OP_indexed_slices_aggregate)
+#include <execution/Threads.h>
+#include <ops/declarable/helpers/indexedSlices.h>
+
+#include <algorithm>
+#include <numeric>
+#include <vector>
+
+namespace sd {
+namespace ops {
+namespace helpers {
+
+LongType indexedSlicesCount(LaunchContext* context, NDArray* indices) {
+  NDArray::preparePrimaryUse({}, {indices});
+  auto ids = indices->asVectorT<LongType>();
+  NDArray::registerPrimaryUse({}, {indices});
+
+  std::sort(ids.begin(), ids.end());
+  return static_cast<LongType>(std::unique(ids.begin(), ids.end()) - ids.begin());
+}
+
+template <typename T>
+static void indexedSlicesAggregate_(NDArray* indices, NDArray* values, NDArray* uniqueIndices, NDArray* aggregated) {
+  auto ids = indices->asVectorT<LongType>();
+  const auto numSlices = static_cast<LongType>(ids.size());
+  const auto rowLength = values->lengthOf() / numSlices;
+
+  // positions sorted by row id, stable sort keeps original order of duplicates, so sums are deterministic
+  std::vector<LongType> order(numSlices);
+  std::iota(order.begin(), order.end(), 0);
+  std::stable_sort(order.begin(), order.end(), [&ids](LongType a, LongType b) { return ids[a] < ids[b]; });
+
+  std::vector<LongType> groups;
+  for (LongType e = 0; e < numSlices; e++)
+    if (e == 0 || ids[order[e]] != ids[order[e - 1]]) groups.emplace_back(e);
+
+  const auto numUnique = static_cast<LongType>(groups.size());
+  groups.emplace_back(numSlices);
+
+  if (uniqueIndices->lengthOf() != numUnique || aggregated->lengthOf() != numUnique * rowLength)
+    THROW_EXCEPTION("indexedSlicesAggregate: output shapes don't match number of unique indices");
+
+  if (uniqueIndices->ews() != 1 || aggregated->ews() != 1 || aggregated->ordering() != 'c')
+    THROW_EXCEPTION("indexedSlicesAggregate: outputs must be contiguous c-order arrays");
+
+  auto contiguous = values->ews() == 1 && values->ordering() == 'c';
+  NDArray copy = contiguous ? NDArray() : values->dup('c');
+
+  const T* x = contiguous ? values->bufferAsT<T>() : copy.bufferAsT<T>();
+  T* z = aggregated->bufferAsT<T>();
+  auto u = uniqueIndices->bufferAsT<LongType>();
+
+  auto func = PRAGMA_THREADS_FOR {
+    for (auto g = start; g < stop; g++) {
+      auto zRow = z + g * rowLength;
+      auto first = x + order[groups[g]] * rowLength;
+      for (LongType c = 0; c < rowLength; c++) zRow[c] = first[c];
+
+      for (auto e = groups[g] + 1; e < groups[g + 1]; e++) {
+        auto xRow = x + order[e] * rowLength;
+        for (LongType c = 0; c < rowLength; c++) zRow[c] += xRow[c];
+      }
+
+      u[g] = ids[order[groups[g]]];
+    }
+  };
+
+  // one row per group, so groups are split between threads evenly
+  samediff::Threads::parallel_tad(
+      func, 0, numUnique, 1,
+      samediff::ThreadsHelper::numberOfThreadsTad(Environment::getInstance().maxMasterThreads(), numUnique,
+                                                  values->lengthOf(), samediff::OpCostClass::ELEMENTWISE));
+}
+
+void indexedSlicesAggregate(LaunchContext* context, NDArray* indices, NDArray* values, NDArray* uniqueIndices,
+                            NDArray* aggregated) {
+  NDArray::preparePrimaryUse({uniqueIndices, aggregated}, {indices, values});
+
+  BUILD_SINGLE_SELECTOR(values->dataType(), indexedSlicesAggregate_, (indices, values, uniqueIndices, aggregated),
+                        SD_FLOAT_TYPES);
+
+  NDArray::registerPrimaryUse({uniqueIndices, aggregated}, {indices, values});
+}
+
+}  // namespace helpers
+}  // namespace ops
+}  // namespace sd
+#endif
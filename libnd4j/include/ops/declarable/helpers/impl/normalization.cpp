@@ -0,0 +1,641 @@
+/* ******************************************************************************
+ *
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ *  See the NOTICE file distributed with this work for additional
+ *  information regarding copyright ownership.
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ******************************************************************************/
+
+//
+// Fused batch and layer normalization kernels: statistics in one pass, normalization in another
+//
+#include <execution/Threads.h>
+#include <math/templatemath.h>
+#include <ops/declarable/helpers/normalization.h>
+
+#include <type_traits>
+
+namespace sd {
+namespace ops {
+namespace helpers {
+
+// elements processed at once while computing statistics, block stays in L1/L2 for its second read
+static const LongType kBlockLength = 4096;
+
+// number of independent partial results, fixed so results don't depend on number of threads
+static const LongType kMaxGroups = 128;
+
+// half types are accumulated in float
+template <typename T>
+using NormAcc = typename std::conditional<std::is_same<T, double>::value, double, float>::type;
+
+// count, mean and sum of squared deviations, merged with Chan et al. formula
+template <typename A>
+struct Moments {
+  LongType count = 0;
+  A mean = static_cast<A>(0);
+  A m2 = static_cast<A>(0);
+
+  void merge(LongType n, A blockMean, A blockM2) {
+    if (n == 0) return;
+
+    const auto total = count + n;
+    const A delta = blockMean - mean;
+    mean += delta * static_cast<A>(n) / static_cast<A>(total);
+    m2 += blockM2 + delta * delta * static_cast<A>(count) * static_cast<A>(n) / static_cast<A>(total);
+    count = total;
+  }
+
+  void merge(const Moments<A>& other) { merge(other.count, other.mean, other.m2); }
+
+  A variance() const { return count > 0 ? m2 / static_cast<A>(count) : static_cast<A>(0); }
+};
+
+// contiguous segment is split into cache-resident blocks, each block gets exact two-pass moments before merging
+template <typename T, typename A>
+static void segmentMoments(const T* x, LongType length, Moments<A>& moments) {
+  for (LongType b = 0; b < length; b += kBlockLength) {
+    const auto n = sd::math::sd_min<LongType>(kBlockLength, length - b);
+    const auto block = x + b;
+
+    A sum = static_cast<A>(0);
+    PRAGMA_OMP_SIMD_ARGS(reduction(+ : sum))
+    for (LongType i = 0; i < n; i++) sum += static_cast<A>(block[i]);
+
+    const A blockMean = sum / static_cast<A>(n);
+    A m2 = static_cast<A>(0);
+    PRAGMA_OMP_SIMD_ARGS(reduction(+ : m2))
+    for (LongType i = 0; i < n; i++) {
+      const A d = static_cast<A>(block[i]) - blockMean;
+      m2 += d * d;
+    }
+
+    moments.merge(n, blockMean, m2);
+  }
+}
+
+// array is viewed as [outer, C, inner], where C is size of channel dimension
+static void channelView(NDArray* input, int channelAxis, LongType& outer, LongType& numChannels, LongType& inner) {
+  outer = 1;
+  inner = 1;
+  for (int e = 0; e < channelAxis; e++) outer *= input->sizeAt(e);
+  for (int e = channelAxis + 1; e < input->rankOf(); e++) inner *= input->sizeAt(e);
+  numChannels = input->sizeAt(channelAxis);
+}
+
+static LongType numGroups(LongType length) { return sd::math::sd_min<LongType>(length, kMaxGroups); }
+
+static LongType groupStart(LongType group, LongType groups, LongType length) { return group * length / groups; }
+
+// loops over groups or rows, each task covers many elements, so threads are picked by total length rather than by
+// number of tasks
+static int numThreads(LongType numTasks, LongType numElements, samediff::OpCostClass costClass) {
+  return samediff::ThreadsHelper::numberOfThreadsTad(Environment::getInstance().maxMasterThreads(), numTasks,
+                                                     numElements, costClass);
+}
+
+//////////////////////////////////////////////////////////////////////////
+template <typename T>
+static void channelMoments_(const T* x, LongType outer, LongType C, LongType inner, NormAcc<T>* mean,
+                            NormAcc<T>* variance) {
+  using A = NormAcc<T>;
+  const auto groups = numGroups(outer);
+  std::vector<Moments<A>> partials(groups * C);
+
+  if (inner > 1) {
+    // channels-first: every (row, channel) pair is contiguous plane
+    auto func = PRAGMA_THREADS_FOR {
+      for (auto t = start; t < stop; t++) {
+        const auto g = t / C;
+        const auto c = t % C;
+        for (auto o = groupStart(g, groups, outer); o < groupStart(g + 1, groups, outer); o++)
+          segmentMoments(x + (o * C + c) * inner, inner, partials[t]);
+      }
+    };
+
+    samediff::Threads::parallel_for(func, 0, groups * C);
+  } else {
+    // channels-last: rows of C values, blocks of rows are reduced for all channels at once
+    const auto rowsPerBlock = sd::math::sd_max<LongType>(1, kBlockLength / C);
+
+    auto func = PRAGMA_THREADS_FOR {
+      std::vector<A> sum(C), m2(C);
+      for (auto g = start; g < stop; g++) {
+        const auto last = groupStart(g + 1, groups, outer);
+        for (auto r = groupStart(g, groups, outer); r < last; r += rowsPerBlock) {
+          const auto n = sd::math::sd_min<LongType>(rowsPerBlock, last - r);
+          std::fill(sum.begin(), sum.end(), static_cast<A>(0));
+          std::fill(m2.begin(), m2.end(), static_cast<A>(0));
+
+          for (LongType i = 0; i < n; i++) {
+            const auto row = x + (r + i) * C;
+            PRAGMA_OMP_SIMD
+            for (LongType c = 0; c < C; c++) sum[c] += static_cast<A>(row[c]);
+          }
+
+          for (LongType c = 0; c < C; c++) sum[c] /= static_cast<A>(n);
+
+          for (LongType i = 0; i < n; i++) {
+            const auto row = x + (r + i) * C;
+            PRAGMA_OMP_SIMD
+            for (LongType c = 0; c < C; c++) {
+              const A d = static_cast<A>(row[c]) - sum[c];
+              m2[c] += d * d;
+            }
+          }
+
+          for (LongType c = 0; c < C; c++) partials[g * C + c].merge(n, sum[c], m2[c]);
+        }
+      }
+    };
+
+    samediff::Threads::parallel_tad(func, 0, groups, 1,
+                                    numThreads(groups, outer * C, samediff::OpCostClass::REDUCTION));
+  }
+
+  auto merge = PRAGMA_THREADS_FOR {
+    for (auto c = start; c < stop; c++) {
+      Moments<A> total;
+      for (LongType g = 0; g < groups; g++) total.merge(partials[g * C + c]);
+
+      mean[c] = total.mean;
+      variance[c] = total.variance();
+    }
+  };
+
+  samediff::Threads::parallel_for(merge, 0, C);
+}
+
+// z = x * scale[c] + shift[c]
+template <typename T>
+static void channelAffine_(const T* x, T* z, LongType outer, LongType C, LongType inner, const NormAcc<T>* scale,
+                           const NormAcc<T>* shift) {
+  using A = NormAcc<T>;
+  if (inner > 1) {
+    auto func = PRAGMA_THREADS_FOR {
+      for (auto p = start; p < stop; p++) {
+        const auto c = p % C;
+        const A a = scale[c];
+        const A b = shift[c];
+        const auto xp = x + p * inner;
+        auto zp = z + p * inner;
+
+        PRAGMA_OMP_SIMD
+        for (LongType i = 0; i < inner; i++) zp[i] = static_cast<T>(static_cast<A>(xp[i]) * a + b);
+      }
+    };
+
+    samediff::Threads::parallel_for(func, 0, outer * C);
+  } else {
+    auto func = PRAGMA_THREADS_FOR {
+      for (auto r = start; r < stop; r++) {
+        const auto xr = x + r * C;
+        auto zr = z + r * C;
+
+        PRAGMA_OMP_SIMD
+        for (LongType c = 0; c < C; c++) zr[c] = static_cast<T>(static_cast<A>(xr[c]) * scale[c] + shift[c]);
+      }
+    };
+
+    samediff::Threads::parallel_tad(func, 0, outer, 1,
+                                    numThreads(outer, outer * C, samediff::OpCostClass::ELEMENTWISE));
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////
+template <typename T>
+static void batchnormTraining_(NDArray* input, NDArray* gamma, NDArray* beta, NDArray* output, NDArray* mean,
+                               NDArray* variance, int channelAxis, double epsilon) {
+  using A = NormAcc<T>;
+  LongType outer, C, inner;
+  channelView(input, channelAxis, outer, C, inner);
+
+  const auto g = gamma != nullptr ? gamma->bufferAsT<T>() : nullptr;
+  const auto b = beta != nullptr ? beta->bufferAsT<T>() : nullptr;
+  auto m = mean->bufferAsT<T>();
+  auto v = variance->bufferAsT<T>();
+
+  std::vector<A> means(C), variances(C);
+  channelMoments_<T>(input->bufferAsT<T>(), outer, C, inner, means.data(), variances.data());
+
+  // normalization is folded into per-channel scale and shift
+  std::vector<A> scale(C), shift(C);
+  for (LongType c = 0; c < C; c++) {
+    m[c] = static_cast<T>(means[c]);
+    v[c] = static_cast<T>(variances[c]);
+
+    scale[c] = static_cast<A>(1) / sd::math::sd_sqrt<A, A>(variances[c] + static_cast<A>(epsilon));
+    if (g != nullptr) scale[c] *= static_cast<A>(g[c]);
+
+    shift[c] = (b != nullptr ? static_cast<A>(b[c]) : static_cast<A>(0)) - means[c] * scale[c];
+  }
+
+  channelAffine_<T>(input->bufferAsT<T>(), output->bufferAsT<T>(), outer, C, inner, scale.data(), shift.data());
+}
+
+//////////////////////////////////////////////////////////////////////////
+template <typename T>
+static void batchnormBp_(NDArray* input, NDArray* mean, NDArray* variance, NDArray* gamma, NDArray* gradO,
+                         NDArray* gradI, NDArray* gradGamma, NDArray* gradBeta, int channelAxis, double epsilon) {
+  using A = NormAcc<T>;
+  LongType outer, C, inner;
+  channelView(input, channelAxis, outer, C, inner);
+
+  const auto x = input->bufferAsT<T>();
+  const auto dy = gradO->bufferAsT<T>();
+  auto dx = gradI->bufferAsT<T>();
+  const auto m = mean->bufferAsT<T>();
+  const auto v = variance->bufferAsT<T>();
+  const auto g = gamma != nullptr ? gamma->bufferAsT<T>() : nullptr;
+
+  // per channel: sum(dy), sum(dy * (x - mean)), sum(x - mean)
+  const auto groups = numGroups(outer);
+  std::vector<A> partials(groups * C * 3, static_cast<A>(0));
+
+  if (inner > 1) {
+    auto func = PRAGMA_THREADS_FOR {
+      for (auto t = start; t < stop; t++) {
+        const auto grp = t / C;
+        const auto c = t % C;
+        const A mc = static_cast<A>(m[c]);
+        A s1 = static_cast<A>(0), s2 = static_cast<A>(0), s3 = static_cast<A>(0);
+
+        for (auto o = groupStart(grp, groups, outer); o < groupStart(grp + 1, groups, outer); o++) {
+          const auto xp = x + (o * C + c) * inner;
+          const auto dyp = dy + (o * C + c) * inner;
+
+          PRAGMA_OMP_SIMD_ARGS(reduction(+ : s1, s2, s3))
+          for (LongType i = 0; i < inner; i++) {
+            const A d = static_cast<A>(xp[i]) - mc;
+            const A e = static_cast<A>(dyp[i]);
+            s1 += e;
+            s2 += e * d;
+            s3 += d;
+          }
+        }
+
+        partials[t * 3] = s1;
+        partials[t * 3 + 1] = s2;
+        partials[t * 3 + 2] = s3;
+      }
+    };
+
+    samediff::Threads::parallel_for(func, 0, groups * C);
+  } else {
+    auto func = PRAGMA_THREADS_FOR {
+      for (auto grp = start; grp < stop; grp++) {
+        auto s = partials.data() + grp * C * 3;
+        for (auto r = groupStart(grp, groups, outer); r < groupStart(grp + 1, groups, outer); r++) {
+          const auto xr = x + r * C;
+          const auto dyr = dy + r * C;
+
+          for (LongType c = 0; c < C; c++) {
+            const A d = static_cast<A>(xr[c]) - static_cast<A>(m[c]);
+            const A e = static_cast<A>(dyr[c]);
+            s[c * 3] += e;
+            s[c * 3 + 1] += e * d;
+            s[c * 3 + 2] += d;
+          }
+        }
+      }
+    };
+
+    samediff::Threads::parallel_tad(func, 0, groups, 1,
+                                    numThreads(groups, outer * C, samediff::OpCostClass::REDUCTION));
+  }
+
+  const A N = static_cast<A>(outer * inner);
+  std::vector<A> a(C), b(C), k(C);
+  for (LongType c = 0; c < C; c++) {
+    A s1 = static_cast<A>(0), s2 = static_cast<A>(0), s3 = static_cast<A>(0);
+    for (LongType grp = 0; grp < groups; grp++) {
+      s1 += partials[(grp * C + c) * 3];
+      s2 += partials[(grp * C + c) * 3 + 1];
+      s3 += partials[(grp * C + c) * 3 + 2];
+    }
+
+    const A stdInv = static_cast<A>(1) / sd::math::sd_sqrt<A, A>(static_cast<A>(v[c]) + static_cast<A>(epsilon));
+    const A gam = g != nullptr ? static_cast<A>(g[c]) : static_cast<A>(1);
+    const A mc = static_cast<A>(m[c]);
+
+    if (gradGamma != nullptr) gradGamma->bufferAsT<T>()[c] = static_cast<T>(s2 * stdInv);
+    if (gradBeta != nullptr) gradBeta->bufferAsT<T>()[c] = static_cast<T>(s1);
+
+    // gradI = gamma * (stdInv * (dy - s1/N) + dLdV * ((x - mean) - s3/N)), dLdV = -stdInv^3 * s2/N
+    const A dLdV = -stdInv * stdInv * stdInv * s2 / N;
+    a[c] = gam * stdInv;
+    b[c] = gam * dLdV;
+    k[c] = -gam * (stdInv * s1 / N + dLdV * (mc + s3 / N));
+  }
+
+  if (inner > 1) {
+    auto func = PRAGMA_THREADS_FOR {
+      for (auto p = start; p < stop; p++) {
+        const auto c = p % C;
+        const A ac = a[c], bc = b[c], kc = k[c];
+        const auto xp = x + p * inner;
+        const auto dyp = dy + p * inner;
+        auto dxp = dx + p * inner;
+
+        PRAGMA_OMP_SIMD
+        for (LongType i = 0; i < inner; i++)
+          dxp[i] = static_cast<T>(static_cast<A>(dyp[i]) * ac + static_cast<A>(xp[i]) * bc + kc);
+      }
+    };
+
+    samediff::Threads::parallel_for(func, 0, outer * C);
+  } else {
+    auto func = PRAGMA_THREADS_FOR {
+      for (auto r = start; r < stop; r++) {
+        const auto xr = x + r * C;
+        const auto dyr = dy + r * C;
+        auto dxr = dx + r * C;
+
+        PRAGMA_OMP_SIMD
+        for (LongType c = 0; c < C; c++)
+          dxr[c] = static_cast<T>(static_cast<A>(dyr[c]) * a[c] + static_cast<A>(xr[c]) * b[c] + k[c]);
+      }
+    };
+
+    samediff::Threads::parallel_tad(func, 0, outer, 1,
+                                    numThreads(outer, outer * C, samediff::OpCostClass::PAIRWISE));
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////
+// rows are trailing dimensions starting at firstAxis, channel of element with linear index i is (i / stride) % C
+struct LayerNormView {
+  LongType numRows;
+  LongType rowLength;
+  LongType numChannels;
+  LongType channelStride;
+  // channel is the last dimension and lies within row: row is blocks of numChannels elements, element at position
+  // pos of block belongs to channel pos
+  bool channelsLast;
+
+  LayerNormView(NDArray* input, int firstAxis, int channelAxis) {
+    rowLength = 1;
+    for (int e = firstAxis; e < input->rankOf(); e++) rowLength *= input->sizeAt(e);
+    numRows = rowLength > 0 ? input->lengthOf() / rowLength : 0;
+
+    channelStride = 1;
+    for (int e = channelAxis + 1; e < input->rankOf(); e++) channelStride *= input->sizeAt(e);
+    numChannels = input->sizeAt(channelAxis);
+    channelsLast = channelStride == 1 && channelAxis >= firstAxis;
+  }
+
+  // calls f(offset within row, length, channel) for runs of elements sharing the same channel
+  template <typename F>
+  void forEachRun(LongType row, F f) const {
+    for (LongType pos = 0; pos < rowLength;) {
+      const auto index = row * rowLength + pos;
+      const auto c = (index / channelStride) % numChannels;
+      const auto length = sd::math::sd_min<LongType>(channelStride - index % channelStride, rowLength - pos);
+      f(pos, length, c);
+      pos += length;
+    }
+  }
+};
+
+template <typename T>
+static void layerNorm_(NDArray* input, NDArray* gain, NDArray* bias, NDArray* output, int firstAxis,
+                       int channelAxis) {
+  using A = NormAcc<T>;
+  const LayerNormView view(input, firstAxis, channelAxis);
+  const auto C = view.numChannels;
+
+  const auto x = input->bufferAsT<T>();
+  auto z = output->bufferAsT<T>();
+  const auto gn = gain->bufferAsT<T>();
+  const auto bs = bias != nullptr ? bias->bufferAsT<T>() : nullptr;
+
+  auto func = PRAGMA_THREADS_FOR {
+    for (auto r = start; r < stop; r++) {
+      const auto xr = x + r * view.rowLength;
+      auto zr = z + r * view.rowLength;
+
+      Moments<A> moments;
+      segmentMoments(xr, view.rowLength, moments);
+
+      // same as standardize op: biased stdev plus 1e-12
+      const A inv = static_cast<A>(1) /
+                    (sd::math::sd_sqrt<A, A>(moments.variance()) + static_cast<A>(1e-12));
+      const A mean = moments.mean;
+
+      if (view.channelsLast) {
+        for (LongType pos = 0; pos < view.rowLength; pos += C) {
+          PRAGMA_OMP_SIMD
+          for (LongType c = 0; c < C; c++) {
+            const A b = bs != nullptr ? static_cast<A>(bs[c]) : static_cast<A>(0);
+            zr[pos + c] = static_cast<T>((static_cast<A>(xr[pos + c]) - mean) * inv * static_cast<A>(gn[c]) + b);
+          }
+        }
+        continue;
+      }
+
+      view.forEachRun(r, [&](LongType pos, LongType length, LongType c) {
+        const A a = static_cast<A>(gn[c]) * inv;
+        const A b = (bs != nullptr ? static_cast<A>(bs[c]) : static_cast<A>(0)) - mean * a;
+
+        PRAGMA_OMP_SIMD
+        for (LongType i = pos; i < pos + length; i++) zr[i] = static_cast<T>(static_cast<A>(xr[i]) * a + b);
+      });
+    }
+  };
+
+  samediff::Threads::parallel_tad(func, 0, view.numRows, 1,
+                                  numThreads(view.numRows, input->lengthOf(), samediff::OpCostClass::REDUCTION));
+}
+
+template <typename T>
+static void layerNormBp_(NDArray* input, NDArray* gain, NDArray* gradO, NDArray* gradI, NDArray* gradGain,
+                         NDArray* gradBias, int firstAxis, int channelAxis) {
+  using A = NormAcc<T>;
+  const LayerNormView view(input, firstAxis, channelAxis);
+  const auto C = view.numChannels;
+
+  const auto x = input->bufferAsT<T>();
+  const auto dy = gradO->bufferAsT<T>();
+  auto dx = gradI->bufferAsT<T>();
+  const auto gn = gain->bufferAsT<T>();
+
+  // gain and bias gradients are reduced over all rows, every group of rows gets its own partial sums
+  const auto groups = numGroups(view.numRows);
+  std::vector<A> partialGain(groups * C, static_cast<A>(0));
+  std::vector<A> partialBias(groups * C, static_cast<A>(0));
+
+  const A n = static_cast<A>(view.rowLength);
+
+  auto func = PRAGMA_THREADS_FOR {
+    for (auto grp = start; grp < stop; grp++) {
+      auto pg = partialGain.data() + grp * C;
+      auto pb = partialBias.data() + grp * C;
+
+      for (auto r = groupStart(grp, groups, view.numRows); r < groupStart(grp + 1, groups, view.numRows); r++) {
+        const auto xr = x + r * view.rowLength;
+        const auto dyr = dy + r * view.rowLength;
+        auto dxr = dx + r * view.rowLength;
+
+        Moments<A> moments;
+        segmentMoments(xr, view.rowLength, moments);
+        const A mean = moments.mean;
+        const A stdev = sd::math::sd_sqrt<A, A>(moments.variance());
+        const A invForward = static_cast<A>(1) / (stdev + static_cast<A>(1e-12));
+
+        // gradient wrt standardized input is gradO * gain
+        A s1 = static_cast<A>(0), s2 = static_cast<A>(0);
+        if (view.channelsLast) {
+          for (LongType pos = 0; pos < view.rowLength; pos += C) {
+            PRAGMA_OMP_SIMD_ARGS(reduction(+ : s1, s2))
+            for (LongType c = 0; c < C; c++) {
+              const A e = static_cast<A>(dyr[pos + c]);
+              const A eXhat = e * (static_cast<A>(xr[pos + c]) - mean);
+              const A gc = static_cast<A>(gn[c]);
+              s1 += e * gc;
+              s2 += eXhat * gc;
+              pb[c] += e;
+              pg[c] += eXhat * invForward;
+            }
+          }
+        } else {
+          view.forEachRun(r, [&](LongType pos, LongType length, LongType c) {
+            const A gc = static_cast<A>(gn[c]);
+            A sumDy = static_cast<A>(0), sumDyXhat = static_cast<A>(0);
+
+            PRAGMA_OMP_SIMD_ARGS(reduction(+ : sumDy, sumDyXhat))
+            for (LongType i = pos; i < pos + length; i++) {
+              const A e = static_cast<A>(dyr[i]);
+              sumDy += e;
+              sumDyXhat += e * (static_cast<A>(xr[i]) - mean);
+            }
+
+            s1 += sumDy * gc;
+            s2 += sumDyXhat * gc;
+            pb[c] += sumDy;
+            pg[c] += sumDyXhat * invForward;
+          });
+        }
+
+        // standardize_bp replaces NaNs with zeros, that's the whole row for constant rows
+        if (stdev == static_cast<A>(0)) {
+          for (LongType i = 0; i < view.rowLength; i++) dxr[i] = static_cast<T>(0);
+          continue;
+        }
+
+        // gradI = (g - mean(g)) / stdev - (x - mean) * mean(g * (x - mean)) / stdev^3, g = gradO * gain
+        const A inv = static_cast<A>(1) / stdev;
+        const A k1 = s1 / n;
+        const A k2 = s2 / n * inv * inv * inv;
+        if (view.channelsLast) {
+          const A b = -k1 * inv + mean * k2;
+          for (LongType pos = 0; pos < view.rowLength; pos += C) {
+            PRAGMA_OMP_SIMD
+            for (LongType c = 0; c < C; c++)
+              dxr[pos + c] = static_cast<T>(static_cast<A>(dyr[pos + c]) * static_cast<A>(gn[c]) * inv -
+                                            static_cast<A>(xr[pos + c]) * k2 + b);
+          }
+          continue;
+        }
+
+        view.forEachRun(r, [&](LongType pos, LongType length, LongType c) {
+          const A a = static_cast<A>(gn[c]) * inv;
+          const A b = -k1 * inv + mean * k2;
+
+          PRAGMA_OMP_SIMD
+          for (LongType i = pos; i < pos + length; i++)
+            dxr[i] = static_cast<T>(static_cast<A>(dyr[i]) * a - static_cast<A>(xr[i]) * k2 + b);
+        });
+      }
+    }
+  };
+
+  samediff::Threads::parallel_tad(func, 0, groups, 1,
+                                  numThreads(groups, input->lengthOf(), samediff::OpCostClass::REDUCTION));
+
+  auto gg = gradGain->bufferAsT<T>();
+  auto gb = gradBias != nullptr ? gradBias->bufferAsT<T>() : nullptr;
+  for (LongType c = 0; c < C; c++) {
+    A sumGain = static_cast<A>(0), sumBias = static_cast<A>(0);
+    for (LongType grp = 0; grp < groups; grp++) {
+      sumGain += partialGain[grp * C + c];
+      sumBias += partialBias[grp * C + c];
+    }
+
+    gg[c] = static_cast<T>(sumGain);
+    if (gb != nullptr) gb[c] = static_cast<T>(sumBias);
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////
+bool fusedNormalizationSupported(const std::vector<NDArray*>& arrays, const std::vector<NDArray*>& params) {
+  if (arrays.empty() || arrays[0] == nullptr) return false;
+
+  const auto dataType = arrays[0]->dataType();
+  if (!DataTypeUtils::isR(dataType) || arrays[0]->isEmpty()) return false;
+
+  for (auto array : arrays)
+    if (array == nullptr || array->dataType() != dataType || array->ordering() != 'c' || array->ews() != 1 ||
+        !array->isSameShape(arrays[0]))
+      return false;
+
+  for (auto param : params)
+    if (param != nullptr && (param->dataType() != dataType || param->ews() != 1)) return false;
+
+  return true;
+}
+
+void batchnormTraining(LaunchContext* context, NDArray* input, NDArray* gamma, NDArray* beta, NDArray* output,
+                       NDArray* mean, NDArray* variance, int channelAxis, double epsilon) {
+  NDArray::preparePrimaryUse({output, mean, variance}, {input, gamma, beta});
+
+  BUILD_SINGLE_SELECTOR(input->dataType(), batchnormTraining_,
+                        (input, gamma, beta, output, mean, variance, channelAxis, epsilon), SD_FLOAT_TYPES);
+
+  NDArray::registerPrimaryUse({output, mean, variance}, {input, gamma, beta});
+}
+
+void batchnormBp(LaunchContext* context, NDArray* input, NDArray* mean, NDArray* variance, NDArray* gamma,
+                 NDArray* gradO, NDArray* gradI, NDArray* gradGamma, NDArray* gradBeta, int channelAxis,
+                 double epsilon) {
+  NDArray::preparePrimaryUse({gradI, gradGamma, gradBeta}, {input, mean, variance, gamma, gradO});
+
+  BUILD_SINGLE_SELECTOR(input->dataType(), batchnormBp_,
+                        (input, mean, variance, gamma, gradO, gradI, gradGamma, gradBeta, channelAxis, epsilon),
+                        SD_FLOAT_TYPES);
+
+  NDArray::registerPrimaryUse({gradI, gradGamma, gradBeta}, {input, mean, variance, gamma, gradO});
+}
+
+void layerNorm(LaunchContext* context, NDArray* input, NDArray* gain, NDArray* bias, NDArray* output, int firstAxis,
+               int channelAxis) {
+  NDArray::preparePrimaryUse({output}, {input, gain, bias});
+
+  BUILD_SINGLE_SELECTOR(input->dataType(), layerNorm_, (input, gain, bias, output, firstAxis, channelAxis),
+                        SD_FLOAT_TYPES);
+
+  NDArray::registerPrimaryUse({output}, {input, gain, bias});
+}
+
+void layerNormBp(LaunchContext* context, NDArray* input, NDArray* gain, NDArray* gradO, NDArray* gradI,
+                 NDArray* gradGain, NDArray* gradBias, int firstAxis, int channelAxis) {
+  NDArray::preparePrimaryUse({gradI, gradGain, gradBias}, {input, gain, gradO});
+
+  BUILD_SINGLE_SELECTOR(input->dataType(), layerNormBp_,
+                        (input, gain, gradO, gradI, gradGain, gradBias, firstAxis, channelAxis), SD_FLOAT_TYPES);
+
+  NDArray::registerPrimaryUse({gradI, gradGain, gradBias}, {input, gain, gradO});
+}
+
+}  // namespace helpers
+}  // namespace ops
+}  // namespace sd
@@ -0,0 +1,130 @@
+/* ******************************************************************************
+ *
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ *  See the NOTICE file distributed with this work for additional
+ *  information regarding copyright ownership.
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ******************************************************************************/
+
+//
+// Interpolation plans for image resize, cached by geometry and method
+//
+#include <ops/declarable/helpers/resizePlans.h>
+
+namespace sd {
+namespace ops {
+namespace helpers {
+
+bool ResizePlanKey::operator==(const ResizePlanKey &other) const {
+  return method == other.method && coordinateMode == other.coordinateMode && nearestMode == other.nearestMode &&
+         alignCorners == other.alignCorners && halfPixelCenters == other.halfPixelCenters &&
+         excludeOutside == other.excludeOutside && coefficient == other.coefficient && inHeight == other.inHeight &&
+         inWidth == other.inWidth && outHeight == other.outHeight && outWidth == other.outWidth &&
+         wStride == other.wStride;
+}
+
+size_t ResizePlanKeyHash::operator()(const ResizePlanKey &key) const {
+  size_t hash = std::hash<double>()(key.coefficient);
+  auto combine = [&hash](size_t value) { hash ^= value + 0x9e3779b97f4a7c15ULL + (hash << 6) + (hash >> 2); };
+
+  combine(static_cast<size_t>(key.method));
+  combine(static_cast<size_t>(key.coordinateMode));
+  combine(static_cast<size_t>(key.nearestMode));
+  combine((key.alignCorners ? 1 : 0) | (key.halfPixelCenters ? 2 : 0) | (key.excludeOutside ? 4 : 0));
+  combine(static_cast<size_t>(key.inHeight));
+  combine(static_cast<size_t>(key.inWidth));
+  combine(static_cast<size_t>(key.outHeight));
+  combine(static_cast<size_t>(key.outWidth));
+  combine(static_cast<size_t>(key.wStride));
+  return hash;
+}
+
+ResizePlanCache &ResizePlanCache::getInstance() {
+  static ResizePlanCache instance;
+  return instance;
+}
+
+std::shared_ptr<const ResizePlan> ResizePlanCache::plan(const ResizePlanKey &key,
+                                                        const std::function<void(ResizePlan &)> &builder) {
+  {
+    std::lock_guard<std::mutex> lock(_lock);
+    auto it = _plans.find(key);
+    if (it != _plans.end()) {
+      _hits++;
+      it->second.lastUse = ++_clock;
+      return it->second.plan;
+    }
+
+    _misses++;
+  }
+
+  // plan is built without holding the lock, concurrent builders of the same plan keep the first one
+  auto plan = std::make_shared<ResizePlan>();
+  builder(*plan);
+
+  std::lock_guard<std::mutex> lock(_lock);
+  if (_maxPlans <= 0) return plan;
+
+  auto result = _plans.emplace(key, Entry{plan, ++_clock});
+  if (!result.second) return result.first->second.plan;
+
+  evict();
+  return plan;
+}
+
+void ResizePlanCache::evict() {
+  while (static_cast<int>(_plans.size()) > _maxPlans) {
+    auto oldest = _plans.begin();
+    for (auto it = _plans.begin(); it != _plans.end(); ++it)
+      if (it->second.lastUse < oldest->second.lastUse) oldest = it;
+
+    _plans.erase(oldest);
+  }
+}
+
+void ResizePlanCache::setMaxPlans(int maxPlans) {
+  std::lock_guard<std::mutex> lock(_lock);
+  _maxPlans = maxPlans;
+  evict();
+}
+
+int ResizePlanCache::maxPlans() {
+  std::lock_guard<std::mutex> lock(_lock);
+  return _maxPlans;
+}
+
+int ResizePlanCache::size() {
+  std::lock_guard<std::mutex> lock(_lock);
+  return static_cast<int>(_plans.size());
+}
+
+LongType ResizePlanCache::hits() {
+  std::lock_guard<std::mutex> lock(_lock);
+  return _hits;
+}
+
+LongType ResizePlanCache::misses() {
+  std::lock_guard<std::mutex> lock(_lock);
+  return _misses;
+}
+
+void ResizePlanCache::clear() {
+  std::lock_guard<std::mutex> lock(_lock);
+  _plans.clear();
+  _hits = 0;
+  _misses = 0;
+}
+
+}  // namespace helpers
+}  // namespace ops
+}  // namespace sd
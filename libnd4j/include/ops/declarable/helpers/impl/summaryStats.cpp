@@ -0,0 +1,433 @@
+/* ******************************************************************************
+ *
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ *  See the NOTICE file distributed with this work for additional
+ *  information regarding copyright ownership.
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ******************************************************************************/
+
+//
+// Several summary statistics of one array computed in single pass over its data
+//
+#include <execution/Threads.h>
+#include <math/templatemath.h>
+#include <ops/declarable/helpers/summaryStats.h>
+
+#include <limits>
+#include <type_traits>
+
+namespace sd {
+namespace ops {
+namespace helpers {
+
+// elements processed at once, block stays in L1/L2 for its second read
+static const LongType kStatsBlock = 4096;
+
+// number of independent partial results per output element, fixed so results don't depend on number of threads
+static const LongType kStatsGroups = 128;
+
+// upper bound on number of partial results kept at once
+static const LongType kStatsPartials = 1 << 16;
+
+// double and integer inputs are accumulated in double, everything else in float
+template <typename T>
+using StatsAcc = typename std::conditional<std::is_same<T, double>::value || std::is_integral<T>::value, double,
+                                           float>::type;
+
+template <typename A>
+struct SummaryStats {
+  LongType count = 0;
+  A mean = static_cast<A>(0);
+  A m2 = static_cast<A>(0);
+  // raw sums for sufficient statistics, accumulated directly rather than recovered from mean and m2
+  A sum = static_cast<A>(0);
+  A sumSq = static_cast<A>(0);
+  A min = std::numeric_limits<A>::infinity();
+  A max = -std::numeric_limits<A>::infinity();
+  LongType nans = 0;
+  LongType infs = 0;
+
+  // Chan et al. formula
+  void merge(LongType n, A blockSum, A blockSumSq, A blockMean, A blockM2) {
+    if (n == 0) return;
+
+    sum += blockSum;
+    sumSq += blockSumSq;
+
+    const auto total = count + n;
+    const A delta = blockMean - mean;
+    mean += delta * static_cast<A>(n) / static_cast<A>(total);
+    m2 += blockM2 + delta * delta * static_cast<A>(count) * static_cast<A>(n) / static_cast<A>(total);
+    count = total;
+  }
+
+  void merge(const SummaryStats<A>& other) {
+    merge(other.count, other.sum, other.sumSq, other.mean, other.m2);
+    min = other.min < min ? other.min : min;
+    max = other.max > max ? other.max : max;
+    nans += other.nans;
+    infs += other.infs;
+  }
+};
+
+// contiguous span is split into blocks, first read of block gathers sum, sum of squares and extended statistics (min,
+// max, NaN and Inf counts), second one squared deviations from block mean
+template <typename T, typename A>
+static void spanStats(const T* x, LongType length, bool extended, SummaryStats<A>& stats) {
+  for (LongType b = 0; b < length; b += kStatsBlock) {
+    const auto n = math::sd_min<LongType>(kStatsBlock, length - b);
+    const auto block = x + b;
+
+    A sum = static_cast<A>(0);
+    A sumSq = static_cast<A>(0);
+    if (extended) {
+      A mn = stats.min;
+      A mx = stats.max;
+      LongType nans = 0, infs = 0;
+      PRAGMA_OMP_SIMD_ARGS(reduction(+ : sum, sumSq, nans, infs) reduction(min : mn) reduction(max : mx))
+      for (LongType i = 0; i < n; i++) {
+        const A v = static_cast<A>(block[i]);
+        sum += v;
+        sumSq += v * v;
+        mn = v < mn ? v : mn;
+        mx = v > mx ? v : mx;
+        // v - v is NaN for both NaN and Inf
+        nans += v != v;
+        infs += (v - v) != (v - v) && v == v;
+      }
+      stats.min = mn;
+      stats.max = mx;
+      stats.nans += nans;
+      stats.infs += infs;
+    } else {
+      PRAGMA_OMP_SIMD_ARGS(reduction(+ : sum, sumSq))
+      for (LongType i = 0; i < n; i++) {
+        const A v = static_cast<A>(block[i]);
+        sum += v;
+        sumSq += v * v;
+      }
+    }
+
+    const A blockMean = sum / static_cast<A>(n);
+    A m2 = static_cast<A>(0);
+    PRAGMA_OMP_SIMD_ARGS(reduction(+ : m2))
+    for (LongType i = 0; i < n; i++) {
+      const A d = static_cast<A>(block[i]) - blockMean;
+      m2 += d * d;
+    }
+
+    stats.merge(n, sum, sumSq, blockMean, m2);
+  }
+}
+
+// numCols columns starting at c0 of [rows, rowLen] matrix, blocks of rows are reduced for all columns at once
+template <typename T, typename A>
+static void columnStats(const T* x, LongType rows, LongType rowLen, LongType c0, LongType numCols, bool extended,
+                        SummaryStats<A>* stats) {
+  const auto rowsPerBlock = math::sd_max<LongType>(1, kStatsBlock / numCols);
+  std::vector<A> sum(numCols), sumSq(numCols), mean(numCols), m2(numCols);
+  std::vector<A> mn(numCols, std::numeric_limits<A>::infinity()), mx(numCols, -std::numeric_limits<A>::infinity());
+  std::vector<LongType> nans(numCols, 0), infs(numCols, 0);
+  auto pSum = sum.data();
+  auto pSumSq = sumSq.data();
+  auto pMean = mean.data();
+  auto pM2 = m2.data();
+  auto pMin = mn.data();
+  auto pMax = mx.data();
+  auto pNans = nans.data();
+  auto pInfs = infs.data();
+
+  for (LongType r = 0; r < rows; r += rowsPerBlock) {
+    const auto n = math::sd_min<LongType>(rowsPerBlock, rows - r);
+    std::fill(sum.begin(), sum.end(), static_cast<A>(0));
+    std::fill(sumSq.begin(), sumSq.end(), static_cast<A>(0));
+    std::fill(m2.begin(), m2.end(), static_cast<A>(0));
+
+    for (LongType i = 0; i < n; i++) {
+      const auto row = x + (r + i) * rowLen + c0;
+      if (extended) {
+        PRAGMA_OMP_SIMD
+        for (LongType c = 0; c < numCols; c++) {
+          const A v = static_cast<A>(row[c]);
+          pSum[c] += v;
+          pSumSq[c] += v * v;
+          pMin[c] = v < pMin[c] ? v : pMin[c];
+          pMax[c] = v > pMax[c] ? v : pMax[c];
+          pNans[c] += v != v;
+          pInfs[c] += (v - v) != (v - v) && v == v;
+        }
+      } else {
+        PRAGMA_OMP_SIMD
+        for (LongType c = 0; c < numCols; c++) {
+          const A v = static_cast<A>(row[c]);
+          pSum[c] += v;
+          pSumSq[c] += v * v;
+        }
+      }
+    }
+
+    for (LongType c = 0; c < numCols; c++) pMean[c] = pSum[c] / static_cast<A>(n);
+
+    for (LongType i = 0; i < n; i++) {
+      const auto row = x + (r + i) * rowLen + c0;
+      PRAGMA_OMP_SIMD
+      for (LongType c = 0; c < numCols; c++) {
+        const A d = static_cast<A>(row[c]) - pMean[c];
+        pM2[c] += d * d;
+      }
+    }
+
+    for (LongType c = 0; c < numCols; c++) stats[c].merge(n, pSum[c], pSumSq[c], pMean[c], pM2[c]);
+  }
+
+  for (LongType c = 0; c < numCols; c++) {
+    stats[c].min = pMin[c];
+    stats[c].max = pMax[c];
+    stats[c].nans = pNans[c];
+    stats[c].infs = pInfs[c];
+  }
+}
+
+// writes value(k) for k in [0, K) into output of any shape of length K and any type
+template <typename F>
+static void writeStat(LaunchContext* context, NDArray* output, LongType K, F value) {
+  if (output == nullptr) return;
+  if (output->lengthOf() != K)
+    THROW_EXCEPTION("summaryStats: length of output doesn't match number of reduced elements");
+
+  std::vector<LongType> shape = output->getShapeAsVector();
+  NDArray values('c', shape, DOUBLE, context);
+  NDArray::preparePrimaryUse({&values}, {});
+  auto buffer = values.bufferAsT<double>();
+  for (LongType k = 0; k < K; k++) buffer[k] = value(k);
+  NDArray::registerPrimaryUse({&values}, {});
+
+  output->assign(values);
+}
+
+//////////////////////////////////////////////////////////////////////////
+// input is c-order contiguous [outer, K, inner], statistics are computed over outer and inner
+template <typename T>
+static void summaryStats_(LaunchContext* context, NDArray* input, LongType outer, LongType K, LongType inner,
+                          const SummaryStatsOutputs& outputs) {
+  using A = StatsAcc<T>;
+  if (K == 0) return;
+
+  const T* x = input->bufferAsT<T>();
+  const bool extended = outputs.min != nullptr || outputs.max != nullptr || outputs.nanCount != nullptr ||
+                        outputs.infCount != nullptr;
+
+  const auto groups = math::sd_max<LongType>(
+      1, math::sd_min<LongType>(math::sd_min<LongType>(outer, kStatsGroups), kStatsPartials / K));
+  auto groupStart = [&](LongType g) { return g * outer / groups; };
+
+  const LongType maxThreads = Environment::getInstance().maxMasterThreads();
+
+  // partial results of (group, part of row) pairs, merged in fixed order afterwards
+  LongType parts;
+  std::vector<SummaryStats<A>> partials;
+
+  if (inner > 1) {
+    // every (outer, k) pair is contiguous span, long spans are split when there are few of them
+    const auto chunks = groups * K >= kStatsGroups
+                            ? 1
+                            : math::sd_max<LongType>(1, math::sd_min<LongType>(kStatsGroups / (groups * K),
+                                                                                 inner / kStatsBlock));
+    parts = chunks;
+    partials.resize(groups * K * chunks);
+
+    auto func = PRAGMA_THREADS_FOR {
+      for (auto t = start; t < stop; t++) {
+        const auto g = t / (K * chunks);
+        const auto k = (t / chunks) % K;
+        const auto ch = t % chunks;
+        const auto first = ch * inner / chunks;
+        const auto last = (ch + 1) * inner / chunks;
+        for (auto o = groupStart(g); o < groupStart(g + 1); o++)
+          spanStats(x + (o * K + k) * inner + first, last - first, extended, partials[(g * K + k) * chunks + ch]);
+      }
+    };
+
+    const auto tasks = groups * K * chunks;
+    samediff::Threads::parallel_tad(func, 0, tasks, 1, math::sd_min<LongType>(tasks, maxThreads));
+  } else {
+    // rows of K values: every task streams rows of its group through slice of columns
+    const auto sliceLen = math::sd_min<LongType>(K, kStatsBlock);
+    const auto slices = (K + sliceLen - 1) / sliceLen;
+    parts = 1;
+    partials.resize(groups * K);
+
+    auto func = PRAGMA_THREADS_FOR {
+      for (auto t = start; t < stop; t++) {
+        const auto g = t / slices;
+        const auto c0 = (t % slices) * sliceLen;
+        const auto numCols = math::sd_min<LongType>(sliceLen, K - c0);
+        const auto first = groupStart(g);
+        columnStats(x + first * K, groupStart(g + 1) - first, K, c0, numCols, extended, partials.data() + g * K + c0);
+      }
+    };
+
+    const auto tasks = groups * slices;
+    samediff::Threads::parallel_tad(func, 0, tasks, 1, math::sd_min<LongType>(tasks, maxThreads));
+  }
+
+  std::vector<SummaryStats<A>> totals(K);
+  auto merge = PRAGMA_THREADS_FOR {
+    for (auto k = start; k < stop; k++)
+      for (LongType g = 0; g < groups; g++)
+        for (LongType p = 0; p < parts; p++) totals[k].merge(partials[(g * K + k) * parts + p]);
+  };
+
+  samediff::Threads::parallel_tad(merge, 0, K, 1, math::sd_min<LongType>(K, maxThreads));
+
+  const double count = static_cast<double>(outer * inner);
+  const double nan = std::numeric_limits<double>::quiet_NaN();
+  const auto& s = totals;
+
+  if (outputs.count != nullptr) {
+    if (outputs.count->lengthOf() == 1)
+      outputs.count->p(0, count);
+    else
+      writeStat(context, outputs.count, K, [&](LongType k) { return count; });
+  }
+
+  writeStat(context, outputs.sum, K, [&](LongType k) { return static_cast<double>(s[k].sum); });
+  writeStat(context, outputs.squaredSum, K, [&](LongType k) { return static_cast<double>(s[k].sumSq); });
+  writeStat(context, outputs.mean, K, [&](LongType k) { return s[k].count > 0 ? static_cast<double>(s[k].mean) : nan; });
+  writeStat(context, outputs.variance, K, [&](LongType k) {
+    const auto n = outputs.biasCorrected && s[k].count > 1 ? s[k].count - 1 : s[k].count;
+    return n > 0 ? static_cast<double>(s[k].m2) / static_cast<double>(n) : nan;
+  });
+  writeStat(context, outputs.min, K, [&](LongType k) { return static_cast<double>(s[k].min); });
+  writeStat(context, outputs.max, K, [&](LongType k) { return static_cast<double>(s[k].max); });
+  writeStat(context, outputs.nanCount, K, [&](LongType k) { return static_cast<double>(s[k].nans); });
+  writeStat(context, outputs.infCount, K, [&](LongType k) { return static_cast<double>(s[k].infs); });
+}
+
+void summaryStats(LaunchContext* context, NDArray* input, const std::vector<LongType>& axes,
+                  const SummaryStatsOutputs& outputs) {
+  const int rank = input->rankOf();
+
+  bool reduced[SD_MAX_RANK];
+  for (int e = 0; e < rank; e++) reduced[e] = axes.empty();
+  for (auto axis : axes) {
+    const auto a = axis < 0 ? axis + rank : axis;
+    if (a < 0 || a >= rank) THROW_EXCEPTION("summaryStats: axis is out of range");
+    reduced[a] = true;
+  }
+
+  // kept non-unit dimensions must be adjacent, then c-order array is [outer, K, inner]
+  int firstKept = -1, lastKept = -1;
+  bool adjacent = true;
+  for (int e = 0; e < rank; e++) {
+    if (input->sizeAt(e) == 1) continue;
+    if (!reduced[e]) {
+      if (firstKept < 0) firstKept = e;
+      lastKept = e;
+    }
+  }
+  for (int e = firstKept; e >= 0 && e <= lastKept; e++)
+    if (reduced[e] && input->sizeAt(e) != 1) adjacent = false;
+
+  LongType outer = 1, K = 1, inner = 1;
+  NDArray source;
+  if (adjacent) {
+    for (int e = 0; e < rank; e++) {
+      if (firstKept >= 0 && e >= firstKept && e <= lastKept)
+        K *= input->sizeAt(e);
+      else if (firstKept >= 0 && e < firstKept)
+        outer *= input->sizeAt(e);
+      else
+        inner *= input->sizeAt(e);
+    }
+    source = input->ordering() == 'c' && input->ews() == 1 ? *input : input->dup('c');
+  } else {
+    // kept dimensions go first, data is copied once into that layout
+    std::vector<LongType> permutation;
+    for (int e = 0; e < rank; e++)
+      if (!reduced[e]) {
+        permutation.push_back(e);
+        K *= input->sizeAt(e);
+      }
+    for (int e = 0; e < rank; e++)
+      if (reduced[e]) {
+        permutation.push_back(e);
+        inner *= input->sizeAt(e);
+      }
+    source = input->permute(permutation, false, false).dup('c');
+  }
+
+  if (input->isEmpty()) outer = inner = 0;
+
+  NDArray::preparePrimaryUse({}, {&source});
+  BUILD_SINGLE_SELECTOR(source.dataType(), summaryStats_, (context, &source, outer, K, inner, outputs),
+                        SD_NUMERIC_TYPES);
+  NDArray::registerPrimaryUse({}, {&source});
+}
+
+//////////////////////////////////////////////////////////////////////////
+template <typename T>
+static void normalizeMoments_(NDArray* counts, NDArray* sums, NDArray* squaredSums, double shift, NDArray* means,
+                              NDArray* variances) {
+  using A = StatsAcc<T>;
+  const auto length = sums->lengthOf();
+  const bool scalarCount = counts->lengthOf() == 1;
+  const auto c = counts->bufferAsT<T>();
+  const auto s = sums->bufferAsT<T>();
+  const auto q = squaredSums->bufferAsT<T>();
+  auto m = means->bufferAsT<T>();
+  auto v = variances->bufferAsT<T>();
+
+  auto func = PRAGMA_THREADS_FOR {
+    PRAGMA_OMP_SIMD
+    for (auto i = start; i < stop; i++) {
+      const A n = static_cast<A>(c[scalarCount ? 0 : i]);
+      const A mean = static_cast<A>(s[i]) / n;
+      v[i] = static_cast<T>(static_cast<A>(q[i]) / n - mean * mean);
+      m[i] = static_cast<T>(mean + static_cast<A>(shift));
+    }
+  };
+
+  samediff::Threads::parallel_for(func, 0, length);
+}
+
+void normalizeMoments(LaunchContext* context, NDArray* counts, NDArray* sums, NDArray* squaredSums, double shift,
+                      NDArray* means, NDArray* variances) {
+  // kernel reads plain buffers of one floating type, anything else goes through casting copies
+  const auto dtype = means->dataType();
+  auto plain = [dtype](NDArray* array) {
+    return array->dataType() == dtype && array->ordering() == 'c' && array->ews() == 1;
+  };
+
+  NDArray c = plain(counts) ? *counts : counts->cast(dtype).dup('c');
+  NDArray s = plain(sums) ? *sums : sums->cast(dtype).dup('c');
+  NDArray q = plain(squaredSums) ? *squaredSums : squaredSums->cast(dtype).dup('c');
+  std::vector<LongType> meansShape = means->getShapeAsVector();
+  std::vector<LongType> variancesShape = variances->getShapeAsVector();
+  NDArray m = plain(means) ? *means : NDArray('c', meansShape, dtype, context);
+  NDArray v = plain(variances) ? *variances : NDArray('c', variancesShape, dtype, context);
+
+  if (c.lengthOf() != 1 && c.lengthOf() != s.lengthOf())
+    THROW_EXCEPTION("normalizeMoments: counts should be scalar or have one value per element of sums");
+
+  NDArray::preparePrimaryUse({&m, &v}, {&c, &s, &q});
+  BUILD_SINGLE_SELECTOR(dtype, normalizeMoments_, (&c, &s, &q, shift, &m, &v), SD_FLOAT_TYPES);
+  NDArray::registerPrimaryUse({&m, &v}, {&c, &s, &q});
+
+  if (m.buffer() != means->buffer()) means->assign(m);
+  if (v.buffer() != variances->buffer()) variances->assign(v);
+}
+
+}  // namespace helpers
+}  // namespace ops
+}  // namespace sd
@@ -0,0 +1,131 @@
+/* ******************************************************************************
+ *
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ *  See the NOTICE file distributed with this work for additional
+ *  information regarding copyright ownership.
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ******************************************************************************/
+
+//
+// Adam applied to rows of sparse gradient only
+//
+#include <system/op_boilerplate.h>
+
+#if NOT_EXCLUDED(OP_sparse_adam_updater)
+#include <execution/Threads.h>
+#include <math/templatemath.h>
+#include <ops/declarable/helpers/updatersHelpers.h>
+
+#include <algorithm>
+#include <vector>
+
+namespace sd {
+namespace ops {
+namespace helpers {
+
+template <typename T>
+static void sparseAdamUpdater_(NDArray& indices, NDArray& gradient, NDArray& stateU, NDArray& stateM,
+                               NDArray& update, NDArray* lastIteration, const double dLr, const double dBeta1,
+                               const double dBeta2, const double dEpsilon, const int nIteration) {
+  auto rows = indices.asVectorT<LongType>();
+  const auto numRows = static_cast<LongType>(rows.size());
+  if (numRows == 0) return;
+
+  const auto numStateRows = stateU.sizeAt(0);
+  const auto rowLength = gradient.lengthOf() / numRows;
+
+  // rows are updated concurrently, so they must be distinct
+  auto sorted = rows;
+  std::sort(sorted.begin(), sorted.end());
+  if (std::adjacent_find(sorted.begin(), sorted.end()) != sorted.end())
+    THROW_EXCEPTION("sparse_adam_updater: row ids must be unique, aggregate gradient with indexed_slices_aggregate");
+
+  if (sorted.front() < 0 || sorted.back() >= numStateRows)
+    THROW_EXCEPTION("sparse_adam_updater: row id is out of range of state arrays");
+
+  auto contiguous = gradient.ews() == 1 && gradient.ordering() == 'c';
+  NDArray copy = contiguous ? NDArray() : gradient.dup('c');
+
+  const T* grad = contiguous ? gradient.bufferAsT<T>() : copy.bufferAsT<T>();
+  T* up = update.bufferAsT<T>();
+  T* stU = stateU.bufferAsT<T>();
+  T* stM = stateM.bufferAsT<T>();
+  auto last = lastIteration != nullptr ? lastIteration->bufferAsT<LongType>() : nullptr;
+
+  const T lr = static_cast<T>(dLr);
+  const T beta1 = static_cast<T>(dBeta1);
+  const T beta2 = static_cast<T>(dBeta2);
+  T epsilon = static_cast<T>(dEpsilon);
+  // fp16 to prevent underflow
+  if (epsilon == 0.0) epsilon = static_cast<T>(1e-7);
+
+  const T iteration = static_cast<T>(nIteration);
+  const T beta1T = sd::math::sd_pow<T, T, T>(beta1, (iteration + 1));
+  const T beta2T = sd::math::sd_pow<T, T, T>(beta2, (iteration + 1));
+
+  T epsilonT = lr * sd::math::sd_sqrt<T, T>(1. - beta2T) / (1.0 - beta1T);
+  if (sd::math::sd_isnan(epsilonT) || 0 == epsilonT || sd::math::sd_isinf(epsilonT)) epsilonT = epsilon;
+
+  auto func = PRAGMA_THREADS_FOR {
+    for (auto r = start; r < stop; r++) {
+      const auto row = rows[r];
+      T decay1 = static_cast<T>(1);
+      T decay2 = static_cast<T>(1);
+
+      // dense Adam would have decayed moments of this row on every skipped iteration
+      if (last != nullptr) {
+        const auto skipped = last[row] >= 0 ? nIteration - last[row] - 1 : 0;
+        if (skipped > 0) {
+          decay1 = sd::math::sd_pow<T, T, T>(beta1, static_cast<T>(skipped));
+          decay2 = sd::math::sd_pow<T, T, T>(beta2, static_cast<T>(skipped));
+        }
+
+        last[row] = nIteration;
+      }
+
+      auto g = grad + r * rowLength;
+      auto u = up + r * rowLength;
+      auto m = stM + row * rowLength;
+      auto v = stU + row * rowLength;
+      for (LongType c = 0; c < rowLength; c++) {
+        m[c] = beta1 * (m[c] * decay1) + g[c] * (1 - beta1);
+        v[c] = beta2 * (v[c] * decay2) + g[c] * g[c] * (1 - beta2);
+        u[c] = (m[c] * epsilonT) / (sd::math::sd_sqrt<T, T>(v[c]) + epsilon);
+      }
+    }
+  };
+
+  samediff::Threads::parallel_tad(
+      func, 0, numRows, 1,
+      samediff::ThreadsHelper::numberOfThreadsTad(Environment::getInstance().maxMasterThreads(), numRows,
+                                                  gradient.lengthOf(), samediff::OpCostClass::ELEMENTWISE));
+}
+
+void updaterSparseAdam(LaunchContext* context, NDArray& indices, NDArray& gradient, NDArray& stateU,
+                       NDArray& stateM, NDArray& update, NDArray* lastIteration, const double dLr,
+                       const double dBeta1, const double dBeta2, const double dEpsilon, const int nIteration) {
+  // states are updated partially, so their current contents are needed on host
+  NDArray::preparePrimaryUse({&update, &stateU, &stateM, lastIteration}, {&indices, &gradient}, true);
+
+  BUILD_SINGLE_SELECTOR(
+      gradient.dataType(), sparseAdamUpdater_,
+      (indices, gradient, stateU, stateM, update, lastIteration, dLr, dBeta1, dBeta2, dEpsilon, nIteration),
+      SD_FLOAT_TYPES);
+
+  NDArray::registerPrimaryUse({&update, &stateU, &stateM, lastIteration}, {&indices, &gradient});
+}
+
+}  // namespace helpers
+}  // namespace ops
+}  // namespace sd
+#endif
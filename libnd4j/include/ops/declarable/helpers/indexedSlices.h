@@ -17,27 +17,24 @@
  ******************************************************************************/
 
 //
-// @author raver119@gmail.com
+// Indexed slices: sparse gradients represented as row ids plus value rows
 //
 
-#ifndef LIBND4J_BENCHMARKSUIT_H
-#define LIBND4J_BENCHMARKSUIT_H
-
-#include <string>
-#include <system/pointercast.h>
-#include <system/dll.h>
-#include <helpers/BenchmarkHelper.h>
-#include <array/NDArrayFactory.h>
+#ifndef LIBND4J_HELPERS_INDEXED_SLICES_H
+#define LIBND4J_HELPERS_INDEXED_SLICES_H
+#include <array/NDArray.h>
+#include <system/op_boilerplate.h>
 
 namespace sd {
-    class SD_LIB_EXPORT BenchmarkSuit {
-    public:
-        BenchmarkSuit() = default;
-        ~BenchmarkSuit() = default;
+namespace ops {
+namespace helpers {
 
-        virtual std::string runSuit() = 0;
-    };
-}
+SD_LIB_HIDDEN LongType indexedSlicesCount(LaunchContext* context, NDArray* indices);
 
+SD_LIB_HIDDEN void indexedSlicesAggregate(LaunchContext* context, NDArray* indices, NDArray* values,
+                                          NDArray* uniqueIndices, NDArray* aggregated);
 
-#endif //DEV_TESTS_BENCHMARKSUIT_H
+}  // namespace helpers
+}  // namespace ops
+}  // namespace sd
+#endif
@@ -0,0 +1,77 @@
+/* ******************************************************************************
+ *
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ *  See the NOTICE file distributed with this work for additional
+ *  information regarding copyright ownership.
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ******************************************************************************/
+
+//
+// Fused batch and layer normalization kernels: statistics in one pass, normalization in another
+//
+
+#ifndef LIBND4J_HELPERS_NORMALIZATION_H
+#define LIBND4J_HELPERS_NORMALIZATION_H
+#include <array/NDArray.h>
+#include <system/op_boilerplate.h>
+
+#include <vector>
+
+namespace sd {
+namespace ops {
+namespace helpers {
+
+/**
+ * This method checks if fused kernels may be used: arrays must be contiguous c-order arrays, params must be
+ * contiguous, and all of them must have floating type of first array. Null params are skipped
+ */
+SD_LIB_HIDDEN bool fusedNormalizationSupported(const std::vector<NDArray*>& arrays, const std::vector<NDArray*>& params);
+
+/**
+ * Batch normalization in training mode. Per-channel mean and biased variance are computed over all dimensions except
+ * channelAxis with blocked Welford merging, then input is normalized in second pass:
+ * output = gamma * (input - mean) / sqrt(variance + epsilon) + beta
+ *
+ * gamma and beta may be null
+ */
+SD_LIB_HIDDEN void batchnormTraining(LaunchContext* context, NDArray* input, NDArray* gamma, NDArray* beta,
+                                     NDArray* output, NDArray* mean, NDArray* variance, int channelAxis,
+                                     double epsilon);
+
+/**
+ * Batch normalization backprop with mean and variance treated as functions of input, same math as batchnorm_bp.
+ * One pass accumulates per-channel sums, second one computes gradI. gamma, gradGamma and gradBeta may be null
+ */
+SD_LIB_HIDDEN void batchnormBp(LaunchContext* context, NDArray* input, NDArray* mean, NDArray* variance,
+                               NDArray* gamma, NDArray* gradO, NDArray* gradI, NDArray* gradGamma, NDArray* gradBeta,
+                               int channelAxis, double epsilon);
+
+/**
+ * Layer normalization over trailing dimensions starting at firstAxis, gain and bias are applied along channelAxis:
+ * output = gain * (input - mean) / (stdev + 1e-12) + bias
+ *
+ * bias may be null
+ */
+SD_LIB_HIDDEN void layerNorm(LaunchContext* context, NDArray* input, NDArray* gain, NDArray* bias, NDArray* output,
+                             int firstAxis, int channelAxis);
+
+/**
+ * Layer normalization backprop, same math as layer_norm_bp. gradBias may be null
+ */
+SD_LIB_HIDDEN void layerNormBp(LaunchContext* context, NDArray* input, NDArray* gain, NDArray* gradO, NDArray* gradI,
+                               NDArray* gradGain, NDArray* gradBias, int firstAxis, int channelAxis);
+
+}  // namespace helpers
+}  // namespace ops
+}  // namespace sd
+#endif
@@ -0,0 +1,140 @@
+/* ******************************************************************************
+ *
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ *  See the NOTICE file distributed with this work for additional
+ *  information regarding copyright ownership.
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ******************************************************************************/
+
+//
+// Interpolation plans for image resize, cached by geometry and method
+//
+
+#ifndef LIBND4J_HELPERS_RESIZE_PLANS_H
+#define LIBND4J_HELPERS_RESIZE_PLANS_H
+#include <ops/declarable/helpers/image_resize.h>
+
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace sd {
+namespace ops {
+namespace helpers {
+
+/**
+ * Everything that defines interpolation tables of one resize: sizes, method and its options. Fields which don't
+ * matter for given method are left zero
+ */
+struct ResizePlanKey {
+  int method = 0;
+  int coordinateMode = 0;
+  int nearestMode = 0;
+  bool alignCorners = false;
+  bool halfPixelCenters = false;
+  bool excludeOutside = false;
+  double coefficient = 0.0;
+  LongType inHeight = 0;
+  LongType inWidth = 0;
+  LongType outHeight = 0;
+  LongType outWidth = 0;
+  // x indices are stored premultiplied by width stride
+  LongType wStride = 0;
+
+  bool operator==(const ResizePlanKey &other) const;
+};
+
+struct ResizePlanKeyHash {
+  size_t operator()(const ResizePlanKey &key) const;
+};
+
+// rows of input contributing to one output row of area resize
+struct AreaRowPlan {
+  LongType start;
+  LongType end;
+  // offset of first scale within ResizePlan::areaScales
+  LongType scalesOffset;
+};
+
+/**
+ * Precomputed interpolation tables, only arrays used by plan's method are filled
+ */
+struct ResizePlan {
+  // bilinear
+  std::vector<BilinearInterpolationData> xs;
+  std::vector<BilinearInterpolationData> ys;
+
+  // nearest neighbor
+  std::vector<LongType> xIndices;
+  std::vector<LongType> yIndices;
+
+  // bicubic
+  std::vector<float> coefficients;
+  std::vector<WeightsAndIndices> xWais;
+  std::vector<WeightsAndIndices> yWais;
+
+  // area
+  std::vector<CachedInterpolation> xCached;
+  std::vector<AreaRowPlan> areaRows;
+  std::vector<float> areaScales;
+};
+
+/**
+ * This class keeps recently used resize plans, so resizing many images of the same geometry computes interpolation
+ * tables once. Plans are immutable after build and shared between concurrent callers. Number of plans is bounded,
+ * least recently used ones are evicted
+ */
+class SD_LIB_EXPORT ResizePlanCache {
+ private:
+  struct Entry {
+    std::shared_ptr<const ResizePlan> plan;
+    LongType lastUse;
+  };
+
+  std::mutex _lock;
+  std::unordered_map<ResizePlanKey, Entry, ResizePlanKeyHash> _plans;
+  LongType _clock = 0;
+  int _maxPlans = 64;
+  LongType _hits = 0;
+  LongType _misses = 0;
+
+  ResizePlanCache() = default;
+
+  void evict();
+
+ public:
+  static ResizePlanCache &getInstance();
+
+  /**
+   * This method returns cached plan for given key, or builds new one with given builder and keeps it
+   */
+  std::shared_ptr<const ResizePlan> plan(const ResizePlanKey &key, const std::function<void(ResizePlan &)> &builder);
+
+  void setMaxPlans(int maxPlans);
+  int maxPlans();
+  int size();
+  LongType hits();
+  LongType misses();
+
+  /**
+   * This method drops all plans and zeroes stats
+   */
+  void clear();
+};
+
+}  // namespace helpers
+}  // namespace ops
+}  // namespace sd
+#endif
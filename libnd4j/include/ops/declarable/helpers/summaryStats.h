@@ -0,0 +1,76 @@
+/* ******************************************************************************
+ *
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ *  See the NOTICE file distributed with this work for additional
+ *  information regarding copyright ownership.
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ******************************************************************************/
+
+//
+// Several summary statistics of one array computed in single pass over its data
+//
+
+#ifndef LIBND4J_HELPERS_SUMMARY_STATS_H
+#define LIBND4J_HELPERS_SUMMARY_STATS_H
+#include <array/NDArray.h>
+#include <system/op_boilerplate.h>
+
+#include <vector>
+
+namespace sd {
+namespace ops {
+namespace helpers {
+
+/**
+ * Requested statistics: every non-null array receives one value per element of reduced shape, arrays may have any
+ * shape of that length (e.g. with kept unit dimensions) and any numeric type
+ */
+struct SummaryStatsOutputs {
+  // number of reduced elements, scalar or one value per output element
+  NDArray* count = nullptr;
+  NDArray* sum = nullptr;
+  NDArray* squaredSum = nullptr;
+  NDArray* mean = nullptr;
+  NDArray* variance = nullptr;
+  // min and max skip NaNs
+  NDArray* min = nullptr;
+  NDArray* max = nullptr;
+  NDArray* nanCount = nullptr;
+  NDArray* infCount = nullptr;
+  // variance is divided by (count - 1) instead of count
+  bool biasCorrected = false;
+};
+
+/**
+ * This method computes requested statistics of input along axes (all dimensions if axes is empty). Input is read
+ * once, in cache-resident blocks: first read of block accumulates sum, sum of squares, min, max and NaN/Inf
+ * counts, second one accumulates squared deviations from block mean; block moments are merged with Chan et al.
+ * formula. Sum and sum of squares outputs are the raw accumulated sums.
+ * Arrays whose kept dimensions aren't adjacent are permuted into contiguous copy first.
+ */
+SD_LIB_HIDDEN void summaryStats(LaunchContext* context, NDArray* input, const std::vector<LongType>& axes,
+                                const SummaryStatsOutputs& outputs);
+
+/**
+ * This method turns sufficient statistics into mean and variance in one pass:
+ * mean = sum / count + shift, variance = squaredSum / count - (sum / count)^2
+ *
+ * counts - scalar or array of the same length as sums
+ */
+SD_LIB_HIDDEN void normalizeMoments(LaunchContext* context, NDArray* counts, NDArray* sums, NDArray* squaredSums,
+                                    double shift, NDArray* means, NDArray* variances);
+
+}  // namespace helpers
+}  // namespace ops
+}  // namespace sd
+#endif
@@ -46,6 +46,10 @@ SD_LIB_HIDDEN void updaterAdam(LaunchContext* context, NDArray& gradient, NDArra
                                NDArray& initStateM, NDArray& update, NDArray& stateU, NDArray& stateM,
                                const double dLr, const double dBeta1, const double dBeta2, const double dEpsilon,
                                const int nIteration);
+SD_LIB_HIDDEN void updaterSparseAdam(LaunchContext* context, NDArray& indices, NDArray& gradient, NDArray& stateU,
+                                     NDArray& stateM, NDArray& update, NDArray* lastIteration, const double dLr,
+                                     const double dBeta1, const double dBeta2, const double dEpsilon,
+                                     const int nIteration);
 SD_LIB_HIDDEN void updaterAdaDelta(LaunchContext* context, NDArray& gradient, NDArray& initStateMsg,
                                    NDArray& initStateMsdx, NDArray& update, NDArray& stateMsg, NDArray& stateMsdx,
                                    const double dRho, const double dEpsilon);
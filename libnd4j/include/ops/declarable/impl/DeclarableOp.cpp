@@ -23,12 +23,17 @@
 #include <exceptions/datatype_exception.h>
 #include <exceptions/graph_exception.h>
 #include <graph/exceptions/unresolved_input_exception.h>
+#include <helpers/HardwareCounters.h>
+#include <helpers/OpLatencyHistograms.h>
 #include <helpers/ShapeUtils.h>
+#include <helpers/TimelineTracer.h>
 #include <helpers/StringUtils.h>
 #include <ops/declarable/DeclarableOp.h>
 #include <ops/declarable/OpRegistrator.h>
+#include <ops/declarable/ShapeFunctionCache.h>
 
 #include <cstdarg>
+#include <memory>
 
 
 namespace sd {
@@ -265,7 +270,14 @@ int sd::ops::DeclarableOp::prepareOutputs(Context &ctx) {
     }
 
 
-    auto outSha = this->calculateOutputShape(&inSha, ctx);
+    // repeated calls with the same shapes and arguments reuse shapes computed earlier
+    std::vector<sd::LongType> shapeKey;
+    auto cacheable = ShapeFunctionCache::isEnabled() && ShapeFunctionCache::buildKey(this, ctx, shapeKey);
+    auto outSha = cacheable ? ShapeFunctionCache::getInstance().lookup(shapeKey) : nullptr;
+    if (outSha == nullptr) {
+      outSha = this->calculateOutputShape(&inSha, ctx);
+      if (cacheable) ShapeFunctionCache::getInstance().store(shapeKey, outSha);
+    }
     if (sd::Environment::getInstance().isDebugAndVerbose()) {
       sd_printf("Node_%i: %s\n", ctx.nodeId(), this->getOpDescriptor()->getOpName()->c_str());
       sd_printf("Input shapes:\n",0);
@@ -452,7 +464,10 @@ void sd::ops::DeclarableOp::DeclarableOp::traceExecIfNeeded(Context &block) {
       outputShapeBuffers->push_back(block.fastpath_out()[i]->shapeInfo());
     }
 
-    OpExecTrace *opExecTrace = new OpExecTrace(inputShapeBuffers,outputShapeBuffers, getOpName());
+    OpExecTrace *opExecTrace = new OpExecTrace(inputShapeBuffers, outputShapeBuffers, getOpName(),
+                                               block.getIArguments(), block.getTArguments(), block.getBArguments(),
+                                               block.getSArguments(), -1);
+    opExecTrace->setDArgs(*block.getDArguments());
     OpRegistrator::getInstance().registerOpExec(opExecTrace);
   }
 }
@@ -642,8 +657,53 @@ sd::Status sd::ops::DeclarableOp::validateDataTypes(Context &block) {
   return sd::Status::OK;
 }
 
+static sd::NDArray *contextArray(sd::graph::Context *block, int index, bool output) {
+  sd::NDArray *array = nullptr;
+  if (block->isFastPath()) {
+    auto &arrays = output ? block->fastpath_out() : block->fastpath_in();
+    if (static_cast<size_t>(index) < arrays.size()) array = arrays[index];
+  } else if (block->getVariableSpace() != nullptr) {
+    if (output) {
+      if (block->getVariableSpace()->hasVariable(block->nodeId(), index))
+        array = block->getVariableSpace()->getVariable(block->nodeId(), index)->getNDArray();
+    } else {
+      array = block->variable(index)->getNDArray();
+    }
+  }
+
+  return array;
+}
+
+static sd::LongType arrayBytes(sd::graph::Context *block, int index, bool output) {
+  auto array = contextArray(block, index, output);
+  return array == nullptr || array->isEmpty() ? 0 : array->lengthOf() * array->sizeOfT();
+}
+
+// legacy op wrappers share single name, their calls are recorded by NativeOpExecutioner per op type and number
+static bool isLegacyWrapper(sd::ops::DeclarableOp *op) {
+  static std::string legacyName("LegacyOp");
+  static const auto legacyHash = sd::ops::HashHelper::getInstance().getLongHash(legacyName);
+  return op->getOpHash() == legacyHash;
+}
+
+static void recordLatency(sd::ops::DeclarableOp *op, sd::graph::Context *block, int numOutputs, sd::LongType nanos) {
+  if (isLegacyWrapper(op)) return;
+
+  sd::LongType bytesIn = 0, bytesOut = 0;
+  for (int e = 0; e < block->width(); e++) bytesIn += arrayBytes(block, e, false);
+
+  for (int e = 0; e < numOutputs; e++) bytesOut += arrayBytes(block, e, true);
+
+  sd::OpLatencyHistograms::getInstance().record(op->getOpHash(), *op->getOpName(), nanos, bytesIn, bytesOut);
+}
+
 sd::Status sd::ops::DeclarableOp::execute(Context *block) {
   sd_debug("Executing op: [%s]\n", this->getOpName()->c_str());
+  TimelineSpan timelineSpan(TimelineCategory::OP, this->getOpName()->c_str());
+
+  auto recordLatencies = OpLatencyHistograms::isEnabled();
+  std::chrono::steady_clock::time_point latencyStart;
+  if (recordLatencies) latencyStart = std::chrono::steady_clock::now();
 
   std::chrono::time_point<std::chrono::system_clock> timeEnter, timeStart, timeEnd;
   sd::LongType prepTime, outerTime;
@@ -671,20 +731,36 @@ sd::Status sd::ops::DeclarableOp::execute(Context *block) {
   sd::Status status;
   bool hasHelper = false;
 
+  std::unique_ptr<HardwareCounterScope> countersScope;
+  if (HardwareCounters::isEnabled() && !isLegacyWrapper(this)) {
+    auto input = block->width() > 0 ? contextArray(block, 0, false) : nullptr;
+    countersScope.reset(
+        new HardwareCounterScope(this->getOpHash(), this->getOpName(), input == nullptr ? nullptr : input->shapeInfo()));
+  }
+
   // platform helpers use might be forbidden for various reasons, so we'll check it out first
   if (block->helpersAllowed() && sd::Environment::getInstance().helpersAllowed()) {
     // if we have platform-specific helper for this op - invoke it
-    if (OpRegistrator::getInstance().hasHelper(this->getOpHash(), block->engine())) {
-      auto helper = OpRegistrator::getInstance().getPlatformHelper(this->getOpHash(), block->engine());
-      if (helper->isUsable(*block)) {
-        status = helper->invokeHelper(*block);
-        hasHelper = true;
-      }
+    auto helper = OpRegistrator::getInstance().findPlatformHelper(this->getOpHash(), block->engine());
+    if (helper != nullptr && helper->isUsable(*block)) {
+      status = helper->invokeHelper(*block);
+      hasHelper = true;
     }
   }
 
 
   if (!hasHelper) status = this->validateAndExecute(*block);
+
+  HardwareCounterValues countersDelta;
+  auto hasCounters = countersScope != nullptr && countersScope->current(countersDelta);
+  countersScope.reset();
+
+  if (recordLatencies) {
+    auto nanos =
+        std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - latencyStart).count();
+    recordLatency(this, block, numOutputs, nanos);
+  }
+
   // optionally saving execution time
   if (Environment::getInstance().isProfiling()) {
     timeEnd = std::chrono::system_clock::now();
@@ -706,6 +782,11 @@ sd::Status sd::ops::DeclarableOp::execute(Context *block) {
         p->nodeById(block->nodeId())->setPreparationTime(prepTime);
         p->nodeById(block->nodeId())->setExecutionTime(outerTime);
         p->nodeById(block->nodeId())->setTotalSize(memoryUsed);
+        if (hasCounters)
+          p->nodeById(block->nodeId())
+              ->setHardwareCounters(countersDelta.get(HardwareCounter::CYCLES),
+                                    countersDelta.get(HardwareCounter::INSTRUCTIONS),
+                                    countersDelta.get(HardwareCounter::CACHE_MISSES));
       }
     }
   }
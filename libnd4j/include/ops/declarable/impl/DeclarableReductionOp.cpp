@@ -31,7 +31,8 @@ namespace ops {
 DeclarableReductionOp::DeclarableReductionOp(int numInputs, int numOutputs, const char* opName, bool allowsInplace,
                                              int tArgs, int iArgs)
     : DeclarableOp(numInputs, numOutputs, opName, allowsInplace, tArgs, iArgs) {
-  //
+  // axis may be passed as input array
+  getOpDescriptor()->setDataDependentShape(true);
 }
 
 ShapeList* DeclarableReductionOp::calculateOutputShape(ShapeList* inputShape, Context& block) {
@@ -23,13 +23,16 @@
 
 namespace sd {
 namespace ops {
+// all legacy ops share one descriptor name, and reductions read axis from input, so their shapes aren't cached
 LegacyOp::LegacyOp(int numInputs) : DeclarableOp(numInputs, 1, "LegacyOp", false) {
   _numInputs = numInputs;
+  getOpDescriptor()->setDataDependentShape(true);
 }
 
 LegacyOp::LegacyOp(int numInputs, int opNum) : DeclarableOp(numInputs, 1, "LegacyOp", false) {
   _opNum = opNum;
   _numInputs = numInputs;
+  getOpDescriptor()->setDataDependentShape(true);
 }
 }  // namespace ops
 }  // namespace sd
@@ -0,0 +1,195 @@
+/* ******************************************************************************
+ *
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ *  See the NOTICE file distributed with this work for additional
+ *  information regarding copyright ownership.
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ******************************************************************************/
+
+//
+// Batch of custom op invocations executed with single native call
+//
+#include <execution/Threads.h>
+#include <math/templatemath.h>
+#include <ops/declarable/DeclarableOp.h>
+#include <ops/declarable/OpCommandBuffer.h>
+#include <ops/declarable/OpRegistrator.h>
+
+#include <cstring>
+
+namespace sd {
+namespace ops {
+
+// sequential reader over command buffer, throws instead of reading past the end
+class CommandBufferReader {
+ private:
+  const LongType *_buffer;
+  LongType _length;
+  LongType _position = 0;
+
+ public:
+  CommandBufferReader(const LongType *buffer, LongType length) : _buffer(buffer), _length(length) {}
+
+  LongType next() {
+    if (_position >= _length) THROW_EXCEPTION("OpCommandBuffer: buffer is truncated");
+
+    return _buffer[_position++];
+  }
+
+  LongType count() {
+    auto value = next();
+    if (value < 0 || value > _length - _position) THROW_EXCEPTION("OpCommandBuffer: bad element count");
+
+    return value;
+  }
+
+  bool exhausted() const { return _position == _length; }
+};
+
+OpCommandBuffer::OpCommandBuffer(const LongType *buffer, LongType length, NDArray **arrays, LongType numArrays) {
+  if (buffer == nullptr || length < 3) THROW_EXCEPTION("OpCommandBuffer: buffer is empty");
+
+  CommandBufferReader reader(buffer, length);
+  if (reader.next() != VERSION) THROW_EXCEPTION("OpCommandBuffer: unsupported buffer version");
+
+  _hasDependencies = (reader.next() & FLAG_DEPENDENCIES) != 0;
+
+  auto numCommands = reader.count();
+  _commands.resize(numCommands);
+
+  auto handle = [&](LongType index) -> NDArray * {
+    if (index < 0 || index >= numArrays || arrays == nullptr)
+      THROW_EXCEPTION("OpCommandBuffer: array handle is out of range");
+
+    return arrays[index];
+  };
+
+  for (LongType c = 0; c < numCommands; c++) {
+    auto &command = _commands[c];
+    auto hash = reader.next();
+    command.op = OpRegistrator::getInstance().getOperation(hash);
+    if (command.op == nullptr) THROW_EXCEPTION("OpCommandBuffer: unknown op hash");
+
+    command.inplace = (reader.next() & FLAG_INPLACE) != 0;
+
+    auto numInputs = reader.count();
+    auto numOutputs = reader.count();
+    auto numIArgs = reader.count();
+    auto numTArgs = reader.count();
+    auto numBArgs = reader.count();
+    auto numDArgs = reader.count();
+    auto numDependencies = reader.count();
+
+    for (LongType e = 0; e < numInputs; e++) command.inputs.emplace_back(handle(reader.next()));
+
+    for (LongType e = 0; e < numOutputs; e++) command.outputs.emplace_back(handle(reader.next()));
+
+    for (LongType e = 0; e < numIArgs; e++) command.iArgs.emplace_back(reader.next());
+
+    for (LongType e = 0; e < numTArgs; e++) {
+      auto bits = reader.next();
+      double value;
+      memcpy(&value, &bits, sizeof(value));
+      command.tArgs.emplace_back(value);
+    }
+
+    for (LongType e = 0; e < numBArgs; e++) command.bArgs.emplace_back(reader.next() != 0);
+
+    for (LongType e = 0; e < numDArgs; e++) command.dArgs.emplace_back(static_cast<DataType>(reader.next()));
+
+    for (LongType e = 0; e < numDependencies; e++) {
+      auto dependency = reader.next();
+      if (dependency < 0 || dependency >= c)
+        THROW_EXCEPTION("OpCommandBuffer: commands may depend only on earlier commands");
+
+      command.dependencies.emplace_back(static_cast<int>(dependency));
+      command.level = sd::math::sd_max<int>(command.level, _commands[dependency].level + 1);
+    }
+
+    _numLevels = sd::math::sd_max<int>(_numLevels, command.level + 1);
+  }
+
+  if (!reader.exhausted()) THROW_EXCEPTION("OpCommandBuffer: buffer has trailing data");
+}
+
+Status OpCommandBuffer::executeCommand(Command &command, std::string &error) {
+  try {
+    return command.op->execute(command.inputs, command.outputs, command.tArgs, command.iArgs, command.bArgs,
+                               command.dArgs, command.inplace);
+  } catch (std::exception &e) {
+    error = e.what();
+    return Status::KERNEL_FAILURE;
+  }
+}
+
+Status OpCommandBuffer::execute(Status *statuses, bool parallel) {
+  _lastError.clear();
+  auto numCommands = size();
+  for (int e = 0; e < numCommands; e++) statuses[e] = Status::MAYBE;
+
+  std::vector<std::string> errors(numCommands);
+
+  if (!_hasDependencies) {
+    for (int e = 0; e < numCommands; e++) {
+      statuses[e] = executeCommand(_commands[e], errors[e]);
+      if (statuses[e] != Status::OK) {
+        _lastError = errors[e];
+        return statuses[e];
+      }
+    }
+
+    return Status::OK;
+  }
+
+  auto runnable = [&](int index) -> bool {
+    for (auto dependency : _commands[index].dependencies)
+      if (statuses[dependency] != Status::OK) return false;
+
+    return true;
+  };
+
+  if (!parallel || _numLevels == numCommands) {
+    // commands are stored in topological order already
+    for (int e = 0; e < numCommands; e++)
+      if (runnable(e)) statuses[e] = executeCommand(_commands[e], errors[e]);
+  } else {
+    std::vector<std::vector<int>> levels(_numLevels);
+    for (int e = 0; e < numCommands; e++) levels[_commands[e].level].emplace_back(e);
+
+    for (auto &level : levels) {
+      auto func = PRAGMA_THREADS_FOR {
+        for (auto e = start; e < stop; e++) {
+          auto index = level[e];
+          if (runnable(index)) statuses[index] = executeCommand(_commands[index], errors[index]);
+        }
+      };
+
+      // each command is a whole op call, so every one of them gets its own thread regardless of length
+      auto numCommandsInLevel = static_cast<LongType>(level.size());
+      samediff::Threads::parallel_tad(
+          func, 0, numCommandsInLevel, 1,
+          sd::math::sd_min<LongType>(numCommandsInLevel, Environment::getInstance().maxMasterThreads()));
+    }
+  }
+
+  for (int e = 0; e < numCommands; e++) {
+    if (statuses[e] != Status::OK && statuses[e] != Status::MAYBE) {
+      _lastError = errors[e];
+      return statuses[e];
+    }
+  }
+
+  return Status::OK;
+}
+}  // namespace ops
+}  // namespace sd
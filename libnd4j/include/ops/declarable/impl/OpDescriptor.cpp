@@ -173,6 +173,11 @@ OpDescriptor* OpDescriptor::setSameMode(const bool reallySame) {
   return this;
 }
 
+OpDescriptor* OpDescriptor::setDataDependentShape(const bool reallyDependent) {
+  _dataDependentShape = reallyDependent;
+  return this;
+}
+
 OpDescriptor* OpDescriptor::setAllowedInputTypes(int index, const std::vector<DataType>& dtype) {
   _inputTypes[index] = dtype;
   return this;
@@ -245,6 +250,8 @@ bool OpDescriptor::checkOutputMatch(int index, DataType dataType) {
 
 bool OpDescriptor::isSameMode() { return _sameMode; }
 
+bool OpDescriptor::isDataDependentShape() { return _dataDependentShape; }
+
 bool OpDescriptor::isInherit(int index) {
   if (std::find(_allowedOuts.begin(), _allowedOuts.end(), INHERIT) != _allowedOuts.end()) return true;
   if (_outputTypes.count(index) > 0) {
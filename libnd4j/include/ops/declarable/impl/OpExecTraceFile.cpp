@@ -0,0 +1,229 @@
+/* ******************************************************************************
+ *
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ *  See the NOTICE file distributed with this work for additional
+ *  information regarding copyright ownership.
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ******************************************************************************/
+
+//
+// Text serialization of OpExecTrace entries, used for offline workload replay
+//
+#include <helpers/shape.h>
+#include <ops/declarable/OpExecTraceFile.h>
+
+#include <fstream>
+#include <iomanip>
+#include <limits>
+#include <sstream>
+
+namespace sd {
+namespace ops {
+static const char *TRACE_HEADER = "# libnd4j op trace v1";
+
+static void writeShapes(std::ostream &stream, const char *tag, const std::vector<const LongType *> *shapes) {
+  if (shapes == nullptr) return;
+
+  for (auto shapeInfo : *shapes) {
+    if (shapeInfo == nullptr) continue;
+
+    auto length = shape::shapeInfoLength(shape::rank(shapeInfo));
+    stream << tag << " " << length;
+    for (LongType e = 0; e < length; e++) stream << " " << shapeInfo[e];
+
+    stream << "\n";
+  }
+}
+
+void OpExecTraceFile::write(std::ostream &stream, const std::vector<OpExecTrace *> &traces) {
+  stream << TRACE_HEADER << "\n";
+  stream << std::setprecision(std::numeric_limits<double>::max_digits10);
+
+  for (auto trace : traces) {
+    if (trace == nullptr) continue;
+
+    stream << "op " << (trace->opName == nullptr || trace->opName->empty() ? "unknown" : *trace->opName) << " "
+           << trace->opType << "\n";
+
+    writeShapes(stream, "in", trace->inputShapeBuffers);
+    writeShapes(stream, "out", trace->outputShapeBuffers);
+
+    stream << "i " << trace->iArgs.size();
+    for (auto v : trace->iArgs) stream << " " << v;
+
+    stream << "\nt " << trace->tArgs.size();
+    for (auto v : trace->tArgs) stream << " " << v;
+
+    stream << "\nb " << trace->bArgs.size();
+    for (auto v : trace->bArgs) stream << " " << (v ? 1 : 0);
+
+    stream << "\nd " << trace->dArgs.size();
+    for (auto v : trace->dArgs) stream << " " << static_cast<int>(v);
+
+    stream << "\ns " << trace->sArguments.size();
+    for (const auto &v : trace->sArguments) stream << " " << v.length() << ":" << v;
+
+    stream << "\nend\n";
+  }
+}
+
+void OpExecTraceFile::save(const std::string &path, const std::vector<OpExecTrace *> &traces) {
+  std::ofstream stream(path);
+  if (!stream.good()) {
+    std::string errorMessage;
+    errorMessage += "OpExecTraceFile::save - can't open file for writing: ";
+    errorMessage += path;
+    THROW_EXCEPTION(errorMessage.c_str());
+  }
+
+  write(stream, traces);
+}
+
+static const LongType *readShape(std::istream &line) {
+  LongType length = 0;
+  line >> length;
+  if (!line || length < 4 || length > shape::shapeInfoLength(SD_MAX_RANK))
+    THROW_EXCEPTION("OpExecTraceFile::read - malformed shape record");
+
+  auto shapeInfo = new LongType[length];
+  for (LongType e = 0; e < length; e++) line >> shapeInfo[e];
+
+  if (!line || shape::shapeInfoLength(shape::rank(shapeInfo)) != length) {
+    delete[] shapeInfo;
+    THROW_EXCEPTION("OpExecTraceFile::read - malformed shape record");
+  }
+
+  return shapeInfo;
+}
+
+static OpExecTrace *newTrace(const std::string &name, int opType) {
+  auto trace = new OpExecTrace(new std::vector<const LongType *>(), new std::vector<const LongType *>(),
+                               new std::string(name));
+  trace->opType = opType;
+  return trace;
+}
+
+std::vector<OpExecTrace *> OpExecTraceFile::read(std::istream &stream) {
+  std::vector<OpExecTrace *> traces;
+  OpExecTrace *current = nullptr;
+  std::string text;
+
+  try {
+    while (std::getline(stream, text)) {
+      if (text.empty() || text[0] == '#') continue;
+
+      std::istringstream line(text);
+      std::string tag;
+      line >> tag;
+
+      if (tag == "op") {
+        if (current != nullptr) THROW_EXCEPTION("OpExecTraceFile::read - record isn't terminated with end");
+
+        std::string name;
+        int opType = -1;
+        line >> name >> opType;
+        current = newTrace(name, opType);
+        continue;
+      }
+
+      if (current == nullptr) THROW_EXCEPTION("OpExecTraceFile::read - record doesn't start with op");
+
+      size_t count = 0;
+      if (tag == "in") {
+        current->inputShapeBuffers->emplace_back(readShape(line));
+      } else if (tag == "out") {
+        current->outputShapeBuffers->emplace_back(readShape(line));
+      } else if (tag == "i") {
+        line >> count;
+        current->iArgs.resize(count);
+        for (size_t e = 0; e < count; e++) line >> current->iArgs[e];
+      } else if (tag == "t") {
+        line >> count;
+        current->tArgs.resize(count);
+        for (size_t e = 0; e < count; e++) line >> current->tArgs[e];
+      } else if (tag == "b") {
+        line >> count;
+        for (size_t e = 0; e < count; e++) {
+          int v = 0;
+          line >> v;
+          current->bArgs.emplace_back(v != 0);
+        }
+      } else if (tag == "d") {
+        line >> count;
+        for (size_t e = 0; e < count; e++) {
+          int v = 0;
+          line >> v;
+          current->dArgs.emplace_back(static_cast<DataType>(v));
+        }
+      } else if (tag == "s") {
+        line >> count;
+        for (size_t e = 0; e < count; e++) {
+          size_t length = 0;
+          char separator = 0;
+          line >> length >> separator;
+          std::string value(length, ' ');
+          line.read(&value[0], length);
+          current->sArguments.emplace_back(value);
+        }
+      } else if (tag == "end") {
+        traces.emplace_back(current);
+        current = nullptr;
+        continue;
+      } else {
+        THROW_EXCEPTION("OpExecTraceFile::read - unknown record tag");
+      }
+
+      if (!line) THROW_EXCEPTION("OpExecTraceFile::read - malformed record");
+    }
+
+    if (current != nullptr) THROW_EXCEPTION("OpExecTraceFile::read - last record isn't terminated with end");
+  } catch (...) {
+    if (current != nullptr) traces.emplace_back(current);
+
+    release(traces);
+    throw;
+  }
+
+  return traces;
+}
+
+std::vector<OpExecTrace *> OpExecTraceFile::load(const std::string &path) {
+  std::ifstream stream(path);
+  if (!stream.good()) {
+    std::string errorMessage;
+    errorMessage += "OpExecTraceFile::load - can't open file: ";
+    errorMessage += path;
+    THROW_EXCEPTION(errorMessage.c_str());
+  }
+
+  return read(stream);
+}
+
+void OpExecTraceFile::release(std::vector<OpExecTrace *> &traces) {
+  for (auto trace : traces) {
+    for (auto shapes : {trace->inputShapeBuffers, trace->outputShapeBuffers}) {
+      if (shapes == nullptr) continue;
+
+      for (auto shapeInfo : *shapes) delete[] shapeInfo;
+
+      delete shapes;
+    }
+
+    delete trace->opName;
+    delete trace;
+  }
+
+  traces.clear();
+}
+}  // namespace ops
+}  // namespace sd
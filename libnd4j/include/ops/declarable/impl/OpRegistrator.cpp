@@ -56,6 +56,7 @@ OpRegistrator& OpRegistrator::getInstance() {
 }
 
 void OpRegistrator::updateMSVC(LongType newHash, std::string& oldName) {
+  std::lock_guard<std::mutex> lock(_locker);
   std::pair<LongType, std::string> pair(newHash, oldName);
   _msvc.insert(pair);
 }
@@ -126,14 +127,22 @@ const char* OpRegistrator::getAllCustomOperations() {
   return _opsList.c_str();
 }
 
-bool OpRegistrator::registerOperation(const char* name, DeclarableOp* op) {
-  std::string str(name);
-  std::pair<std::string, DeclarableOp*> pair(str, op);
+void OpRegistrator::insertOperation(const std::string& name, DeclarableOp* op) {
+  std::pair<std::string, DeclarableOp*> pair(name, op);
   _declarablesD.insert(pair);
 
+  std::string str(name);
   auto hash = HashHelper::getInstance().getLongHash(str);
   std::pair<LongType, DeclarableOp*> pair2(hash, op);
   _declarablesLD.insert(pair2);
+
+  // late registration: lookup table was frozen already
+  if (_opsTable.load(std::memory_order_relaxed) != nullptr) rebuildOperations();
+}
+
+bool OpRegistrator::registerOperation(const char* name, DeclarableOp* op) {
+  std::lock_guard<std::mutex> lock(_locker);
+  insertOperation(name, op);
   return true;
 }
 
@@ -163,11 +172,14 @@ std::vector<OpExecTrace *>  * OpRegistrator::execTrace() {
  * @param op
  */
 bool OpRegistrator::registerOperation(DeclarableOp* op) {
+  std::lock_guard<std::mutex> lock(_locker);
   _uniqueD.emplace_back(op);
-  return registerOperation(op->getOpName()->c_str(), op);
+  insertOperation(*op->getOpName(), op);
+  return true;
 }
 
 void OpRegistrator::registerHelper(platforms::PlatformHelper* op) {
+  std::lock_guard<std::mutex> lock(_locker);
   std::pair<LongType, samediff::Engine> p = {op->hash(), op->engine()};
   if (_helpersLH.count(p) > 0) THROW_EXCEPTION("Tried to double register PlatformHelper");
 
@@ -181,6 +193,25 @@ void OpRegistrator::registerHelper(platforms::PlatformHelper* op) {
 
   std::pair<std::pair<LongType, samediff::Engine>, platforms::PlatformHelper*> pair2(p, op);
   _helpersLH.insert(pair2);
+
+  if (_helpersTable.load(std::memory_order_relaxed) != nullptr) rebuildHelpers();
+}
+
+OpRegistrator::OpsTable* OpRegistrator::rebuildOperations() {
+  std::vector<std::pair<LongType, DeclarableOp*>> entries(_declarablesLD.begin(), _declarablesLD.end());
+  _opsTables.emplace_back(new OpsTable(entries));
+  auto table = _opsTables.back().get();
+  _opsTable.store(table, std::memory_order_release);
+  return table;
+}
+
+OpRegistrator::HelpersTable* OpRegistrator::rebuildHelpers() {
+  std::vector<std::pair<std::pair<LongType, samediff::Engine>, platforms::PlatformHelper*>> entries(
+      _helpersLH.begin(), _helpersLH.end());
+  _helpersTables.emplace_back(new HelpersTable(entries));
+  auto table = _helpersTables.back().get();
+  _helpersTable.store(table, std::memory_order_release);
+  return table;
 }
 
 
@@ -197,41 +228,65 @@ DeclarableOp* OpRegistrator::getOperation(const char* name) {
  * @return
  */
 DeclarableOp* OpRegistrator::getOperation(LongType hash) {
-  if (!_declarablesLD.count(hash)) {
-    if (!_msvc.count(hash)) {
-      sd_printf("Unknown D operation requested by hash: [%lld]\n", hash);
-      return nullptr;
-    } else {
-      _locker.lock();
+  auto table = _opsTable.load(std::memory_order_acquire);
+  if (table != nullptr) {
+    auto op = table->find(hash);
+    if (op != nullptr) return *op;
+  }
+
+  std::lock_guard<std::mutex> lock(_locker);
+  return lookupOperationSlow(hash);
+}
 
-      auto str = _msvc.at(hash);
-      auto op = _declarablesD.at(str);
-      auto oHash = op->getOpDescriptor()->getHash();
+DeclarableOp* OpRegistrator::lookupOperationSlow(LongType hash) {
+  // first lookup freezes everything registered statically
+  if (_opsTable.load(std::memory_order_relaxed) == nullptr) rebuildOperations();
 
-      std::pair<LongType, DeclarableOp*> pair(oHash, op);
-      _declarablesLD.insert(pair);
+  auto it = _declarablesLD.find(hash);
+  if (it != _declarablesLD.end()) return it->second;
 
-      _locker.unlock();
-    }
+  // synonyms that were declared before their original op got registered
+  auto msvc = _msvc.find(hash);
+  if (msvc == _msvc.end() || _declarablesD.count(msvc->second) == 0) {
+    sd_printf("Unknown D operation requested by hash: [%lld]\n", hash);
+    return nullptr;
   }
 
-  return _declarablesLD.at(hash);
+  auto op = _declarablesD.at(msvc->second);
+  std::pair<LongType, DeclarableOp*> pair(hash, op);
+  _declarablesLD.insert(pair);
+  rebuildOperations();
+  return op;
 }
 
 DeclarableOp* OpRegistrator::getOperation(std::string& name) {
-  if (!_declarablesD.count(name)) {
+  std::lock_guard<std::mutex> lock(_locker);
+  auto it = _declarablesD.find(name);
+  if (it == _declarablesD.end()) {
     sd_debug("Unknown operation requested: [%s]\n", name.c_str());
     return nullptr;
   }
 
-  return _declarablesD.at(name);
+  return it->second;
+}
+
+platforms::PlatformHelper* OpRegistrator::findPlatformHelper(LongType hash, samediff::Engine engine) {
+  auto table = _helpersTable.load(std::memory_order_acquire);
+  if (table == nullptr) {
+    std::lock_guard<std::mutex> lock(_locker);
+    table = _helpersTable.load(std::memory_order_relaxed);
+    if (table == nullptr) table = rebuildHelpers();
+  }
+
+  auto helper = table->find(std::make_pair(hash, engine));
+  return helper == nullptr ? nullptr : *helper;
 }
 
 platforms::PlatformHelper* OpRegistrator::getPlatformHelper(LongType hash, samediff::Engine engine) {
-  std::pair<LongType, samediff::Engine> p = {hash, engine};
-  if (_helpersLH.count(p) == 0) THROW_EXCEPTION("Requested helper can't be found");
+  auto helper = findPlatformHelper(hash, engine);
+  if (helper == nullptr) THROW_EXCEPTION("Requested helper can't be found");
 
-  return _helpersLH[p];
+  return helper;
 }
 
 #if defined(HAVE_VEDA)
@@ -244,13 +299,16 @@ sd::ops::platforms::PlatformHelperLegacy* OpRegistrator::getPlatformHelperLegacy
 #endif
 
 bool OpRegistrator::hasHelper(LongType hash, samediff::Engine engine) {
-  std::pair<LongType, samediff::Engine> p = {hash, engine};
-  return _helpersLH.count(p) > 0;
+  return findPlatformHelper(hash, engine) != nullptr;
 }
 
-int OpRegistrator::numberOfOperations() { return (int)_declarablesLD.size(); }
+int OpRegistrator::numberOfOperations() {
+  std::lock_guard<std::mutex> lock(_locker);
+  return (int)_declarablesLD.size();
+}
 
 std::vector<LongType> OpRegistrator::getAllHashes() {
+  std::lock_guard<std::mutex> lock(_locker);
   std::vector<LongType> result;
 
   for (auto& v : _declarablesLD) {
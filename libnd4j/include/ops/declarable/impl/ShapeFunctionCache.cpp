@@ -0,0 +1,211 @@
+/* ******************************************************************************
+ *
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ *  See the NOTICE file distributed with this work for additional
+ *  information regarding copyright ownership.
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ******************************************************************************/
+
+//
+// Memoization of DeclarableOp::calculateOutputShape results
+//
+#include <array/DataTypeUtils.h>
+#include <helpers/ConstantShapeHelper.h>
+#include <math/templatemath.h>
+#include <ops/declarable/DeclarableOp.h>
+#include <ops/declarable/ShapeFunctionCache.h>
+
+#include <cstring>
+
+namespace sd {
+namespace ops {
+
+std::atomic<bool> ShapeFunctionCache::_enabled(true);
+
+ShapeFunctionCache &ShapeFunctionCache::getInstance() {
+  static ShapeFunctionCache instance;
+  return instance;
+}
+
+void ShapeFunctionCache::setEnabled(bool enabled) { _enabled.store(enabled, std::memory_order_relaxed); }
+
+size_t ShapeFunctionCache::KeyHash::operator()(const std::vector<LongType> &key) const {
+  uint64_t hash = 14695981039346656037ULL;
+  for (auto v : key) {
+    hash ^= static_cast<uint64_t>(v);
+    hash *= 1099511628211ULL;
+  }
+
+  return static_cast<size_t>(hash ^ (hash >> 32));
+}
+
+static void appendShapeInfo(std::vector<LongType> &key, const LongType *shapeInfo) {
+  if (shapeInfo == nullptr) {
+    key.push_back(-1);
+    return;
+  }
+
+  auto length = shape::shapeInfoLength(shape::rank(shapeInfo));
+  key.push_back(length);
+  key.insert(key.end(), shapeInfo, shapeInfo + length);
+}
+
+static LongType doubleBits(double value) {
+  LongType bits;
+  memcpy(&bits, &value, sizeof(bits));
+  return bits;
+}
+
+bool ShapeFunctionCache::buildKey(DeclarableOp *op, graph::Context &ctx, std::vector<LongType> &key) {
+  if (!ctx.isFastPath() || op->getOpDescriptor()->isDataDependentShape()) return false;
+
+  key.clear();
+  key.push_back(op->getOpHash());
+
+  auto &inputs = ctx.fastpath_in();
+  key.push_back(static_cast<LongType>(inputs.size()));
+  for (auto array : inputs) {
+    if (array == nullptr) {
+      key.push_back(-1);
+      continue;
+    }
+
+    // shapes of string ops depend on string contents
+    if (array->isS()) return false;
+
+    appendShapeInfo(key, array->shapeInfo());
+  }
+
+  // some shape functions just return shapes of provided outputs
+  auto &outputs = ctx.fastpath_out();
+  key.push_back(static_cast<LongType>(outputs.size()));
+  for (auto array : outputs) appendShapeInfo(key, array == nullptr ? nullptr : array->shapeInfo());
+
+  auto iArgs = ctx.getIArguments();
+  key.push_back(static_cast<LongType>(iArgs->size()));
+  key.insert(key.end(), iArgs->begin(), iArgs->end());
+
+  auto tArgs = ctx.getTArguments();
+  key.push_back(static_cast<LongType>(tArgs->size()));
+  for (auto v : *tArgs) key.push_back(doubleBits(v));
+
+  auto bArgs = ctx.getBArguments();
+  key.push_back(static_cast<LongType>(bArgs->size()));
+  for (auto v : *bArgs) key.push_back(v ? 1 : 0);
+
+  auto dArgs = ctx.getDArguments();
+  key.push_back(static_cast<LongType>(dArgs->size()));
+  for (auto v : *dArgs) key.push_back(static_cast<LongType>(v));
+
+  auto sArgs = ctx.getSArguments();
+  key.push_back(static_cast<LongType>(sArgs->size()));
+  for (auto &v : *sArgs) {
+    // strings are packed by 8 chars, zero padded
+    key.push_back(static_cast<LongType>(v.size()));
+    for (size_t e = 0; e < v.size(); e += sizeof(LongType)) {
+      LongType packed = 0;
+      memcpy(&packed, v.data() + e, sd::math::sd_min<size_t>(sizeof(LongType), v.size() - e));
+      key.push_back(packed);
+    }
+  }
+
+  auto axis = ctx.getAxis();
+  key.push_back(static_cast<LongType>(axis->size()));
+  key.insert(key.end(), axis->begin(), axis->end());
+
+  return true;
+}
+
+ShapeFunctionCache::Shard &ShapeFunctionCache::shardFor(const std::vector<LongType> &key) {
+  return _shards[KeyHash()(key) % NUM_SHARDS];
+}
+
+ShapeList *ShapeFunctionCache::lookup(const std::vector<LongType> &key) {
+  auto &shard = shardFor(key);
+  {
+    std::lock_guard<std::mutex> lock(shard.lock);
+    auto it = shard.entries.find(key);
+    if (it != shard.entries.end()) {
+      shard.order.splice(shard.order.begin(), shard.order, it->second.position);
+      _hits++;
+      return new ShapeList(it->second.shapes);
+    }
+  }
+
+  _misses++;
+  return nullptr;
+}
+
+void ShapeFunctionCache::store(const std::vector<LongType> &key, ShapeList *shapes) {
+  // shapes produced by shape function may live in workspace, so cache keeps constant copies only
+  std::vector<LongType *> constants(shapes->size(), nullptr);
+  for (int e = 0; e < shapes->size(); e++) {
+    auto shapeInfo = shapes->at(e);
+    if (shapeInfo != nullptr) constants[e] = ConstantShapeHelper::getInstance().createFromExisting(shapeInfo);
+  }
+
+  auto limit = sd::math::sd_max<int>(1, _capacity.load() / NUM_SHARDS);
+  auto &shard = shardFor(key);
+  std::lock_guard<std::mutex> lock(shard.lock);
+  if (shard.entries.find(key) != shard.entries.end()) return;
+
+  auto inserted = shard.entries.emplace(key, Entry()).first;
+  inserted->second.shapes = constants;
+  shard.order.push_front(&inserted->first);
+  inserted->second.position = shard.order.begin();
+
+  while (shard.entries.size() > static_cast<size_t>(limit)) {
+    auto oldest = shard.entries.find(*shard.order.back());
+    shard.order.pop_back();
+    shard.entries.erase(oldest);
+    _evictions++;
+  }
+}
+
+void ShapeFunctionCache::setCapacity(int entries) {
+  if (entries < 1) THROW_EXCEPTION("ShapeFunctionCache: capacity should be positive");
+
+  _capacity.store(entries);
+}
+
+int ShapeFunctionCache::capacity() const { return _capacity.load(); }
+
+LongType ShapeFunctionCache::hits() const { return _hits.load(); }
+
+LongType ShapeFunctionCache::misses() const { return _misses.load(); }
+
+LongType ShapeFunctionCache::evictions() const { return _evictions.load(); }
+
+LongType ShapeFunctionCache::size() {
+  LongType result = 0;
+  for (auto &shard : _shards) {
+    std::lock_guard<std::mutex> lock(shard.lock);
+    result += static_cast<LongType>(shard.entries.size());
+  }
+
+  return result;
+}
+
+void ShapeFunctionCache::purge() {
+  for (auto &shard : _shards) {
+    std::lock_guard<std::mutex> lock(shard.lock);
+    shard.entries.clear();
+    shard.order.clear();
+  }
+
+  _hits.store(0);
+  _misses.store(0);
+  _evictions.store(0);
+}
+}  // namespace ops
+}  // namespace sd
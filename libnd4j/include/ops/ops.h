@@ -28,6 +28,7 @@
 #include <system/common.h>
 #include <system/op_boilerplate.h>
 #include <math/templatemath.h>
+#include <math/vectormath.h>
 #include <vector>
 
 #define no_op_exec_special_any                                                                           \
@@ -926,7 +927,7 @@ class Exp {
 
   SD_OP_DEF static X
   op(X d1, X *params) {
-    return sd::math::sd_exp<X, X>(d1);
+    return sd::math::vec::exp<X>(d1);
   }
 };
 
@@ -975,7 +976,7 @@ class Log {
 
   SD_OP_DEF static X
   op(X d1, X *params) {
-    return sd::math::sd_log<X, X>(d1);
+    return sd::math::vec::log<X>(d1);
   }
 };
 
@@ -986,7 +987,7 @@ class Log1p {
 
   SD_OP_DEF static X
   op(X d1, X *params) {
-    return sd::math::sd_log<X, X>(1 + d1);
+    return sd::math::vec::log1p<X>(d1);
   }
 };
 
@@ -1053,7 +1054,7 @@ class Erf {
 
   SD_OP_DEF static X
   op(X d1, X *params) {
-    return sd::math::sd_erf<X, X>(d1);
+    return sd::math::vec::erf<X>(d1);
   }
 };
 
@@ -1430,7 +1431,7 @@ class Swish {
 
   SD_OP_DEF static X
   op(X d1, X *params) {
-    return d1 * sd::math::sd_sigmoid<X, X>(d1);
+    return d1 * sd::math::vec::sigmoid<X>(d1);
   }
 };
 
@@ -1441,7 +1442,7 @@ class Mish {
 
   SD_OP_DEF static X
   op(X d1, X *params) {
-    return d1 * sd::math::sd_tanh<X, X>(sd::math::sd_softplus<X, X>(d1));
+    return d1 * sd::math::vec::tanh<X>(sd::math::vec::softplus<X>(d1));
   }
 };
 
@@ -1468,7 +1469,7 @@ class GELU {
 
   SD_OP_DEF static X
   op(X d1, X *params) {
-    return d1 * sd::math::sd_sigmoid<X, X>(static_cast<X>(1.702f) * d1);
+    return d1 * sd::math::vec::sigmoid<X>(static_cast<X>(1.702f) * d1);
   }
 };
 
@@ -1481,7 +1482,7 @@ class PreciseGELU {
   op(X d1, X *params) {
     auto sp = sd::math::sd_sqrt<X, X>(static_cast<X>(2) / static_cast<X>(M_PI));
     auto xp = d1 + sd::math::sd_pow<X, X, X>(static_cast<X>(0.044715) * d1, static_cast<X>(3));
-    return (d1 / static_cast<X>(2)) * (static_cast<X>(1) + sd::math::sd_tanh<X, X>(sp * xp));
+    return (d1 / static_cast<X>(2)) * (static_cast<X>(1) + sd::math::vec::tanh<X>(sp * xp));
   }
 };
 
@@ -1536,7 +1537,7 @@ class LogSigmoid {
 
   SD_OP_DEF static X
   op(X d1, X *params) {
-    return sd::math::sd_log<X, X>(sd::math::sd_sigmoid<X, X>(d1));
+    return -sd::math::vec::softplus<X>(-d1);
   }
 };
 
@@ -1559,7 +1560,7 @@ class Sigmoid {
 
   SD_OP_DEF static X
   op(X d1, X *params) {
-    return sd::math::sd_sigmoid<X, X>(d1);
+    return sd::math::vec::sigmoid<X>(d1);
   }
 };
 
@@ -1692,7 +1693,7 @@ class SoftPlus {
 
   SD_OP_DEF static X
   op(X d1, X *params) {
-    return sd::math::sd_softplus<X, X>(d1);
+    return sd::math::vec::softplus<X>(d1);
   }
 };
 
@@ -1766,7 +1767,7 @@ class Tanh {
 
   SD_OP_DEF static X
   op(X d1, X *params) {
-    return sd::math::sd_tanh<X, X>(d1);
+    return sd::math::vec::tanh<X>(d1);
   }
 };
 
@@ -1777,7 +1778,7 @@ class ScaledTanh {
 
   SD_OP_DEF static X
   op(X d1, X *params) {
-    return params[0] * sd::math::sd_tanh<X, X>(params[1] * d1);
+    return params[0] * sd::math::vec::tanh<X>(params[1] * d1);
   }
 };
 
@@ -1788,7 +1789,7 @@ class RectifiedTanh {
 
   SD_OP_DEF static X
   op(X d1, X *params) {
-    return sd::math::sd_max<X>(static_cast<X>(0), sd::math::sd_tanh<X, X>(d1));
+    return sd::math::sd_max<X>(static_cast<X>(0), sd::math::vec::tanh<X>(d1));
   }
 };
 
@@ -55,6 +55,7 @@ class SD_LIB_EXPORT Environment {
   std::atomic<bool> _checkOutputChange{false};
   std::atomic<bool> _logNDArrayEvenuts{false};
   std::atomic<bool> _logNativeNDArrayCreation{false};
+  std::atomic<bool> _approximateActivations{false};
   // these fields hold defaults
   std::atomic<int64_t> _maxTotalPrimaryMemory{-1};
   std::atomic<int64_t> _maxTotalSpecialMemory{-1};
@@ -150,6 +151,14 @@ class SD_LIB_EXPORT Environment {
   bool isCheckInputChange();
   void setCheckInputChange(bool reallyCheck);
 
+  /**
+   * When enabled, activation ops with 8-bit or half precision inputs use lookup tables and piecewise polynomials
+   * instead of exact functions. Ops may override it with their own boolean argument
+   * @return
+   */
+  bool isApproximateActivations();
+  void setApproximateActivations(bool reallyApproximate);
+
   bool isVerbose();
   void setVerbose(bool reallyVerbose);
   bool isDebug();
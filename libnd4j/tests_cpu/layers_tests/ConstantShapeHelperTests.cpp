@@ -24,6 +24,7 @@
 #include <helpers/ConstantShapeHelper.h>
 #include <helpers/PointersManager.h>
 #include <ops/declarable/CustomOperations.h>
+#include <ops/declarable/ShapeFunctionCache.h>
 
 #include "testlayers.h"
 
@@ -329,3 +330,93 @@ TEST_F(ConstantShapeHelperTests, ShapeDescriptor_paddedBuffer) {
     }
   }
 }
+
+TEST_F(ConstantShapeHelperTests, shape_function_cache_1) {
+  auto a = NDArrayFactory::create<float>('c', {2, 3});
+  auto b = NDArrayFactory::create<float>('c', {3, 4});
+  auto c = NDArrayFactory::create<float>('c', {3, 5});
+  auto zA = NDArrayFactory::create<float>('c', {2, 4});
+  auto zB = NDArrayFactory::create<float>('c', {2, 5});
+  sd::ops::matmul matmul;
+
+  auto &cache = ShapeFunctionCache::getInstance();
+  cache.purge();
+
+  ASSERT_EQ(sd::Status::OK, matmul.execute({&a, &b}, {&zA}));
+  ASSERT_EQ(0, cache.hits());
+  ASSERT_EQ(1, cache.misses());
+
+  ASSERT_EQ(sd::Status::OK, matmul.execute({&a, &b}, {&zA}));
+  ASSERT_EQ(1, cache.hits());
+
+  // input shapes are part of the key
+  ASSERT_EQ(sd::Status::OK, matmul.execute({&a, &c}, {&zB}));
+  ASSERT_EQ(1, cache.hits());
+  ASSERT_EQ(2, cache.misses());
+  ASSERT_EQ(2, cache.size());
+
+  // reshape reads target shape from input values, so it's never cached
+  auto x = NDArrayFactory::create<float>('c', {4, 6});
+  auto shape = NDArrayFactory::create<sd::LongType>({6, 4});
+  auto z = NDArrayFactory::create<float>('c', {6, 4});
+  sd::ops::reshape reshape;
+  ASSERT_EQ(sd::Status::OK, reshape.execute({&x, &shape}, {&z}));
+
+  Context ctx(1);
+  ctx.setInputArray(0, &x);
+  ctx.setInputArray(1, &shape);
+  std::vector<sd::LongType> key;
+  ASSERT_FALSE(ShapeFunctionCache::buildKey(&reshape, ctx, key));
+  ASSERT_EQ(2, cache.misses());
+
+  cache.purge();
+}
+
+TEST_F(ConstantShapeHelperTests, shape_function_cache_2) {
+  auto input = NDArrayFactory::create<float>('c', {40});
+  input.linspace(1);
+  sd::ops::unique unique;
+
+  // output shape of unique depends on input values, so it's never cached
+  ASSERT_EQ(sd::Status::OK, unique.evaluate({&input}).status());
+  Context ctx(1);
+  ctx.setInputArray(0, &input);
+  std::vector<sd::LongType> key;
+  ASSERT_FALSE(ShapeFunctionCache::buildKey(&unique, ctx, key));
+
+  auto x = NDArrayFactory::create<float>('c', {2, 3});
+  auto y = NDArrayFactory::create<float>('c', {2, 3});
+  auto z = NDArrayFactory::create<float>('c', {2, 3});
+  sd::ops::add op;
+
+  auto &cache = ShapeFunctionCache::getInstance();
+  cache.purge();
+  for (int e = 0; e < 4; e++) ASSERT_EQ(sd::Status::OK, op.execute({&x, &y}, {&z}));
+
+  ASSERT_EQ(1, cache.misses());
+  ASSERT_EQ(3, cache.hits());
+
+  ShapeFunctionCache::setEnabled(false);
+  ASSERT_EQ(sd::Status::OK, op.execute({&x, &y}, {&z}));
+  ShapeFunctionCache::setEnabled(true);
+  ASSERT_EQ(3, cache.hits());
+
+  // single entry per shard, so older keys get evicted
+  auto capacity = cache.capacity();
+  cache.setCapacity(ShapeFunctionCache::NUM_SHARDS);
+  cache.purge();
+
+  ShapeList shapes(x.shapeInfo());
+  for (sd::LongType e = 0; e < 64; e++) cache.store({e}, &shapes);
+
+  ASSERT_GE(ShapeFunctionCache::NUM_SHARDS, cache.size());
+  ASSERT_EQ(64 - cache.size(), cache.evictions());
+
+  auto cached = cache.lookup({63});
+  ASSERT_NE(nullptr, cached);
+  ASSERT_TRUE(shape::equalsStrict(x.shapeInfo(), cached->at(0)));
+  delete cached;
+
+  cache.setCapacity(capacity);
+  cache.purge();
+}
@@ -25,6 +25,7 @@
 #include <graph/Context.h>
 #include <graph/Variable.h>
 #include <graph/VariableSpace.h>
+#include <helpers/PerfectHashTable.h>
 #include <helpers/PointersManager.h>
 #include <helpers/helper_hash.h>
 #include <legacy/NativeOps.h>
@@ -227,6 +228,35 @@ TEST_F(DeclarableOpsTests1, SynonymInitialization2) {
   ASSERT_TRUE(op == op2);
 }
 
+TEST_F(DeclarableOpsTests1, SynonymInitialization3) {
+  // synonyms are resolved by their own hash as well
+  std::string synonym("Mul");
+  auto op = ops::OpRegistrator::getInstance().getOperation(ops::HashHelper::getInstance().getLongHash(synonym));
+  auto op2 = ops::OpRegistrator::getInstance().getOperation("multiply");
+
+  ASSERT_TRUE(op != nullptr);
+  ASSERT_TRUE(op == op2);
+  ASSERT_TRUE(ops::OpRegistrator::getInstance().getOperation(static_cast<sd::LongType>(1)) == nullptr);
+}
+
+TEST_F(DeclarableOpsTests1, PerfectHashTable1) {
+  std::vector<std::pair<sd::LongType, int>> entries;
+  for (int e = 0; e < 2000; e++) entries.emplace_back(static_cast<sd::LongType>(e) * 7919 + 13, e);
+
+  PerfectHashTable<sd::LongType, int> table(entries);
+  ASSERT_EQ(2000, table.size());
+  for (auto &entry : entries) {
+    auto value = table.find(entry.first);
+    ASSERT_TRUE(value != nullptr);
+    ASSERT_EQ(entry.second, *value);
+  }
+
+  for (int e = 0; e < 2000; e++) ASSERT_TRUE(table.find(static_cast<sd::LongType>(e) * 7919 + 14) == nullptr);
+
+  PerfectHashTable<sd::LongType, int> empty(std::vector<std::pair<sd::LongType, int>>{});
+  ASSERT_TRUE(empty.find(13) == nullptr);
+}
+
 TEST_F(DeclarableOpsTests1, TestTensorMmul1) {
   NDArray x('c', {2, 3, 4}, FLOAT32);
   NDArray y('c', {2, 3, 4}, FLOAT32);
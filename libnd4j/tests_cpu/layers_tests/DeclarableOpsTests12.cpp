@@ -26,6 +26,7 @@
 #include <helpers/PointersManager.h>
 #include <ops/declarable/CustomOperations.h>
 #include <ops/declarable/helpers/image_resize.h>
+#include <ops/declarable/helpers/resizePlans.h>
 #include <ops/ops.h>
 
 #include "testlayers.h"
@@ -3189,6 +3190,123 @@ TEST_F(DeclarableOpsTests12, ImageResize_Test12_Input_Strided) {
 
   }  // channels
 }
+
+////////////////////////////////////////////////////////////////////////////////
+TEST_F(DeclarableOpsTests12, ImageResize_Test13_Cached_Plans) {
+  auto &cache = ops::helpers::ResizePlanCache::getInstance();
+
+  // first call builds interpolation plan, second one takes it from cache, both match values computed without plans
+  auto check = [&cache](ops::DeclarableOp &op, const std::vector<NDArray *> &inputs,
+                        const std::vector<sd::LongType> &iArgs, const std::vector<bool> &bArgs, NDArray &expected) {
+    cache.clear();
+    for (int e = 0; e < 2; e++) {
+      auto results = op.evaluate(inputs, {}, iArgs, bArgs);
+      ASSERT_EQ(sd::Status::OK, results.status());
+      ASSERT_TRUE(expected.isSameShape(results.at(0)));
+      ASSERT_TRUE(expected.equalsTo(results.at(0)));
+    }
+
+    // plans are kept only by cpu helpers
+#ifndef __CUDABLAS__
+    ASSERT_EQ(1, cache.misses());
+    ASSERT_EQ(1, cache.hits());
+#endif
+  };
+
+  // expected values below are the same as in ImageResizeNeighbor_Test1, ImageResizeBilinear_Test1_1,
+  // ImageResizeBicubic_Test4 and ImageResizeArea_Test2
+  NDArray input = NDArrayFactory::create<double>('c', {1, 2, 3, 4});
+  input.linspace(1);
+
+  NDArray expNearest = NDArrayFactory::create<double>(
+      'c', {1, 4, 5, 4}, {1,  2,  3,  4,  1,  2,  3,  4,  5,  6,  7,  8,  5,  6,  7,  8,  9,  10, 11, 12,
+                          1,  2,  3,  4,  1,  2,  3,  4,  5,  6,  7,  8,  5,  6,  7,  8,  9,  10, 11, 12,
+                          13, 14, 15, 16, 13, 14, 15, 16, 17, 18, 19, 20, 17, 18, 19, 20, 21, 22, 23, 24,
+                          13, 14, 15, 16, 13, 14, 15, 16, 17, 18, 19, 20, 17, 18, 19, 20, 21, 22, 23, 24});
+  ops::resize_nearest_neighbor nearest;
+  check(nearest, {&input}, {4, 5}, {false, false}, expNearest);
+
+  NDArray expBilinear = NDArrayFactory::create<double>(
+      'c', {1, 4, 5, 4},
+      {1.,  2.,  3.,  4.,  2.6,  3.6,  4.6,  5.6,  5.,  6.,  7.,  8.,  7.4,  8.4,  9.4,  10.4, 9.,  10., 11., 12.,
+       4.,  5.,  6.,  7.,  5.6,  6.6,  7.6,  8.6,  8.,  9.,  10., 11., 10.4, 11.4, 12.4, 13.4, 12., 13., 14., 15.,
+       10., 11., 12., 13., 11.6, 12.6, 13.6, 14.6, 14., 15., 16., 17., 16.4, 17.4, 18.4, 19.4, 18., 19., 20., 21.,
+       13., 14., 15., 16., 14.6, 15.6, 16.6, 17.6, 17., 18., 19., 20., 19.4, 20.4, 21.4, 22.4, 21., 22., 23., 24.});
+  ops::resize_bilinear bilinear;
+  check(bilinear, {&input}, {4, 5}, {false, true}, expBilinear);
+
+  NDArray inputBicubic = NDArrayFactory::create<double>('c', {1, 3, 4, 3});
+  inputBicubic.linspace(1);
+  auto sizeBicubic = NDArrayFactory::create<int>({6, 8});
+  NDArray expBicubic = NDArrayFactory::create<float>(
+      'c', {1, 6, 8, 3},
+      {1.000000f,  2.000000f,  3.000000f,  2.218750f,  3.218750f,  4.218750f,  4.000000f,  5.000000f,  6.000000f,
+       5.500000f,  6.500000f,  7.500000f,  7.000000f,  8.000000f,  9.000000f,  8.781250f,  9.781250f,  10.781250f,
+       10.000000f, 11.000000f, 12.000000f, 10.281250f, 11.281250f, 12.281250f, 5.875000f,  6.875000f,  7.875000f,
+       7.093750f,  8.093750f,  9.093750f,  8.875000f,  9.875000f,  10.875000f, 10.375000f, 11.375000f, 12.375000f,
+       11.875000f, 12.875000f, 13.875000f, 13.656250f, 14.656250f, 15.656250f, 14.875000f, 15.875000f, 16.875000f,
+       15.156250f, 16.156250f, 17.156250f, 13.000000f, 14.000000f, 15.000000f, 14.218750f, 15.218750f, 16.218750f,
+       16.000000f, 17.000000f, 18.000000f, 17.500000f, 18.500000f, 19.500000f, 19.000000f, 20.000000f, 21.000000f,
+       20.781250f, 21.781250f, 22.781250f, 22.000000f, 23.000000f, 24.000000f, 22.281250f, 23.281250f, 24.281250f,
+       20.125000f, 21.125000f, 22.125000f, 21.343750f, 22.343750f, 23.343750f, 23.125000f, 24.125000f, 25.125000f,
+       24.625000f, 25.625000f, 26.625000f, 26.125000f, 27.125000f, 28.125000f, 27.906250f, 28.906250f, 29.906250f,
+       29.125000f, 30.125000f, 31.125000f, 29.406250f, 30.406250f, 31.406250f, 25.000000f, 26.000000f, 27.000000f,
+       26.218750f, 27.218750f, 28.218750f, 28.000000f, 29.000000f, 30.000000f, 29.500000f, 30.500000f, 31.500000f,
+       31.000000f, 32.000000f, 33.000000f, 32.781250f, 33.781250f, 34.781250f, 34.000000f, 35.000000f, 36.000000f,
+       34.281250f, 35.281250f, 36.281250f, 26.125000f, 27.125000f, 28.125000f, 27.343750f, 28.343750f, 29.343750f,
+       29.125000f, 30.125000f, 31.125000f, 30.625000f, 31.625000f, 32.625000f, 32.125000f, 33.125000f, 34.125000f,
+       33.906250f, 34.906250f, 35.906250f, 35.125000f, 36.125000f, 37.125000f, 35.406250f, 36.406250f, 37.406250f});
+  ops::resize_bicubic bicubic;
+  check(bicubic, {&inputBicubic, &sizeBicubic}, {}, {}, expBicubic);
+
+  NDArray inputArea = NDArrayFactory::create<float>('c', {1, 3, 3, 1});
+  inputArea.linspace(1);
+  auto sizeArea = NDArrayFactory::create<int>({6, 6});
+  NDArray expArea = NDArrayFactory::create<float>(
+      'c', {1, 6, 6, 1}, {1.f, 1.f, 2.f, 2.f, 3.f, 3.f, 1.f, 1.f, 2.f, 2.f, 3.f, 3.f, 4.f, 4.f, 5.f, 5.f, 6.f, 6.f,
+                          4.f, 4.f, 5.f, 5.f, 6.f, 6.f, 7.f, 7.f, 8.f, 8.f, 9.f, 9.f, 7.f, 7.f, 8.f, 8.f, 9.f, 9.f});
+  ops::resize_area area;
+  check(area, {&inputArea, &sizeArea}, {}, {}, expArea);
+
+  cache.clear();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+TEST_F(DeclarableOpsTests12, ImagePreprocess_Test1) {
+  auto input = NDArrayFactory::create<uint8_t>('c', {1, 2, 2, 3}, {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11});
+  auto mean = NDArrayFactory::create<float>('c', {3}, {1.f, 2.f, 3.f});
+  auto std = NDArrayFactory::create<float>('c', {3}, {2.f, 2.f, 4.f});
+  // right column is cropped, channels are reversed and written as NCHW
+  auto expected = NDArrayFactory::create<float>('c', {1, 3, 2, 1}, {0.75f, 2.25f, 0.f, 1.5f, -0.375f, 0.375f});
+
+  ops::image_preprocess op;
+  auto results = op.evaluate({&input, &mean, &std}, {0.5}, {2, 1, 1, 0, 1, 2, 1}, {true});
+  ASSERT_EQ(sd::Status::OK, results.status());
+
+  auto result = results[0];
+  ASSERT_TRUE(expected.isSameShape(result));
+  ASSERT_TRUE(expected.equalsTo(result));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+TEST_F(DeclarableOpsTests12, ImagePreprocess_Test2) {
+  NDArray input = NDArrayFactory::create<float>('c', {2, 5, 6, 3});
+  input.linspace(1);
+  auto size = NDArrayFactory::create<int>({7, 4});
+
+  ops::resize_bilinear resize;
+  auto expected = resize.evaluate({&input, &size}, {}, {}, {false, true});
+  ASSERT_EQ(sd::Status::OK, expected.status());
+
+  ops::image_preprocess op;
+  auto results = op.evaluate({&input}, {}, {7, 4});
+  ASSERT_EQ(sd::Status::OK, results.status());
+
+  auto result = results[0];
+  ASSERT_TRUE(expected[0]->isSameShape(result));
+  ASSERT_TRUE(expected[0]->equalsTo(result, 1e-4));
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 TEST_F(DeclarableOpsTests12, TriangularSolve_Test_1) {
   auto a = NDArrayFactory::create<float>(
@@ -3021,3 +3021,58 @@ TEST_F(DeclarableOpsTests13, batchnorm_bp_test11) {
   ASSERT_TRUE(expdLdB.isSameShapeStrict(*dLdB));
   ASSERT_TRUE(expdLdB.equalsTo(dLdB));
 }
+
+////////////////////////////////////////////////////////////////////
+TEST_F(DeclarableOpsTests13, batchnorm_bp_test12) {
+  NDArray input('c', {2, 3, 4, 5}, FLOAT32);
+  NDArray mean('c', {3}, {1.1, 1.2, 1.3}, FLOAT32);
+  NDArray variance('c', {3}, {0.5, 0.6, 0.7}, FLOAT32);
+  NDArray gamma('c', {3}, {1.2, -0.8, 0.5}, FLOAT32);
+  NDArray beta('c', {3}, FLOAT32);
+  NDArray gradO('c', {2, 3, 4, 5}, FLOAT32);
+
+  input.linspace(0.1, 0.02);
+  gradO.linspace(-0.9, 0.015);
+  beta.assign(1.);
+
+  // f-order copies go through broadcast based implementation
+  auto inputF = input.dup('f');
+  auto gradOF = gradO.dup('f');
+
+  ops::batchnorm_bp op;
+  auto fused = op.evaluate({&input, &mean, &variance, &gamma, &beta, &gradO}, {1e-5}, {1, 1, 1});
+  auto reference = op.evaluate({&inputF, &mean, &variance, &gamma, &beta, &gradOF}, {1e-5}, {1, 1, 1});
+
+  ASSERT_EQ(sd::Status::OK, fused.status());
+  ASSERT_EQ(sd::Status::OK, reference.status());
+
+  for (int e = 0; e < 5; e++) ASSERT_TRUE(reference.at(e)->equalsTo(fused.at(e), 1e-4));
+}
+
+////////////////////////////////////////////////////////////////////
+TEST_F(DeclarableOpsTests13, batchnorm_bp_test13) {
+  // NHWC, channels are the last axis, more rows than partial groups
+  NDArray input('c', {4, 8, 10, 3}, FLOAT32);
+  NDArray mean('c', {3}, {1.1, 1.2, 1.3}, FLOAT32);
+  NDArray variance('c', {3}, {0.5, 0.6, 0.7}, FLOAT32);
+  NDArray gamma('c', {3}, {1.2, -0.8, 0.5}, FLOAT32);
+  NDArray beta('c', {3}, FLOAT32);
+  NDArray gradO('c', {4, 8, 10, 3}, FLOAT32);
+
+  input.linspace(0.1, 0.002);
+  gradO.linspace(-0.9, 0.0015);
+  beta.assign(1.);
+
+  // f-order copies go through broadcast based implementation
+  auto inputF = input.dup('f');
+  auto gradOF = gradO.dup('f');
+
+  ops::batchnorm_bp op;
+  auto fused = op.evaluate({&input, &mean, &variance, &gamma, &beta, &gradO}, {1e-5}, {1, 1, 3});
+  auto reference = op.evaluate({&inputF, &mean, &variance, &gamma, &beta, &gradOF}, {1e-5}, {1, 1, 3});
+
+  ASSERT_EQ(sd::Status::OK, fused.status());
+  ASSERT_EQ(sd::Status::OK, reference.status());
+
+  for (int e = 0; e < 5; e++) ASSERT_TRUE(reference.at(e)->equalsTo(fused.at(e), 1e-3));
+}
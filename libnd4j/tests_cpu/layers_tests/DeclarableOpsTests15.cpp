@@ -511,6 +511,93 @@ TEST_F(DeclarableOpsTests15, Test_layer_norm_bp_2) {
   ASSERT_EQ(sd::Status::OK, status);
 }
 
+//////////////////////////////////////////////////////////////////////
+TEST_F(DeclarableOpsTests15, Test_layer_norm_fused_1) {
+  NDArray x('c', {3, 4, 8, 8}, FLOAT32);
+  NDArray gain('c', {8}, {-0.1, 0.1, -0.2, 0.2, 0.3, -0.3, 0.4, 0.5}, FLOAT32);
+  NDArray bias('c', {8}, {-0.05, 0.05, -1.05, 1.05, 0.5, 0.6, -0.7, 0.8}, FLOAT32);
+  NDArray gradO('c', {3, 4, 8, 8}, FLOAT32);
+
+  x.linspace(-20, 0.5);
+  gradO.linspace(-4, 0.05);
+
+  // f-order copies go through standardize based implementation
+  auto xF = x.dup('f');
+  auto gradOF = gradO.dup('f');
+
+  ops::layer_norm op;
+  auto fused = op.evaluate({&x, &gain, &bias}, {}, {2, 3}, {false});
+  auto reference = op.evaluate({&xF, &gain, &bias}, {}, {2, 3}, {false});
+  ASSERT_EQ(sd::Status::OK, fused.status());
+  ASSERT_EQ(sd::Status::OK, reference.status());
+  ASSERT_TRUE(reference.at(0)->equalsTo(fused.at(0)));
+
+  ops::layer_norm_bp opBp;
+  auto fusedBp = opBp.evaluate({&x, &gain, &bias, &gradO}, {}, {2, 3}, {false});
+  auto referenceBp = opBp.evaluate({&xF, &gain, &bias, &gradOF}, {}, {2, 3}, {false});
+  ASSERT_EQ(sd::Status::OK, fusedBp.status());
+  ASSERT_EQ(sd::Status::OK, referenceBp.status());
+  for (int e = 0; e < 3; e++) ASSERT_TRUE(referenceBp.at(e)->equalsTo(fusedBp.at(e), 1e-4));
+}
+
+TEST_F(DeclarableOpsTests15, Test_layer_norm_fused_2) {
+  // channels last, with more rows than partial groups of gain and bias gradients
+  NDArray x('c', {200, 2, 4}, FLOAT32);
+  NDArray gain('c', {4}, {-0.1, 0.2, 0.3, 0.5}, FLOAT32);
+  NDArray bias('c', {4}, {-0.05, 1.05, 0.6, -0.7}, FLOAT32);
+  NDArray gradO('c', {200, 2, 4}, FLOAT32);
+
+  x.linspace(-20, 0.025);
+  gradO.linspace(-4, 0.005);
+
+  auto xF = x.dup('f');
+  auto gradOF = gradO.dup('f');
+
+  ops::layer_norm op;
+  auto fused = op.evaluate({&x, &gain, &bias}, {}, {1, 2}, {false});
+  auto reference = op.evaluate({&xF, &gain, &bias}, {}, {1, 2}, {false});
+  ASSERT_EQ(sd::Status::OK, fused.status());
+  ASSERT_EQ(sd::Status::OK, reference.status());
+  ASSERT_TRUE(reference.at(0)->equalsTo(fused.at(0)));
+
+  ops::layer_norm_bp opBp;
+  auto fusedBp = opBp.evaluate({&x, &gain, &bias, &gradO}, {}, {1, 2}, {false});
+  auto referenceBp = opBp.evaluate({&xF, &gain, &bias, &gradOF}, {}, {1, 2}, {false});
+  ASSERT_EQ(sd::Status::OK, fusedBp.status());
+  ASSERT_EQ(sd::Status::OK, referenceBp.status());
+  for (int e = 0; e < 3; e++) ASSERT_TRUE(referenceBp.at(e)->equalsTo(fusedBp.at(e), 1e-3));
+}
+
+TEST_F(DeclarableOpsTests15, Test_layer_norm_fused_3) {
+  // [N, F] normalized over features, row is single block of channels
+  NDArray x('c', {64, 37}, FLOAT32);
+  NDArray gain('c', {37}, FLOAT32);
+  NDArray bias('c', {37}, FLOAT32);
+  NDArray gradO('c', {64, 37}, FLOAT32);
+
+  x.linspace(-20, 0.01);
+  gain.linspace(-0.5, 0.03);
+  bias.linspace(1.0, -0.05);
+  gradO.linspace(-4, 0.003);
+
+  auto xF = x.dup('f');
+  auto gradOF = gradO.dup('f');
+
+  ops::layer_norm op;
+  auto fused = op.evaluate({&x, &gain, &bias}, {}, {1}, {false});
+  auto reference = op.evaluate({&xF, &gain, &bias}, {}, {1}, {false});
+  ASSERT_EQ(sd::Status::OK, fused.status());
+  ASSERT_EQ(sd::Status::OK, reference.status());
+  ASSERT_TRUE(reference.at(0)->equalsTo(fused.at(0)));
+
+  ops::layer_norm_bp opBp;
+  auto fusedBp = opBp.evaluate({&x, &gain, &bias, &gradO}, {}, {1}, {false});
+  auto referenceBp = opBp.evaluate({&xF, &gain, &bias, &gradOF}, {}, {1}, {false});
+  ASSERT_EQ(sd::Status::OK, fusedBp.status());
+  ASSERT_EQ(sd::Status::OK, referenceBp.status());
+  for (int e = 0; e < 3; e++) ASSERT_TRUE(referenceBp.at(e)->equalsTo(fusedBp.at(e), 1e-3));
+}
+
 TEST_F(DeclarableOpsTests15, test_hashCode_1) {
   auto x = NDArrayFactory::create<int>('c', {10});
   auto y = NDArrayFactory::create<int>('c', {10});
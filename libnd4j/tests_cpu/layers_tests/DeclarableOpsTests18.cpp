@@ -23,6 +23,7 @@
 //
 #include <array/NDArray.h>
 #include <helpers/GradCheck.h>
+#include <math/vectormath.h>
 #include <ops/declarable/CustomOperations.h>
 #include <ops/ops.h>
 #include <types/float16.h>
@@ -139,6 +140,97 @@ TEST_F(DeclarableOpsTests18, test_tanh_2) {
   ASSERT_EQ(e, z);
 }
 /////////////////////////////////////////////////////////////////////////////////////////////////////////
+TEST_F(DeclarableOpsTests18, test_tanh_approximate_1) {
+  // every raw byte of signed and unsigned 8-bit input goes through the lookup table
+  for (auto type : {INT8, UINT8}) {
+    NDArray x('c', {256}, type);
+    NDArray zt('c', {256}, FLOAT32);
+    NDArray zs('c', {256}, FLOAT32);
+
+    auto buff = x.bufferAsT<uint8_t>();
+    for (int i = 0; i < 256; i++) buff[i] = static_cast<uint8_t>(i);
+    x.tickWriteHost();
+
+    ops::tanh tanhOp;
+    ops::sigmoid sigmoidOp;
+    ASSERT_EQ(sd::Status::OK, tanhOp.execute({&x}, {&zt}, {}, {}, {true}));
+    ASSERT_EQ(sd::Status::OK, sigmoidOp.execute({&x}, {&zs}, {}, {}, {true}));
+
+    for (int i = 0; i < 256; i++) {
+      const double v = type == INT8 ? static_cast<int8_t>(i) : i;
+      ASSERT_NEAR(std::tanh(v), zt.e<double>(i), 1e-6);
+      ASSERT_NEAR(1. / (1. + std::exp(-v)), zs.e<double>(i), 1e-6);
+    }
+  }
+}
+/////////////////////////////////////////////////////////////////////////////////////////////////////////
+TEST_F(DeclarableOpsTests18, test_tanh_approximate_2) {
+  // all half and bfloat16 bit patterns stay within the documented bounds, NaNs stay NaN
+  for (auto type : {HALF, BFLOAT16}) {
+    NDArray x('c', {65536}, type);
+    NDArray zt('c', {65536}, FLOAT32);
+    NDArray zs('c', {65536}, FLOAT32);
+
+    auto buff = x.bufferAsT<uint16_t>();
+    for (int i = 0; i < 65536; i++) buff[i] = static_cast<uint16_t>(i);
+    x.tickWriteHost();
+
+    ops::tanh tanhOp;
+    ops::sigmoid sigmoidOp;
+    ASSERT_EQ(sd::Status::OK, tanhOp.execute({&x}, {&zt}, {}, {}, {true}));
+    ASSERT_EQ(sd::Status::OK, sigmoidOp.execute({&x}, {&zs}, {}, {}, {true}));
+
+    for (int i = 0; i < 65536; i++) {
+      const double v = x.e<double>(i);
+      if (sd::math::vec::isNan(x.e<float>(i))) {
+        ASSERT_TRUE(sd::math::vec::isNan(zt.e<float>(i)));
+        ASSERT_TRUE(sd::math::vec::isNan(zs.e<float>(i)));
+        continue;
+      }
+      ASSERT_NEAR(std::tanh(v), zt.e<double>(i), 6.6e-7);
+      ASSERT_NEAR(1. / (1. + std::exp(-v)), zs.e<double>(i), 7.5e-8);
+    }
+  }
+}
+/////////////////////////////////////////////////////////////////////////////////////////////////////////
+TEST_F(DeclarableOpsTests18, test_sigmoid_approximate_1) {
+  NDArray x('c', {2000}, HALF);
+  NDArray z('c', {2000}, FLOAT32);
+  NDArray e('c', {2000}, FLOAT32);
+
+  x.linspace(-10., 0.01);
+  auto exact = x.cast(FLOAT32);
+  exact.applyTransform(transform::Sigmoid, e);
+
+  const bool approximate = Environment::getInstance().isApproximateActivations();
+  Environment::getInstance().setApproximateActivations(true);
+  ops::sigmoid op;
+  auto status = op.execute({&x}, {&z});
+  Environment::getInstance().setApproximateActivations(approximate);
+
+  ASSERT_EQ(sd::Status::OK, status);
+  ASSERT_TRUE(e.equalsTo(z, 1e-6));
+}
+/////////////////////////////////////////////////////////////////////////////////////////////////////////
+TEST_F(DeclarableOpsTests18, test_sigmoid_approximate_2) {
+  // small results on negative side and saturated inputs keep relative precision
+  NDArray x('c', {8}, {-100., -50., -20., -16., -15.5, -12., 16., 20.}, HALF);
+  NDArray z('c', {8}, FLOAT32);
+
+  const bool approximate = Environment::getInstance().isApproximateActivations();
+  Environment::getInstance().setApproximateActivations(true);
+  ops::sigmoid op;
+  auto status = op.execute({&x}, {&z});
+  Environment::getInstance().setApproximateActivations(approximate);
+
+  ASSERT_EQ(sd::Status::OK, status);
+  for (int i = 0; i < 8; i++) {
+    const double v = x.e<double>(i);
+    const double expected = 1. / (1. + std::exp(-v));
+    ASSERT_NEAR(expected, z.e<double>(i), 1e-6 * expected);
+  }
+}
+/////////////////////////////////////////////////////////////////////////////////////////////////////////
 TEST_F(DeclarableOpsTests18, test_tanh_bp) {
   NDArray x('c', {2, 3, 4}, FLOAT32);
   NDArray dLdz('c', {2, 3, 4}, FLOAT32);
@@ -2130,3 +2222,116 @@ TEST_F(DeclarableOpsTests18, TestUpdaterAmsGrad3) {
   ASSERT_TRUE(stateH.isSameShape(results.at(3)));
   ASSERT_TRUE(stateH.equalsTo(results.at(3)));
 }
+
+TEST_F(DeclarableOpsTests18, TestIndexedSlicesAggregate1) {
+  auto indices = NDArrayFactory::create<sd::LongType>('c', {4}, {2, 0, 2, 5});
+  NDArray values('c', {4, 2}, {1, 2, 3, 4, 5, 6, 7, 8}, FLOAT32);
+
+  auto expIndices = NDArrayFactory::create<sd::LongType>('c', {3}, {0, 2, 5});
+  NDArray expValues('c', {3, 2}, {3, 4, 6, 8, 7, 8}, FLOAT32);
+
+  ops::indexed_slices_aggregate op;
+  auto results = op.evaluate({&indices, &values});
+  ASSERT_EQ(sd::Status::OK, results.status());
+
+  ASSERT_TRUE(expIndices.isSameShape(results.at(0)));
+  ASSERT_TRUE(expIndices.equalsTo(results.at(0)));
+  ASSERT_TRUE(expValues.isSameShape(results.at(1)));
+  ASSERT_TRUE(expValues.equalsTo(results.at(1)));
+}
+
+TEST_F(DeclarableOpsTests18, TestUpdaterSparseAdam1) {
+  auto indices = NDArrayFactory::create<sd::LongType>('c', {1}, {1});
+  NDArray grad('c', {1, 5}, {1, 2, 3, 4, 5}, FLOAT32);
+  NDArray initU('c', {3, 5}, FLOAT32);
+  NDArray initM('c', {3, 5}, FLOAT32);
+  NDArray update('c', {1, 5}, FLOAT32);
+  initU.assign(0.f);
+  initM.assign(0.f);
+
+  ops::sparse_adam_updater op;
+  auto status = op.execute({&indices, &grad, &initU, &initM}, {&update, &initU, &initM},
+                           {0.001f, 0.9f, 0.999f, 1.0e-8}, {0});
+  ASSERT_EQ(sd::Status::OK, status);
+
+  // touched row matches dense adam_updater, other rows keep their state
+  NDArray updateExp(
+      'c', {1, 5},
+      {0.00099999968377233, 0.00099999984188614, 0.00099999989459076, 0.00099999992094306, 0.00099999993675445},
+      FLOAT32);
+  NDArray stateV('c', {3, 5}, {0, 0, 0, 0, 0, 0.001, 0.004, 0.009, 0.016, 0.025, 0, 0, 0, 0, 0}, FLOAT32);
+  NDArray stateM('c', {3, 5}, {0, 0, 0, 0, 0, 0.1, 0.2, 0.3, 0.4, 0.5, 0, 0, 0, 0, 0}, FLOAT32);
+
+  ASSERT_TRUE(update.equalsTo(updateExp));
+  ASSERT_TRUE(initU.equalsTo(stateV));
+  ASSERT_TRUE(initM.equalsTo(stateM));
+}
+
+TEST_F(DeclarableOpsTests18, TestUpdaterSparseAdam2) {
+  NDArray grad('c', {1, 5}, {1, 2, 3, 4, 5}, FLOAT32);
+  NDArray zeros('c', {1, 5}, FLOAT32);
+  zeros.assign(0.f);
+
+  NDArray denseU('c', {1, 5}, FLOAT32);
+  NDArray denseM('c', {1, 5}, FLOAT32);
+  NDArray denseUpdate('c', {1, 5}, FLOAT32);
+  denseU.assign(0.f);
+  denseM.assign(0.f);
+
+  // row isn't touched on iterations 1 and 2, dense Adam sees zero gradient there
+  ops::adam_updater dense;
+  for (int e = 0; e < 4; e++) {
+    auto g = e == 0 || e == 3 ? &grad : &zeros;
+    ASSERT_EQ(sd::Status::OK, dense.execute({g, &denseU, &denseM}, {&denseUpdate, &denseU, &denseM},
+                                            {0.001f, 0.9f, 0.999f, 1.0e-8}, {e}));
+  }
+
+  auto indices = NDArrayFactory::create<sd::LongType>('c', {1}, {0});
+  auto lastIteration = NDArrayFactory::create<sd::LongType>('c', {1}, {-1});
+  NDArray sparseU('c', {1, 5}, FLOAT32);
+  NDArray sparseM('c', {1, 5}, FLOAT32);
+  NDArray sparseUpdate('c', {1, 5}, FLOAT32);
+  sparseU.assign(0.f);
+  sparseM.assign(0.f);
+
+  ops::sparse_adam_updater sparse;
+  for (int e : {0, 3})
+    ASSERT_EQ(sd::Status::OK,
+              sparse.execute({&indices, &grad, &sparseU, &sparseM, &lastIteration},
+                             {&sparseUpdate, &sparseU, &sparseM, &lastIteration}, {0.001f, 0.9f, 0.999f, 1.0e-8}, {e}));
+
+  ASSERT_EQ(3, lastIteration.e<sd::LongType>(0));
+  ASSERT_TRUE(denseUpdate.equalsTo(sparseUpdate));
+  ASSERT_TRUE(denseU.equalsTo(sparseU));
+  ASSERT_TRUE(denseM.equalsTo(sparseM));
+}
+
+TEST_F(DeclarableOpsTests18, TestUpdaterSparseAdam3) {
+  auto indices = NDArrayFactory::create<sd::LongType>('c', {1}, {1});
+  auto lastIteration = NDArrayFactory::create<sd::LongType>('c', {3}, {-1, 0, 0});
+  auto expIteration = NDArrayFactory::create<sd::LongType>('c', {3}, {-1, 2, 0});
+  NDArray grad('c', {1, 5}, {1, 2, 3, 4, 5}, FLOAT32);
+  NDArray initU('c', {3, 5}, FLOAT32);
+  NDArray initM('c', {3, 5}, FLOAT32);
+  initU.assign(0.f);
+  initM.assign(0.f);
+
+  // inputs aren't modified unless op runs in place
+  ops::sparse_adam_updater op;
+  auto results = op.evaluate({&indices, &grad, &initU, &initM, &lastIteration}, {0.001f, 0.9f, 0.999f, 1.0e-8}, {2});
+  ASSERT_EQ(sd::Status::OK, results.status());
+  ASSERT_EQ(4, results.size());
+  ASSERT_TRUE(expIteration.equalsTo(results.at(3)));
+  ASSERT_EQ(0, lastIteration.e<sd::LongType>(1));
+
+  // batch without touched rows leaves states intact
+  auto empty = NDArrayFactory::create<sd::LongType>('c', {0});
+  NDArray emptyGrad('c', {0, 5}, FLOAT32);
+  auto stateU = results.at(1)->dup();
+  auto stateM = results.at(2)->dup();
+  results = op.evaluate({&empty, &emptyGrad, &stateU, &stateM, &lastIteration}, {0.001f, 0.9f, 0.999f, 1.0e-8}, {3});
+  ASSERT_EQ(sd::Status::OK, results.status());
+  ASSERT_TRUE(stateU.equalsTo(results.at(1)));
+  ASSERT_TRUE(stateM.equalsTo(results.at(2)));
+  ASSERT_TRUE(lastIteration.equalsTo(results.at(3)));
+}
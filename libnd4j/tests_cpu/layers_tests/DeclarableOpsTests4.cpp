@@ -790,6 +790,31 @@ TEST_F(DeclarableOpsTests4, biasadd_bp_2) {
   ASSERT_TRUE(gradB->equalsTo(expGradB));
 }
 
+//////////////////////////////////////////////////////////////////////
+TEST_F(DeclarableOpsTests4, biasadd_bp_3) {
+  // dense layer shape, gradient of bias is sum of columns
+  NDArray x('c', {1030, 5}, FLOAT32);
+  NDArray gradO('c', {1030, 5}, FLOAT32);
+  NDArray bias('c', {5}, {1., 2, 3, 4, 5}, FLOAT32);
+  NDArray expGradB('c', {5}, FLOAT32);
+
+  gradO.linspace(0.01, 0.01);
+  for (int c = 0; c < 5; c++) {
+    double sum = 0.;
+    for (int r = 0; r < 1030; r++) sum += gradO.e<double>(r, c);
+    expGradB.p(c, sum);
+  }
+
+  ops::biasadd_bp op;
+  auto result = op.evaluate({&x, &bias, &gradO}, {}, {}, {false});
+
+  ASSERT_EQ(sd::Status::OK, result.status());
+
+  auto gradB = result.at(1);
+  ASSERT_TRUE(gradB->isSameShape(expGradB));
+  ASSERT_TRUE(gradB->equalsTo(expGradB, 1e-2));
+}
+
 TEST_F(DeclarableOpsTests4, biasadd_4) {
   if (!Environment::getInstance().isExperimentalBuild()) return;
 
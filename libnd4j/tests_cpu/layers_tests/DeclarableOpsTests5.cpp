@@ -1983,6 +1983,77 @@ TEST_F(DeclarableOpsTests5, fusedBatchNorm_test5) {
   ASSERT_TRUE(expBatchVar.isSameShape(batchVar));
 }
 
+//////////////////////////////////////////////////////////////////////
+TEST_F(DeclarableOpsTests5, fusedBatchNorm_test6) {
+  auto x = NDArrayFactory::create<float>('c', {2, 3, 4, 5});
+  auto scale = NDArrayFactory::create<float>('c', {3}, {0.5f, -1.f, 2.f});
+  auto offset = NDArrayFactory::create<float>('c', {3}, {2.f, 0.f, -1.f});
+  x.linspace(-3, 0.1);
+
+  // every channel holds {0.1 * (i + 60 * n + 20 * c) - 3}, i in [0, 20), n in [0, 2)
+  auto expBatchMean = NDArrayFactory::create<float>('c', {3}, {0.95f, 2.95f, 4.95f});
+  auto expBatchVar = NDArrayFactory::create<float>('c', {3}, {9.571795f, 9.571795f, 9.571795f});
+  std::vector<float> expValues(x.lengthOf());
+  for (LongType e = 0; e < x.lengthOf(); e++) {
+    auto c = (e / 20) % 3;
+    expValues[e] = scale.e<float>(c) * (x.e<float>(e) - expBatchMean.e<float>(c)) / std::sqrt(9.3325f + 0.01f) +
+                   offset.e<float>(c);
+  }
+  auto expY = NDArrayFactory::create<float>('c', {2, 3, 4, 5}, expValues);
+
+  ops::fused_batch_norm op;
+  auto results = op.evaluate({&x, &scale, &offset}, {0.01}, {1, 1});
+  ASSERT_EQ(sd::Status::OK, results.status());
+
+  ASSERT_TRUE(expY.equalsTo(results.at(0)));
+  ASSERT_TRUE(expBatchMean.equalsTo(results.at(1)));
+  ASSERT_TRUE(expBatchVar.equalsTo(results.at(2)));
+}
+
+//////////////////////////////////////////////////////////////////////
+TEST_F(DeclarableOpsTests5, fusedBatchNorm_test7) {
+  // NHWC with more rows than partial groups, so every group reduces several blocks of rows
+  auto x = NDArrayFactory::create<float>('c', {4, 16, 16, 3});
+  auto scale = NDArrayFactory::create<float>('c', {3}, {0.5f, -1.f, 2.f});
+  auto offset = NDArrayFactory::create<float>('c', {3}, {2.f, 0.f, -1.f});
+  x.linspace(-3, 0.01);
+
+  const LongType N = x.lengthOf() / 3;
+  std::vector<double> sums(3, 0.), sumsSq(3, 0.);
+  for (LongType e = 0; e < x.lengthOf(); e++) sums[e % 3] += x.e<double>(e);
+
+  std::vector<float> means(3), variances(3), unbiased(3);
+  for (int c = 0; c < 3; c++) means[c] = sums[c] / N;
+
+  for (LongType e = 0; e < x.lengthOf(); e++) {
+    auto d = x.e<double>(e) - means[e % 3];
+    sumsSq[e % 3] += d * d;
+  }
+
+  for (int c = 0; c < 3; c++) {
+    variances[c] = sumsSq[c] / N;
+    unbiased[c] = sumsSq[c] / (N - 1);
+  }
+
+  std::vector<float> expValues(x.lengthOf());
+  for (LongType e = 0; e < x.lengthOf(); e++) {
+    auto c = e % 3;
+    expValues[e] = scale.e<float>(c) * (x.e<float>(e) - means[c]) / std::sqrt(variances[c] + 0.01f) +
+                   offset.e<float>(c);
+  }
+  auto expY = NDArrayFactory::create<float>('c', {4, 16, 16, 3}, expValues);
+  auto expBatchMean = NDArrayFactory::create<float>('c', {3}, means);
+  auto expBatchVar = NDArrayFactory::create<float>('c', {3}, unbiased);
+
+  ops::fused_batch_norm op;
+  auto results = op.evaluate({&x, &scale, &offset}, {0.01}, {0, 1});
+  ASSERT_EQ(sd::Status::OK, results.status());
+
+  ASSERT_TRUE(expY.equalsTo(results.at(0), 1e-4));
+  ASSERT_TRUE(expBatchMean.equalsTo(results.at(1), 1e-4));
+  ASSERT_TRUE(expBatchVar.equalsTo(results.at(2), 1e-4));
+}
+
 //////////////////////////////////////////////////////////////////////
 TEST_F(DeclarableOpsTests5, confusion_matrix_test1) {
   auto labels = NDArrayFactory::create<LongType>('c', {1, 3}, {1, 2, 4});
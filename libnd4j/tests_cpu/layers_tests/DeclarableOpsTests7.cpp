@@ -4093,6 +4093,53 @@ TEST_F(DeclarableOpsTests7, Test_Reduce_Sum_7) {
   ASSERT_EQ(exp,*output);
 }
 
+////////////////////////////////////////////////////////////////////////////////
+TEST_F(DeclarableOpsTests7, Test_Reduce_Sum_8) {
+  // long float sum, plain sequential accumulation drifts by several percent here
+  auto x = NDArrayFactory::create<float>('c', {4000000});
+  float value = 0.1f;
+  x.assign(value);
+
+  ops::reduce_sum op;
+  auto result = op.evaluate({&x}, {}, {});
+  auto output = result.at(0);
+  ASSERT_NEAR(400000.0, output->e<double>(0), 1.0);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+TEST_F(DeclarableOpsTests7, Test_Reduce_Sum_9) {
+  // contiguous tads of odd length, longer than one block of lanes
+  auto x = NDArrayFactory::create<float>('c', {3, 2, 1027});
+  x.linspace(1);
+
+  ops::reduce_sum op;
+  auto result = op.evaluate({&x}, {}, {1, 2});
+  auto output = result.at(0);
+  ASSERT_EQ(3, output->lengthOf());
+  for (int i = 0; i < 3; i++) {
+    const double first = i * 2054.0 + 1.0;
+    ASSERT_NEAR(2054.0 * first + 2054.0 * 2053.0 / 2.0, output->e<double>(i), 4.0);
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+TEST_F(DeclarableOpsTests7, Test_Reduce_Sum_10) {
+  // reduction along outer axis, rows are streamed into per-column accumulators
+  auto x = NDArrayFactory::create<float>('c', {2100, 3});
+  x.linspace(1);
+
+  ops::reduce_sum op;
+  auto result = op.evaluate({&x}, {}, {0});
+  auto output = result.at(0);
+  ASSERT_EQ(3, output->lengthOf());
+  for (int c = 0; c < 3; c++) ASSERT_NEAR(3.0 * 2100.0 * 2099.0 / 2.0 + 2100.0 * (c + 1), output->e<double>(c), 4.0);
+
+  ops::reduce_max opMax;
+  auto resultMax = opMax.evaluate({&x}, {}, {0});
+  auto outputMax = resultMax.at(0);
+  for (int c = 0; c < 3; c++) ASSERT_EQ(6298.f + c, outputMax->e<float>(c));
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 TEST_F(DeclarableOpsTests7, Test_Reduce_Prod_01) {
   auto x = NDArrayFactory::create<double>('c', {2, 3, 2});
@@ -2533,6 +2533,34 @@ TEST_F(DeclarableOpsTests8, Test_Moments_7) {
   ASSERT_TRUE(expVariance.equalsTo(outputVariance));
 }
 
+////////////////////////////////////////////////////////////////////////////////
+TEST_F(DeclarableOpsTests8, Test_Moments_8) {
+  auto x = NDArrayFactory::create<double>('c', {2, 3, 4});
+  x.linspace(1);
+
+  // kept dimension between reduced ones
+  auto expMeans1 = NDArrayFactory::create<double>('c', {3}, {8.5, 12.5, 16.5});
+  auto expVariance1 = NDArrayFactory::create<double>('c', {3}, {37.25, 37.25, 37.25});
+
+  // kept dimensions aren't adjacent
+  auto expMeans2 = NDArrayFactory::create<double>('c', {2, 4}, {5., 6., 7., 8., 17., 18., 19., 20.});
+  double variance2 = 32. / 3.;
+  auto expVariance2 = NDArrayFactory::create<double>('c', {2, 4});
+  expVariance2.assign(variance2);
+
+  ops::moments op;
+  auto result1 = op.evaluate({&x}, {}, {0, 2});
+  ASSERT_EQ(sd::Status::OK, result1.status());
+  ASSERT_TRUE(expMeans1.equalsTo(result1.at(0)));
+  ASSERT_TRUE(expVariance1.equalsTo(result1.at(1)));
+
+  auto result2 = op.evaluate({&x}, {}, {1});
+  ASSERT_EQ(sd::Status::OK, result2.status());
+  ASSERT_TRUE(expMeans2.isSameShape(result2.at(0)));
+  ASSERT_TRUE(expMeans2.equalsTo(result2.at(0)));
+  ASSERT_TRUE(expVariance2.equalsTo(result2.at(1)));
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 TYPED_TEST(TypedDeclarableOpsTests8, LrnTest_01) {
   auto x = NDArrayFactory::create<TypeParam>('c', {1, 1, 2, 5}, {1.f, 2.f, 3.f, 4.f, 5.f, 6.f, 7.f, 8.f, 9.f, 10.f});
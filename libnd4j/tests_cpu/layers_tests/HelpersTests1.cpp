@@ -17,6 +17,8 @@
  *  * SPDX-License-Identifier: Apache-2.0
  *  *****************************************************************************
  */
+#include <helpers/BenchmarkHelper.h>
+#include <helpers/DeclarableBenchmark.h>
 #include <helpers/GradCheck.h>
 #include <helpers/MmulHelper.h>
 #include <helpers/biDiagonalUp.h>
@@ -2585,3 +2587,42 @@ TEST_F(HelpersTests1, lstmLayerCell_3) {
   ASSERT_TRUE(expC.isSameShape(c));
   ASSERT_TRUE(expC.equalsTo(c));
 }
+
+///////////////////////////////////////////////////////////////////
+TEST_F(HelpersTests1, BenchmarkHelper_percentile_1) {
+  std::vector<double> sorted = {1.0, 2.0, 3.0, 4.0, 5.0};
+
+  ASSERT_NEAR(1.0, BenchmarkHelper::percentile(sorted, 0.0), 1e-9);
+  ASSERT_NEAR(3.0, BenchmarkHelper::percentile(sorted, 0.5), 1e-9);
+  ASSERT_NEAR(4.6, BenchmarkHelper::percentile(sorted, 0.9), 1e-9);
+  ASSERT_NEAR(5.0, BenchmarkHelper::percentile(sorted, 1.0), 1e-9);
+}
+
+///////////////////////////////////////////////////////////////////
+TEST_F(HelpersTests1, BenchmarkHelper_grid_1) {
+  std::unique_ptr<ops::DeclarableOp> op(DeclarableBenchmark::legacyOp("transform_strict", transform::Sigmoid));
+
+  BenchmarkGrid grid;
+  grid.shapes = {{16, 16}};
+  grid.orders = {'c', 'f'};
+
+  BenchmarkHelper helper(1, 3, {1, 2});
+  auto results = helper.run(grid, [&](const BenchmarkPoint &point) -> OpBenchmark * {
+    auto shape = point.shape;
+    auto x = new NDArray(point.order, shape, point.dataType);
+    return new DeclarableBenchmark(op.get(), "sigmoid", {x});
+  });
+
+  ASSERT_EQ(4, results.size());
+  for (const auto &result : results) {
+    ASSERT_EQ(3, result.iterations);
+    ASSERT_EQ(16 * 16 * 4 * 2, result.bytes);
+    ASSERT_TRUE(result.min <= result.p50 && result.p50 <= result.max);
+  }
+
+  ASSERT_EQ(1, results[0].threads);
+  ASSERT_EQ(2, results[1].threads);
+
+  auto csv = BenchmarkHelper::toCsv(results);
+  ASSERT_EQ(5, std::count(csv.begin(), csv.end(), '\n'));
+}
@@ -20,13 +20,18 @@
 // @author raver119@gmail.com
 //
 #include <array/NDArray.h>
+#include <graph/ContextPool.h>
 #include <graph/FlatUtils.h>
 #include <graph/GraphHolder.h>
 #include <legacy/NativeOps.h>
 #include <ops/declarable/CustomOperations.h>
+#include <ops/declarable/OpCommandBuffer.h>
 #include <ops/declarable/OpRegistrator.h>
 
 #include <array>
+#include <atomic>
+#include <chrono>
+#include <thread>
 
 #include "testlayers.h"
 
@@ -1545,3 +1550,182 @@ TEST_F(JavaInteropTests, test_linspace_shape_1) {
 }
 
 
+
+TEST_F(JavaInteropTests, test_command_buffer_1) {
+  auto x = NDArrayFactory::create<float>('c', {3}, {1.f, 2.f, 3.f});
+  auto y = NDArrayFactory::create<float>('c', {3}, {4.f, 5.f, 6.f});
+  auto sum = NDArrayFactory::create<float>('c', {3});
+  auto product = NDArrayFactory::create<float>('c', {3});
+  auto expSum = NDArrayFactory::create<float>('c', {3}, {5.f, 7.f, 9.f});
+  auto expProduct = NDArrayFactory::create<float>('c', {3}, {5.f, 14.f, 27.f});
+
+  add opA;
+  multiply opB;
+  NDArray *arrays[] = {&x, &y, &sum, &product};
+
+  // sum = x + y, product = sum * x, second command depends on first one
+  std::vector<LongType> buffer = {OpCommandBuffer::VERSION, 0, 2,
+                                  opA.getOpHash(), 0, 2, 1, 0, 0, 0, 0, 0, 0, 1, 2,
+                                  opB.getOpHash(), 0, 2, 1, 0, 0, 0, 0, 0, 2, 0, 3};
+  int statuses[2] = {-1, -1};
+  auto status = execCommandBuffer(nullptr, buffer.data(), buffer.size(), arrays, 4, statuses, false);
+
+  ASSERT_EQ(sd::Status::OK, status);
+  ASSERT_EQ(0, statuses[0]);
+  ASSERT_EQ(0, statuses[1]);
+  ASSERT_EQ(expSum, sum);
+  ASSERT_EQ(expProduct, product);
+}
+
+TEST_F(JavaInteropTests, test_command_buffer_2) {
+  auto x = NDArrayFactory::create<float>('c', {3}, {1.f, 2.f, 3.f});
+  auto y = NDArrayFactory::create<float>('c', {3}, {4.f, 5.f, 6.f});
+  auto wrong = NDArrayFactory::create<float>('c', {4});
+  auto a = NDArrayFactory::create<float>('c', {3});
+  auto b = NDArrayFactory::create<float>('c', {3});
+  auto c = NDArrayFactory::create<float>('c', {3});
+  auto expA = NDArrayFactory::create<float>('c', {3}, {5.f, 7.f, 9.f});
+
+  add op;
+  NDArray *arrays[] = {&x, &y, &wrong, &a, &b, &c};
+
+  // a = x + y; b = x + wrong fails; c = a + b depends on both, so it's skipped
+  std::vector<LongType> buffer = {OpCommandBuffer::VERSION, OpCommandBuffer::FLAG_DEPENDENCIES, 3,
+                                  op.getOpHash(), 0, 2, 1, 0, 0, 0, 0, 0, 0, 1, 3,
+                                  op.getOpHash(), 0, 2, 1, 0, 0, 0, 0, 0, 0, 2, 4,
+                                  op.getOpHash(), 0, 2, 1, 0, 0, 0, 0, 2, 3, 4, 5, 0, 1};
+  OpCommandBuffer commands(buffer.data(), buffer.size(), arrays, 6);
+  ASSERT_EQ(3, commands.size());
+  ASSERT_EQ(2, commands.numLevels());
+  ASSERT_EQ(1, commands.at(2).level);
+
+  sd::Status statuses[3];
+  auto status = commands.execute(statuses, true);
+
+  ASSERT_NE(sd::Status::OK, status);
+  ASSERT_EQ(sd::Status::OK, statuses[0]);
+  ASSERT_NE(sd::Status::OK, statuses[1]);
+  ASSERT_EQ(sd::Status::MAYBE, statuses[2]);
+  ASSERT_EQ(expA, a);
+
+  // malformed buffers are rejected before anything runs
+  std::vector<LongType> truncated(buffer.begin(), buffer.end() - 1);
+  ASSERT_ANY_THROW(OpCommandBuffer(truncated.data(), truncated.size(), arrays, 6));
+}
+
+// copies its input, but only once given number of its calls run at the same time, and fails if they never do
+class RendezvousOp : public DeclarableCustomOp {
+ public:
+  std::atomic<int> arrived{0};
+  int expected = 0;
+
+  RendezvousOp() : DeclarableCustomOp(1, 1, "test_command_buffer_rendezvous", false, 0, 0) {}
+
+  ShapeList *calculateOutputShape(ShapeList *inputShape, Context &block) override {
+    return SHAPELIST(CONSTANT(inputShape->at(0)));
+  }
+
+ protected:
+  sd::Status validateAndExecute(Context &block) override {
+    arrived++;
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+    while (arrived.load() < expected) {
+      if (std::chrono::steady_clock::now() > deadline) return sd::Status::KERNEL_FAILURE;
+
+      std::this_thread::yield();
+    }
+
+    OUTPUT_VARIABLE(0)->assign(*INPUT_VARIABLE(0));
+    return sd::Status::OK;
+  }
+};
+
+TEST_F(JavaInteropTests, test_command_buffer_3) {
+  int numCommands = sd::math::sd_min<int>(4, Environment::getInstance().maxMasterThreads());
+  if (numCommands < 2) GTEST_SKIP() << "Needs at least 2 threads";
+
+  // registrator owns registered ops
+  static RendezvousOp *op = [] {
+    auto result = new RendezvousOp();
+    OpRegistrator::getInstance().registerOperation(result);
+    return result;
+  }();
+  op->arrived = 0;
+  op->expected = numCommands;
+
+  std::vector<NDArray> inputs, outputs;
+  for (int e = 0; e < numCommands; e++) {
+    inputs.emplace_back(NDArrayFactory::create<float>('c', {3}));
+    outputs.emplace_back(NDArrayFactory::create<float>('c', {3}));
+    float value = e + 1;
+    inputs.back().assign(value);
+  }
+
+  std::vector<NDArray *> arrays;
+  std::vector<LongType> buffer = {OpCommandBuffer::VERSION, OpCommandBuffer::FLAG_DEPENDENCIES, numCommands};
+  for (int e = 0; e < numCommands; e++) {
+    arrays.emplace_back(&inputs[e]);
+    arrays.emplace_back(&outputs[e]);
+    buffer.insert(buffer.end(), {op->getOpHash(), 0, 1, 1, 0, 0, 0, 0, 0, 2 * e, 2 * e + 1});
+  }
+
+  // independent commands share one level, so each of them runs on its own thread and they all meet
+  OpCommandBuffer commands(buffer.data(), buffer.size(), arrays.data(), arrays.size());
+  ASSERT_EQ(1, commands.numLevels());
+
+  std::vector<sd::Status> statuses(numCommands);
+  ASSERT_EQ(sd::Status::OK, commands.execute(statuses.data(), true));
+  for (int e = 0; e < numCommands; e++) {
+    ASSERT_EQ(sd::Status::OK, statuses[e]);
+    ASSERT_EQ(inputs[e], outputs[e]);
+  }
+}
+
+TEST_F(JavaInteropTests, test_prepared_call_1) {
+  auto x = NDArrayFactory::create<float>('c', {3}, {1.f, 2.f, 3.f});
+  auto y = NDArrayFactory::create<float>('c', {3}, {4.f, 5.f, 6.f});
+  auto z = NDArrayFactory::create<float>('c', {3});
+  auto wrong = NDArrayFactory::create<float>('c', {4});
+  auto exp1 = NDArrayFactory::create<float>('c', {3}, {5.f, 7.f, 9.f});
+  auto exp2 = NDArrayFactory::create<float>('c', {3}, {2.f, 4.f, 6.f});
+
+  auto &pool = ContextPool::getInstance();
+  pool.purge();
+
+  add op;
+  auto call = pool.prepare(op.getOpHash(), nullptr, 0, nullptr, 0, nullptr, 0, nullptr, 0, false);
+  call->setInput(0, &x);
+  call->setInput(1, &y);
+  ASSERT_EQ(1, call->bindOutputShapes());
+  ASSERT_TRUE(shape::equalsSoft(z.shapeInfo(), call->outputShape(0)));
+
+  call->setOutput(0, &z);
+  ASSERT_EQ(sd::Status::OK, call->execute());
+  ASSERT_EQ(exp1, z);
+
+  // only arrays are swapped between invocations
+  call->setInput(1, &x);
+  ASSERT_EQ(sd::Status::OK, call->execute());
+  ASSERT_EQ(exp2, z);
+
+  call->setOutput(0, &wrong);
+  ASSERT_EQ(sd::Status::BAD_OUTPUT, call->execute());
+
+  call->context()->addIntermediateResult(&x);
+  call->context()->setExecutionMode(samediff::ExecutionMode::MODE_TRAINING);
+  pool.release(call);
+  ASSERT_EQ(1, pool.numIdle());
+
+  // released context is reused, without arguments and arrays of previous call
+  LongType iArgs[] = {1};
+  call = pool.prepare(op.getOpHash(), iArgs, 1, nullptr, 0, nullptr, 0, nullptr, 0, false);
+  ASSERT_EQ(1, pool.reused());
+  ASSERT_EQ(1, call->context()->getIArguments()->size());
+  ASSERT_TRUE(call->context()->fastpath_in().empty());
+  ASSERT_FALSE(call->context()->shapeFunctionOverride());
+  ASSERT_EQ(0, call->context()->numIntermediates());
+  ASSERT_EQ(samediff::ExecutionMode::MODE_UNDEFINED, call->context()->executionMode());
+
+  pool.release(call);
+  pool.purge();
+}
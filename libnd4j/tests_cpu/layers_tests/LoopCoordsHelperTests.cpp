@@ -19,6 +19,7 @@
 //
 // @author Abdelrauf
 //
+#include <helpers/LoopKind.h>
 #include <helpers/LoopsCoordsHelper.h>
 
 #include <type_traits>
@@ -208,4 +209,51 @@ TEST_F(LoopCoordsHelper, Increment_Use_Tests) {
     zoffset2 = inc_coords(shape, strides_c, strides_c, zcoords2, zoffset2, Rank);
     zoffset2_f = inc_coords<false>(shape, strides_f, strides_f, zcoords2_f, zoffset2_f, Rank);
   }
-}
\ No newline at end of file
+}
+TEST_F(LoopCoordsHelper, Collapse_Tests) {
+  // c-ordered [2, 3, 4, 5] view with stride 2 along axis 1 is effectively rank 2
+  auto x = NDArrayFactory::create<float>('c', {2, 6, 4, 5});
+  auto view = x({0, 0, 0, 0, 6, 2, 0, 0, 0, 0, 0, 0}, false, true);
+  auto z = NDArrayFactory::create<float>('c', {2, 3, 4, 5});
+
+  CollapsedLoop loop;
+  ASSERT_TRUE(LoopKind::collapseXZ(view.shapeInfo(), z.shapeInfo(), loop));
+  ASSERT_EQ(2, loop.rank);
+  ASSERT_EQ(6, loop.shape[0]);
+  ASSERT_EQ(20, loop.shape[1]);
+  ASSERT_EQ(40, loop.xStrides[0]);
+  ASSERT_EQ(1, loop.xStrides[1]);
+  ASSERT_EQ(20, loop.zStrides[0]);
+  ASSERT_EQ(1, loop.zStrides[1]);
+
+  // all offsets of both arrays are visited exactly once, regardless of split point
+  std::vector<LongType> xOffsets, zOffsets;
+  auto func = [&](LongType xOffset, LongType, LongType zOffset) {
+    xOffsets.push_back(xOffset);
+    zOffsets.push_back(zOffset);
+  };
+  LoopKind::iterate(loop, 0, 37, func);
+  LoopKind::iterate(loop, 37, z.lengthOf(), func);
+
+  ASSERT_EQ(z.lengthOf(), static_cast<LongType>(zOffsets.size()));
+  for (LongType e = 0; e < z.lengthOf(); e++) {
+    ASSERT_EQ(e, zOffsets[e]);
+    ASSERT_EQ((e / 20) * 40 + e % 20, xOffsets[e]);
+  }
+}
+
+TEST_F(LoopCoordsHelper, Collapse_Broadcast_Tests) {
+  auto x = NDArrayFactory::create<float>('c', {3, 4});
+  auto y = NDArrayFactory::create<float>('c', {3, 1}, {10.f, 20.f, 30.f});
+  auto e = NDArrayFactory::create<float>('c', {3, 4}, {11.f, 12.f, 13.f, 14.f, 25.f, 26.f, 27.f, 28.f, 39.f, 40.f, 41.f, 42.f});
+  x.linspace(1);
+
+  // broadcast dimension gets zero stride
+  CollapsedLoop loop;
+  ASSERT_TRUE(LoopKind::collapseXYZ(x.shapeInfo(), y.shapeInfo(), x.shapeInfo(), loop));
+  ASSERT_EQ(2, loop.rank);
+  ASSERT_EQ(0, loop.yStrides[1]);
+
+  auto z = x + y;
+  ASSERT_TRUE(e.equalsTo(&z));
+}
@@ -19,8 +19,10 @@
 //
 // Created by raver119 on 21.11.17.
 //
+#include <array/LayoutRequest.h>
 #include <array/NDArray.h>
 #include <helpers/DebugHelper.h>
+#include <helpers/StridedCopy.h>
 #include <ops/declarable/headers/parity_ops.h>
 
 #include <memory>
@@ -1199,3 +1201,120 @@ TEST_F(NDArrayTest2, test_numpy_import_1) {
 
   ASSERT_EQ(exp, array);
 }
+
+TEST_F(NDArrayTest2, test_contiguous_1) {
+  auto x = NDArrayFactory::create<float>('c', {2, 3, 4});
+  x.linspace(1);
+
+  ASSERT_TRUE(x.isContiguous('c'));
+  ASSERT_FALSE(x.isContiguous('f'));
+
+  std::vector<LongType> perm = {2, 1, 0};
+  auto &p = x.permute(perm, false, false);
+  ASSERT_TRUE(p.isContiguous('f'));
+  ASSERT_TRUE(p.isContiguous());
+  ASSERT_FALSE(p.isContiguous('c'));
+
+  // dense view shares buffer with original array
+  auto view = p.contiguous();
+  ASSERT_EQ(x.buffer(), view.buffer());
+
+  // while non-dense one gets materialized
+  auto copy = p.contiguous('c');
+  ASSERT_NE(x.buffer(), copy.buffer());
+  ASSERT_TRUE(copy.isContiguous('c'));
+  ASSERT_TRUE(p.equalsTo(&copy));
+}
+
+TEST_F(NDArrayTest2, test_layout_request_1) {
+  auto x = NDArrayFactory::create<float>('c', {4, 6});
+  x.linspace(1);
+
+  auto sub = x({0, 0, 1, 4});
+  ASSERT_FALSE(sub.isContiguous());
+
+  LayoutRequest strided(&sub, LayoutRequest::UNIT_STRIDE);
+  ASSERT_FALSE(strided.materialized());
+  ASSERT_EQ(&sub, strided.array());
+
+  LayoutRequest dense(&sub, LayoutRequest::DENSE);
+  ASSERT_TRUE(dense.materialized());
+  ASSERT_TRUE(dense.array()->isContiguous());
+  ASSERT_TRUE(sub.equalsTo(dense.array()));
+}
+
+TEST_F(NDArrayTest2, test_layout_request_2) {
+  auto x = NDArrayFactory::create<float>('c', {4, 6});
+  auto e = NDArrayFactory::create<float>('c', {4, 6});
+  e.linspace(1);
+  float zero = 0.f;
+  e({0, 0, 1, 4}).assign(zero);
+
+  x.linspace(1);
+  auto sub = x({0, 0, 1, 4});
+
+  {
+    LayoutRequest request(&sub, LayoutRequest::F_ORDER, true);
+    ASSERT_TRUE(request.materialized());
+    request.array()->assign(zero);
+  }
+
+  ASSERT_TRUE(e.equalsTo(&x));
+}
+
+TEST_F(NDArrayTest2, test_permuted_assign_1) {
+  auto x = NDArrayFactory::create<float>('c', {2, 5, 9, 13});
+  x.linspace(1);
+
+  // NCHW -> NHWC
+  std::vector<LongType> perm = {0, 2, 3, 1};
+  auto &p = x.permute(perm, false, false);
+  auto z = NDArrayFactory::create<float>('c', {2, 9, 13, 5});
+  z.assign(p);
+
+  for (LongType n = 0; n < 2; n++)
+    for (LongType h = 0; h < 9; h++)
+      for (LongType w = 0; w < 13; w++)
+        for (LongType c = 0; c < 5; c++) ASSERT_EQ(x.e<float>(n, c, h, w), z.e<float>(n, h, w, c));
+}
+
+TEST_F(NDArrayTest2, test_permuted_assign_2) {
+  auto x = NDArrayFactory::create<double>('c', {3, 17, 4, 11});
+  x.linspace(1);
+
+  // head split: [batch, heads, time, size] -> [batch, time, heads, size]
+  std::vector<LongType> perm = {0, 2, 1, 3};
+  auto &p = x.permute(perm, false, false);
+  auto z = p.dup('c');
+  auto f = p.dup('f');
+
+  for (LongType b = 0; b < 3; b++)
+    for (LongType t = 0; t < 4; t++)
+      for (LongType h = 0; h < 17; h++)
+        for (LongType s = 0; s < 11; s++) {
+          ASSERT_EQ(x.e<double>(b, h, t, s), z.e<double>(b, t, h, s));
+          ASSERT_EQ(x.e<double>(b, h, t, s), f.e<double>(b, t, h, s));
+        }
+}
+
+TEST_F(NDArrayTest2, test_strided_copy_collapse_1) {
+  // c-ordered [2, 1, 3, 4] permuted to [2, 4, 3], copied into c-ordered output
+  LongType shape[] = {2, 1, 4, 3};
+  LongType xStrides[] = {12, 12, 1, 4};
+  LongType zStrides[] = {12, 12, 3, 1};
+
+  auto rank = StridedCopy::collapse(4, shape, xStrides, zStrides);
+  ASSERT_EQ(3, rank);
+  ASSERT_EQ(2, shape[0]);
+  ASSERT_EQ(4, shape[1]);
+  ASSERT_EQ(3, shape[2]);
+
+  // dense arrays collapse to a single dimension
+  LongType dShape[] = {2, 3, 4};
+  LongType dxStrides[] = {12, 4, 1};
+  LongType dzStrides[] = {12, 4, 1};
+  rank = StridedCopy::collapse(3, dShape, dxStrides, dzStrides);
+  ASSERT_EQ(1, rank);
+  ASSERT_EQ(24, dShape[0]);
+  ASSERT_EQ(1, dxStrides[0]);
+}
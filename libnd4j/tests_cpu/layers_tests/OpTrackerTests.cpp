@@ -21,10 +21,16 @@
 //
 #include <graph/Graph.h>
 #include <graph/Node.h>
+#include <helpers/DeclarableBenchmark.h>
+#include <helpers/HardwareCounters.h>
+#include <helpers/OpLatencyHistograms.h>
 #include <helpers/OpTracker.h>
+#include <helpers/TimelineTracer.h>
+#include <ops/declarable/OpExecTraceFile.h>
 #include <ops/declarable/CustomOperations.h>
 
 #include <chrono>
+#include <sstream>
 
 #include "testlayers.h"
 
@@ -61,3 +67,194 @@ TEST_F(OpTrackerTests, Test_Ops_List_1) {
     }
   }
 }
+
+TEST_F(OpTrackerTests, Test_Trace_File_1) {
+  auto x = NDArrayFactory::create<float>('c', {2, 3});
+  auto z = NDArrayFactory::create<double>('f', {3});
+
+  std::string name("reduce_sum");
+  std::vector<LongType> iArgs = {0, -1};
+  std::vector<double> tArgs = {0.1, 1e-7};
+  std::vector<bool> bArgs = {true, false};
+  std::vector<std::string> sArgs = {"with space", ""};
+  OpExecTrace trace(new std::vector<const LongType *>({x.shapeInfo()}),
+                    new std::vector<const LongType *>({z.shapeInfo()}), &name, &iArgs, &tArgs, &bArgs, &sArgs, -1);
+  trace.setDArgs({DOUBLE});
+
+  std::stringstream stream;
+  OpExecTraceFile::write(stream, {&trace});
+  auto restored = OpExecTraceFile::read(stream);
+
+  ASSERT_EQ(1, restored.size());
+  auto r = restored[0];
+  ASSERT_EQ(name, *r->opName);
+  ASSERT_EQ(1, r->inputShapeBuffers->size());
+  ASSERT_TRUE(shape::equalsStrict(x.shapeInfo(), r->inputShapeBuffers->at(0)));
+  ASSERT_TRUE(shape::equalsStrict(z.shapeInfo(), r->outputShapeBuffers->at(0)));
+  ASSERT_EQ(iArgs, r->iArgs);
+  ASSERT_EQ(tArgs, r->tArgs);
+  ASSERT_EQ(bArgs, r->bArgs);
+  ASSERT_EQ(sArgs, r->sArguments);
+  ASSERT_EQ(1, r->dArgs.size());
+  ASSERT_EQ(DOUBLE, r->dArgs[0]);
+
+  OpExecTraceFile::release(restored);
+  delete trace.inputShapeBuffers;
+  delete trace.outputShapeBuffers;
+}
+
+TEST_F(OpTrackerTests, Test_Trace_Replay_1) {
+  auto x = NDArrayFactory::create<float>('c', {4, 5});
+  auto z = NDArrayFactory::create<float>('c', {5});
+  sd::ops::reduce_sum op;
+
+  OpRegistrator::getInstance().purgeOpExecs();
+  OpRegistrator::getInstance().toggleTraceOps(true);
+  auto status = op.execute({&x}, {&z}, {}, {0}, {});
+  OpRegistrator::getInstance().toggleTraceOps(false);
+  ASSERT_EQ(sd::Status::OK, status);
+
+  auto traces = *OpRegistrator::getInstance().execTrace();
+  ASSERT_EQ(1, traces.size());
+  ASSERT_EQ(1, traces[0]->iArgs.size());
+
+  std::unique_ptr<DeclarableBenchmark> benchmark(DeclarableBenchmark::fromTrace(*traces[0]));
+  ASSERT_TRUE(benchmark != nullptr);
+  ASSERT_EQ(1, benchmark->inputs().size());
+  ASSERT_TRUE(benchmark->outputs()[0]->isSameShape(z));
+  benchmark->executeOnce();
+
+  OpRegistrator::getInstance().purgeOpExecs();
+}
+
+TEST_F(OpTrackerTests, Test_Latency_Buckets_1) {
+  for (uint64_t v : {0ULL, 7ULL, 15ULL, 16ULL, 31ULL, 32ULL, 1000ULL, 123456789ULL}) {
+    auto bucket = LatencyBuckets::bucketFor(v);
+    ASSERT_LE(LatencyBuckets::lowerBound(bucket), v);
+    ASSERT_GE(LatencyBuckets::upperBound(bucket), v);
+  }
+
+  ASSERT_EQ(LatencyBuckets::NUM_BUCKETS - 1, LatencyBuckets::bucketFor(~0ULL));
+
+  OpLatencySnapshot snapshot;
+  snapshot.buckets.resize(LatencyBuckets::NUM_BUCKETS, 0);
+  for (uint64_t e = 1; e <= 1000; e++) {
+    snapshot.buckets[LatencyBuckets::bucketFor(e * 1000)]++;
+    snapshot.count++;
+    snapshot.maxNanos = e * 1000;
+  }
+
+  // buckets are 1/16 of their power of two wide
+  ASSERT_NEAR(500000.0, snapshot.percentile(0.5), 500000.0 / 16);
+  ASSERT_NEAR(990000.0, snapshot.percentile(0.99), 990000.0 / 16);
+  ASSERT_LE(snapshot.percentile(1.0), 1000000.0);
+}
+
+TEST_F(OpTrackerTests, Test_Latency_Histograms_1) {
+  auto x = NDArrayFactory::create<float>('c', {4, 5});
+  auto z = NDArrayFactory::create<float>('c', {5});
+  sd::ops::reduce_sum op;
+
+  auto &histograms = OpLatencyHistograms::getInstance();
+  OpLatencyHistograms::setEnabled(true);
+  histograms.reset();
+
+  for (int e = 0; e < 3; e++) ASSERT_EQ(sd::Status::OK, op.execute({&x}, {&z}, {}, {0}, {}));
+
+  auto snapshot = histograms.snapshot(op.getOpHash());
+  ASSERT_EQ(3, snapshot.count);
+  ASSERT_EQ(3 * 20 * sizeof(float), snapshot.bytesIn);
+  ASSERT_EQ(3 * 5 * sizeof(float), snapshot.bytesOut);
+  ASSERT_LE(snapshot.percentile(0.5), snapshot.percentile(0.999));
+
+  OpLatencyHistograms::setEnabled(false);
+  ASSERT_EQ(sd::Status::OK, op.execute({&x}, {&z}, {}, {0}, {}));
+  OpLatencyHistograms::setEnabled(true);
+  ASSERT_EQ(3, histograms.snapshot(op.getOpHash()).count);
+
+  std::string report = histograms.report();
+  ASSERT_NE(std::string::npos, report.find("reduce_sum"));
+}
+
+TEST_F(OpTrackerTests, Test_Timeline_Trace_1) {
+  auto x = NDArrayFactory::create<float>('c', {4, 5});
+  auto z = NDArrayFactory::create<float>('c', {5});
+  sd::ops::reduce_sum op;
+
+  auto &tracer = TimelineTracer::getInstance();
+  tracer.purge();
+  TimelineTracer::setEnabled(true);
+  auto status = op.execute({&x}, {&z}, {}, {0}, {});
+  tracer.instant(TimelineCategory::MEMORY, "test_event", 16);
+  TimelineTracer::setEnabled(false);
+  ASSERT_EQ(sd::Status::OK, status);
+  ASSERT_LE(2, tracer.numEvents());
+
+  std::stringstream stream;
+  tracer.write(stream);
+  auto json = stream.str();
+  ASSERT_EQ(0, json.find("{\"traceEvents\":["));
+  ASSERT_NE(std::string::npos, json.find("\"name\":\"reduce_sum\",\"cat\":\"op\",\"ph\":\"X\""));
+  ASSERT_NE(std::string::npos, json.find("\"args\":{\"value\":16}"));
+
+  tracer.purge();
+  ASSERT_EQ(0, tracer.numEvents());
+}
+
+TEST_F(OpTrackerTests, Test_Hardware_Counters_1) {
+  auto x = NDArrayFactory::create<float>('c', {4, 5});
+  auto z = NDArrayFactory::create<float>('c', {5});
+  sd::ops::reduce_sum op;
+
+  ASSERT_EQ(2 * 64 + 4, HardwareCounters::shapeClass(x.shapeInfo()));
+  ASSERT_EQ(std::string("rank2_len2^4"), HardwareCounters::shapeClassName(HardwareCounters::shapeClass(x.shapeInfo())));
+
+  auto &counters = HardwareCounters::getInstance();
+  counters.reset();
+
+  HardwareCounterValues before, after;
+  after.values[static_cast<int>(HardwareCounter::CYCLES)] = 1000;
+  after.values[static_cast<int>(HardwareCounter::INSTRUCTIONS)] = 2500;
+  after.values[static_cast<int>(HardwareCounter::CACHE_REFERENCES)] = 100;
+  after.values[static_cast<int>(HardwareCounter::CACHE_MISSES)] = 10;
+  counters.record(17, "synthetic", 5, 640, before, after);
+  counters.record(17, "synthetic", 5, 640, before, after);
+
+  // other threads may record their own ops meanwhile, so we only look at entries of our key and shape class
+  auto find = [&](LongType key, int shapeClass) {
+    std::vector<HardwareCounterSnapshot> result;
+    for (const auto &snapshot : counters.snapshots())
+      if (snapshot.key == key && snapshot.shapeClass == shapeClass) result.emplace_back(snapshot);
+
+    return result;
+  };
+
+  auto synthetic = find(17, 5);
+  ASSERT_EQ(1, synthetic.size());
+  ASSERT_EQ(2, synthetic[0].count);
+  ASSERT_NEAR(2.5, synthetic[0].instructionsPerCycle(), 1e-9);
+  ASSERT_NEAR(0.1, synthetic[0].cacheMissRate(), 1e-9);
+  ASSERT_NEAR(1.0, synthetic[0].estimatedBandwidth(), 1e-9);
+  counters.reset();
+
+  // real counters are optional: containers and VMs often have no PMU access
+  HardwareCounters::setEnabled(true);
+  auto status = op.execute({&x}, {&z}, {}, {0}, {});
+  HardwareCounters::setEnabled(false);
+  ASSERT_EQ(sd::Status::OK, status);
+
+  // counters measure calling thread only, and that's where op ran
+  auto measured = find(op.getOpHash(), HardwareCounters::shapeClass(x.shapeInfo()));
+  if (HardwareCounters::isSupported()) {
+    ASSERT_EQ(1, measured.size());
+    ASSERT_EQ(1, measured[0].count);
+    ASSERT_LT(0, measured[0].counters.get(HardwareCounter::INSTRUCTIONS));
+
+    std::string report = counters.report();
+    ASSERT_NE(std::string::npos, report.find("reduce_sum,"));
+  } else {
+    ASSERT_TRUE(measured.empty());
+  }
+
+  counters.reset();
+}
@@ -645,6 +645,39 @@ TEST_F(ParityOpsTests, Test_Scatter_Add_4) {
   ASSERT_TRUE(exp.equalsTo(z));
 }
 
+TEST_F(ParityOpsTests, Test_Scatter_Add_Locked_1) {
+  // many repeated rows, updates are partitioned by destination row between threads
+  auto matrix = NDArrayFactory::create<float>('c', {10, 4});
+  auto idc = NDArrayFactory::create<sd::LongType>('c', {200});
+  auto updates = NDArrayFactory::create<float>('c', {200, 4});
+  auto exp = NDArrayFactory::create<float>('c', {10, 4});
+  for (int e = 0; e < 200; e++) {
+    idc.p(e, (e * 7) % 10);
+    for (int c = 0; c < 4; c++) {
+      updates.p(e * 4 + c, static_cast<float>(e + c));
+      exp.p((e * 7) % 10 * 4 + c, exp.e<float>((e * 7) % 10 * 4 + c) + static_cast<float>(e + c));
+    }
+  }
+
+  scatter_add op;
+  auto result = op.evaluate({&matrix, &idc, &updates}, {}, {}, {true});
+  ASSERT_EQ(sd::Status::OK, result.status());
+  ASSERT_EQ(exp, *result.at(0));
+}
+
+TEST_F(ParityOpsTests, Test_Scatter_Update_Locked_1) {
+  // the last update of repeated row wins, as in sequential execution
+  auto matrix = NDArrayFactory::create<float>('c', {4, 2});
+  NDArray idc('c', {5}, std::vector<double>{1, 3, 1, 0, 1}, INT64);
+  auto updates = NDArrayFactory::create<float>('c', {5, 2}, {1, 1, 2, 2, 3, 3, 4, 4, 5, 5});
+  auto exp = NDArrayFactory::create<float>('c', {4, 2}, {4, 4, 5, 5, 0, 0, 2, 2});
+
+  scatter_upd op;
+  auto result = op.evaluate({&matrix, &idc, &updates}, {}, {}, {true});
+  ASSERT_EQ(sd::Status::OK, result.status());
+  ASSERT_EQ(exp, *result.at(0));
+}
+
 TEST_F(ParityOpsTests, Test_Scatter_Add_5) {
   auto matrix = NDArrayFactory::create<float>('c', {2, 2, 3}, {1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1});
   NDArray idc('c', {2, 2}, {1., 1, 0, 0}, INT64);
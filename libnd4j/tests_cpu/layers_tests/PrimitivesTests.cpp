@@ -32,6 +32,7 @@
 #include <helpers/RandomLauncher.h>
 #include <helpers/threshold.h>
 #include <loops/type_conversions.h>
+#include <math/vectormath.h>
 #include <ops/declarable/CustomOperations.h>
 #include <ops/declarable/helpers/addBias.h>
 #include <ops/declarable/helpers/axis.h>
@@ -44,6 +45,8 @@
 
 #include <array>
 #include <chrono>
+#include <cmath>
+#include <limits>
 #include <random>
 
 #include "testlayers.h"
@@ -84,3 +87,67 @@ TEST_F(PrimitivesTests, test_mod_3) {
 
   // absence of SIGFPE will be a good enough
 }
+
+// distance between float approximation and double reference, in units of float spacing at reference
+static double ulpError(float value, double reference) {
+  const float rounded = static_cast<float>(reference);
+  const double ulp = std::nextafter(std::fabs(rounded), std::numeric_limits<float>::infinity()) - std::fabs(rounded);
+  return std::fabs(static_cast<double>(value) - reference) / ulp;
+}
+
+TEST_F(PrimitivesTests, test_vector_math_1) {
+  using namespace sd::math::vec;
+  double maxError[7] = {0.};
+
+  for (int i = 0; i <= 200000; i++) {
+    // arguments are rounded through volatile, otherwise fast-math builds compute reference from unrounded value
+    volatile float vx = -40.f + i * 4e-4f;
+    const float x = vx;
+    maxError[0] = sd::math::sd_max<double>(maxError[0], ulpError(expFloat(x), std::exp(static_cast<double>(x))));
+    maxError[1] = sd::math::sd_max<double>(maxError[1], ulpError(tanhFloat(x), std::tanh(static_cast<double>(x))));
+    maxError[2] = sd::math::sd_max<double>(
+        maxError[2], ulpError(sigmoidFloat(x), 1. / (1. + std::exp(-static_cast<double>(x)))));
+    maxError[3] = sd::math::sd_max<double>(maxError[3], ulpError(erfFloat(x), std::erf(static_cast<double>(x))));
+    maxError[4] = sd::math::sd_max<double>(
+        maxError[4], ulpError(softplusFloat(x), std::log1p(std::exp(static_cast<double>(x)))));
+
+    volatile float vy = std::ldexp(1.f + i / 200001.f, i % 252 - 126);
+    const float y = vy;
+    maxError[5] = sd::math::sd_max<double>(maxError[5], ulpError(logFloat(y), std::log(static_cast<double>(y))));
+    maxError[6] = sd::math::sd_max<double>(maxError[6], ulpError(log1pFloat(y), std::log1p(static_cast<double>(y))));
+  }
+
+  for (int e = 0; e < 7; e++) ASSERT_LT(maxError[e], 3.) << "function #" << e;
+}
+
+TEST_F(PrimitivesTests, test_vector_math_2) {
+  using namespace sd::math::vec;
+  const float inf = std::numeric_limits<float>::infinity();
+  const float nan = std::numeric_limits<float>::quiet_NaN();
+
+  ASSERT_EQ(inf, expFloat(100.f));
+  ASSERT_EQ(0.f, expFloat(-120.f));
+  ASSERT_EQ(-inf, logFloat(0.f));
+  ASSERT_EQ(inf, logFloat(inf));
+  // NaNs are checked on bits, std::isnan is folded to false in fast-math builds
+  ASSERT_TRUE(isNan(logFloat(-1.f)));
+  ASSERT_TRUE(isNan(logFloat(-inf)));
+  ASSERT_TRUE(isNan(log1pFloat(-2.f)));
+  ASSERT_EQ(-inf, log1pFloat(-1.f));
+  ASSERT_EQ(1.f, tanhFloat(inf));
+  ASSERT_EQ(-1.f, tanhFloat(-inf));
+  ASSERT_EQ(1.f, sigmoidFloat(inf));
+  ASSERT_EQ(0.f, sigmoidFloat(-inf));
+  ASSERT_EQ(-1.f, erfFloat(-inf));
+  ASSERT_EQ(200.f, softplusFloat(200.f));
+
+  float (*functions[])(float) = {expFloat, logFloat, log1pFloat, tanhFloat, sigmoidFloat, erfFloat, softplusFloat};
+  for (auto f : functions) {
+    ASSERT_TRUE(isNan(f(nan)));
+    ASSERT_TRUE(isNan(f(-nan)));
+  }
+
+  // half types are computed via float kernels
+  ASSERT_NEAR(0.7615942f, static_cast<float>(sd::math::vec::tanh<float16>(static_cast<float16>(1.f))), 1e-3f);
+  ASSERT_NEAR(0.7310586, sd::math::vec::sigmoid<double>(1.), 1e-7);
+}
@@ -19,6 +19,7 @@
 //
 // @author raver119@gmail.com
 //
+#include <execution/PrefetchQueue.h>
 #include <execution/ThreadPool.h>
 #include <execution/Threads.h>
 #include <loops/type_conversions.h>
@@ -212,3 +213,150 @@ TEST_F(ThreadsTests, crash_test_1) {
 }
 
 
+
+TEST_F(ThreadsTests, prefetch_queue_ordering_1) {
+  auto proto = NDArrayFactory::create<float>('c', {4, 8});
+  PrefetchQueue queue({proto.shapeInfo()}, 3);
+
+  const LongType numBatches = 50;
+  queue.start(4, [&](LongType sequence, PrefetchBatch &batch) -> bool {
+    if (sequence >= numBatches) return false;
+
+    float value = static_cast<float>(sequence);
+    batch.at(0)->assign(value);
+    return true;
+  });
+
+  LongType cnt = 0;
+  while (auto batch = queue.next()) {
+    ASSERT_EQ(cnt, batch->sequence());
+    ASSERT_NEAR(static_cast<float>(cnt), batch->at(0)->e<float>(0), 1e-5f);
+    ASSERT_NEAR(static_cast<float>(cnt), batch->at(0)->e<float>(31), 1e-5f);
+    queue.release(batch);
+    cnt++;
+  }
+
+  queue.join();
+  ASSERT_EQ(numBatches, cnt);
+}
+
+TEST_F(ThreadsTests, prefetch_queue_backpressure_1) {
+  auto proto = NDArrayFactory::create<float>('c', {2});
+  PrefetchQueue queue({proto.shapeInfo(), proto.shapeInfo()}, 2);
+
+  // producers can't go further than capacity batches ahead of released ones
+  const LongType numBatches = 20;
+  std::atomic<LongType> released;
+  std::atomic<LongType> violations;
+  released.store(0);
+  violations.store(0);
+  queue.start(2, [&](LongType sequence, PrefetchBatch &batch) -> bool {
+    if (sequence >= released.load() + queue.capacity()) violations++;
+
+    return sequence < numBatches;
+  });
+
+  LongType cnt = 0;
+  while (auto batch = queue.next()) {
+    ASSERT_EQ(2, batch->size());
+    ASSERT_EQ(cnt, batch->sequence());
+    cnt++;
+    released++;
+    queue.release(batch);
+  }
+
+  queue.join();
+  ASSERT_EQ(numBatches, cnt);
+  ASSERT_EQ(0, violations.load());
+}
+
+TEST_F(ThreadsTests, prefetch_queue_error_1) {
+  auto proto = NDArrayFactory::create<float>('c', {2});
+  PrefetchQueue queue({proto.shapeInfo()}, 4);
+
+  // batches preceding the failed one are delivered, no matter which producer finished first
+  const LongType failure = 7;
+  queue.start(3, [&](LongType sequence, PrefetchBatch &batch) -> bool {
+    if (sequence == failure) throw std::runtime_error("producer failure");
+
+    float value = static_cast<float>(sequence);
+    batch.at(0)->assign(value);
+    return true;
+  });
+
+  for (LongType e = 0; e < failure; e++) {
+    auto batch = queue.next();
+    ASSERT_TRUE(batch != nullptr);
+    ASSERT_EQ(e, batch->sequence());
+    ASSERT_NEAR(static_cast<float>(e), batch->at(0)->e<float>(0), 1e-5f);
+    queue.release(batch);
+  }
+
+  ASSERT_ANY_THROW(queue.next());
+  queue.join();
+}
+
+TEST_F(ThreadsTests, cost_model_threads_1) {
+  CostModelParams params;
+  params.threads = 16;
+  params.bandwidthSingle = 10.0;
+  params.bandwidthAll = 80.0;
+  params.flopsPerNs = 8.0;
+  params.wakeupNs2 = 2000.0;
+  params.wakeupNsAll = 10000.0;
+
+  auto threshold = Environment::getInstance().elementwiseThreshold();
+  auto &model = CostModel::getInstance();
+  model.setParams(params);
+
+  // small loops aren't worth waking anyone up
+  ASSERT_EQ(1, ThreadsHelper::numberOfThreads(16, 1024));
+  ASSERT_EQ(1, ThreadsHelper::numberOfThreads(16, 1024, OpCostClass::TRANSCENDENTAL));
+
+  // memory bound loops stop scaling once bandwidth is saturated, compute bound ones don't
+  auto n = 64 * 1024 * 1024;
+  ASSERT_EQ(8, ThreadsHelper::numberOfThreads(16, n, OpCostClass::ELEMENTWISE));
+  ASSERT_EQ(16, ThreadsHelper::numberOfThreads(16, n, OpCostClass::TRANSCENDENTAL));
+
+  // TAD loops are estimated by total number of elements, but can't use more threads than TADs
+  ASSERT_EQ(8, ThreadsHelper::numberOfThreadsTad(16, 1024, n, OpCostClass::ELEMENTWISE));
+  ASSERT_EQ(4, ThreadsHelper::numberOfThreadsTad(16, 4, n, OpCostClass::TRANSCENDENTAL));
+
+  auto breakEven = model.breakEvenElements(OpCostClass::ELEMENTWISE);
+  ASSERT_LT(model.estimateNs(OpCostClass::ELEMENTWISE, 2, breakEven),
+            model.estimateNs(OpCostClass::ELEMENTWISE, 1, breakEven));
+  ASSERT_EQ(breakEven, Environment::getInstance().elementwiseThreshold());
+
+  model.reset();
+  ASSERT_FALSE(CostModel::isCalibrated());
+  ASSERT_EQ(threshold, Environment::getInstance().elementwiseThreshold());
+  ASSERT_EQ(16, ThreadsHelper::numberOfThreadsTad(16, 1024, n, OpCostClass::ELEMENTWISE));
+}
+
+TEST_F(ThreadsTests, cost_model_file_1) {
+  CostModelParams params;
+  params.threads = 4;
+  params.bandwidthSingle = 12.5;
+  params.bandwidthAll = 30.25;
+  params.flopsPerNs = 16.0;
+  params.wakeupNs2 = 1500.0;
+  params.wakeupNsAll = 3000.0;
+
+  auto &model = CostModel::getInstance();
+  model.setParams(params);
+
+  auto path = testing::TempDir() + "cost_model_file_1.txt";
+  model.save(path);
+  model.reset();
+
+  CostModelParams loaded;
+  ASSERT_TRUE(CostModel::load(path, loaded));
+  ASSERT_EQ(params.threads, loaded.threads);
+  ASSERT_EQ(params.bandwidthSingle, loaded.bandwidthSingle);
+  ASSERT_EQ(params.bandwidthAll, loaded.bandwidthAll);
+  ASSERT_EQ(params.flopsPerNs, loaded.flopsPerNs);
+  ASSERT_EQ(params.wakeupNsAll, loaded.wakeupNsAll);
+
+  ASSERT_FALSE(CostModel::load(path + ".missing", loaded));
+  std::remove(path.c_str());
+}
@@ -19,9 +19,12 @@
 //
 // Created by raver119 on 02/07/18.
 //
+#include <helpers/BulkTypeCast.h>
 #include <loops/type_conversions.h>
 #include <ops/declarable/CustomOperations.h>
 
+#include <cstring>
+
 #include "testlayers.h"
 
 using namespace sd;
@@ -69,3 +72,131 @@ TEST_F(TypeCastTests, Test_ConvertDtype_1) {
 
 #endif
 }
+
+TEST_F(TypeCastTests, Test_BulkCast_Half_1) {
+  // covers vector body, scalar tail, subnormals, overflow and ties
+  const int limit = 1037;
+  std::vector<float> src(limit);
+  for (int e = 0; e < limit; e++) src[e] = (e - 500) * 0.37f;
+
+  src[0] = 65520.f;
+  src[1] = -70000.f;
+  src[2] = 1e-7f;
+  src[3] = 2.98023224e-08f;
+  src[4] = 1.00048828125f;
+
+  std::vector<float16> z(limit);
+  std::vector<float> back(limit);
+  BulkTypeCast::floatToHalf(src.data(), z.data(), limit);
+  BulkTypeCast::halfToFloat(z.data(), back.data(), limit);
+
+  for (int e = 0; e < limit; e++) {
+    float16 exp = src[e];
+    ASSERT_EQ(exp.data.getX(), z[e].data.getX());
+    ASSERT_EQ(static_cast<float>(exp), back[e]);
+  }
+}
+
+TEST_F(TypeCastTests, Test_BulkCast_BFloat16_1) {
+  const int limit = 1037;
+  std::vector<float> src(limit);
+  for (int e = 0; e < limit; e++) src[e] = (e - 500) * 1.0039f;
+
+  std::vector<bfloat16> z(limit);
+  std::vector<float> back(limit);
+  BulkTypeCast::floatToBfloat16(src.data(), z.data(), limit);
+  BulkTypeCast::bfloat16ToFloat(z.data(), back.data(), limit);
+
+  for (int e = 0; e < limit; e++) {
+    bfloat16 exp = src[e];
+    ASSERT_EQ(exp._data, z[e]._data);
+    ASSERT_EQ(static_cast<float>(exp), back[e]);
+  }
+
+  float nan = std::numeric_limits<float>::quiet_NaN();
+  bfloat16 bnan;
+  BulkTypeCast::floatToBfloat16(&nan, &bnan, 1);
+  ASSERT_TRUE(std::isnan(static_cast<float>(bnan)));
+}
+
+// all 2^32 float inputs and all 2^16 encoded values, takes minutes, run with --gtest_also_run_disabled_tests
+TEST_F(TypeCastTests, DISABLED_Test_BulkCast_Exhaustive_1) {
+  const LongType chunk = 1 << 20;
+  std::vector<float> src(chunk), back(chunk);
+  std::vector<float16> h(chunk);
+  std::vector<bfloat16> b(chunk);
+
+  for (uint64_t first = 0; first < (1ULL << 32); first += chunk) {
+    for (LongType e = 0; e < chunk; e++) {
+      const auto bits = static_cast<uint32_t>(first + e);
+      std::memcpy(&src[e], &bits, sizeof(float));
+    }
+
+    BulkTypeCast::floatToHalf(src.data(), h.data(), chunk);
+    BulkTypeCast::floatToBfloat16(src.data(), b.data(), chunk);
+
+    for (LongType e = 0; e < chunk; e++) {
+      float16 expH = src[e];
+      bfloat16 expB = src[e];
+      if (std::isnan(src[e])) {
+        ASSERT_TRUE(std::isnan(static_cast<float>(h[e])));
+        ASSERT_TRUE(std::isnan(static_cast<float>(b[e])));
+      } else {
+        ASSERT_EQ(expH.data.getX(), h[e].data.getX()) << "input bits " << first + e;
+        ASSERT_EQ(expB._data, b[e]._data) << "input bits " << first + e;
+      }
+    }
+  }
+
+  const LongType all = 1 << 16;
+  for (LongType e = 0; e < all; e++) {
+    *h[e].data.getXP() = static_cast<unsigned short>(e);
+    b[e]._data = static_cast<int16_t>(e);
+  }
+
+  BulkTypeCast::halfToFloat(h.data(), back.data(), all);
+  for (LongType e = 0; e < all; e++) {
+    const float exp = static_cast<float>(h[e]);
+    if (std::isnan(exp))
+      ASSERT_TRUE(std::isnan(back[e]));
+    else
+      ASSERT_EQ(exp, back[e]) << "half bits " << e;
+  }
+
+  BulkTypeCast::bfloat16ToFloat(b.data(), back.data(), all);
+  for (LongType e = 0; e < all; e++) {
+    const float exp = static_cast<float>(b[e]);
+    if (std::isnan(exp))
+      ASSERT_TRUE(std::isnan(back[e]));
+    else
+      ASSERT_EQ(exp, back[e]) << "bfloat16 bits " << e;
+  }
+}
+
+TEST_F(TypeCastTests, Test_BulkCast_Array_1) {
+  auto x = NDArrayFactory::create<float>('c', {3, 517});
+  x.linspace(-20.f, 0.01f);
+
+  auto z = x.cast(DataType::HALF);
+  auto y = z.cast(DataType::BFLOAT16);
+  auto r = y.cast(DataType::DOUBLE);
+
+  for (LongType e = 0; e < x.lengthOf(); e++) {
+    float16 h = x.e<float>(e);
+    bfloat16 b = static_cast<float>(h);
+    ASSERT_EQ(static_cast<double>(static_cast<float>(b)), r.e<double>(e));
+  }
+}
+
+TEST_F(TypeCastTests, Test_ConvertDtype_Float8_1) {
+#ifndef __CUDABLAS__
+  float src[] = {0.5f, 1.0f, -2.0f, 3.0f, 0.0f};
+  float8 dst[5];
+  float back[5];
+
+  convertTypes(nullptr, DataTypeUtils::asInt(DataType::FLOAT32), src, 5, DataTypeUtils::asInt(DataType::FLOAT8), dst);
+  convertTypes(nullptr, DataTypeUtils::asInt(DataType::FLOAT8), dst, 5, DataTypeUtils::asInt(DataType::FLOAT32), back);
+
+  for (int e = 0; e < 5; e++) ASSERT_EQ(static_cast<float>(float8(src[e])), back[e]);
+#endif
+}
@@ -101,6 +101,37 @@ public interface NativeOps {
  void toggleOpTrace(boolean opTrace);
  void purgeOpTrace();
  void printOpTrace();
+ void exportOpTrace(String path);
+ void toggleOpLatencyHistograms(boolean enabled);
+ void purgeOpLatencyHistograms();
+ long opLatencyCount(long opHash);
+ double opLatencyPercentile(long opHash, double quantile);
+ long opLatencyBytesIn(long opHash);
+ long opLatencyBytesOut(long opHash);
+ String opLatencyReport();
+ void toggleTimelineTrace(boolean enabled);
+ void purgeTimelineTrace();
+ void exportTimelineTrace(String path);
+ void calibrateThreading(String path);
+ void resetThreadingCalibration();
+ boolean toggleHardwareCounters(boolean enabled);
+ void purgeHardwareCounters();
+ String hardwareCountersReport();
+ void toggleShapeFunctionCache(boolean enabled);
+ void purgeShapeFunctionCache();
+ void setShapeFunctionCacheCapacity(int entries);
+ long shapeFunctionCacheHits();
+ long shapeFunctionCacheMisses();
+ int execCommandBuffer(PointerPointer extraPointers, LongPointer buffer, long length, PointerPointer arrays, int numArrays, IntPointer statuses, boolean parallel);
+ OpaquePreparedCall prepareCall(long opHash, LongPointer iArgs, int numIArgs, DoublePointer tArgs, int numTArgs, BooleanPointer bArgs, int numBArgs, IntPointer dArgs, int numDArgs, boolean inplace);
+ void setPreparedCallInput(OpaquePreparedCall call, int index, OpaqueNDArray array);
+ void setPreparedCallOutput(OpaquePreparedCall call, int index, OpaqueNDArray array);
+ int bindPreparedCallOutputShapes(OpaquePreparedCall call);
+ LongPointer preparedCallOutputShape(OpaquePreparedCall call, int index);
+ int execPreparedCall(PointerPointer extraPointers, OpaquePreparedCall call);
+ void releasePreparedCall(OpaquePreparedCall call);
+ void setContextPoolMaxIdle(int maxIdle);
+ void purgeContextPool();
  void copyBuffer(org.nd4j.nativeblas.OpaqueDataBuffer target, long n, org.nd4j.nativeblas.OpaqueDataBuffer from, long fromOffset, long targetOffset);
  int contextNumInputs(Pointer contextPointer);
  int contextNumOutputs(Pointer contextPointer);